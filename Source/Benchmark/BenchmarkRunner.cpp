@@ -0,0 +1,2037 @@
+/*
+  ==============================================================================
+
+    BenchmarkRunner.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include <iostream>
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+#include "BenchmarkRunner.h"
+#include "PaintTrace.h"
+#include "PaintTraceReplay.h"
+#include "InputTrace.h"
+#include "InputReplayDriver.h"
+#include "HoverSweep.h"
+#include "PresetLoad.h"
+#include "EditorFrame.h"
+#include "../Rendering/InteractionQuality.h"
+#include "../Rendering/GearSdfRenderer.h"
+#include "../Rendering/RoundedRectRasteriser.h"
+#include "../Rendering/ImageDifference.h"
+#include "../Rendering/BoxBlurShadow.h"
+#include "../Rendering/CacheWarmUp.h"
+#include "../Rendering/MaterialTexture.h"
+#include "../Components/CoalescingSlider.h"
+#include "../Components/ParameterPanel.h"
+#include "../MainComponent.h"
+
+juce::File BenchmarkRunner::paintTraceFile;
+juce::File BenchmarkRunner::inputTraceFile;
+
+namespace
+{
+	juce::ArgumentList createArgumentList(const juce::String& commandLine)
+	{
+		return juce::ArgumentList(juce::JUCEApplication::getInstance() != nullptr
+			? juce::JUCEApplication::getInstance()->getApplicationName()
+			: juce::String("Custom_GUI_Elements"), commandLine);
+	}
+
+	/** Returns the value of an option given as "--option=value" or "--option value". */
+	juce::String getOptionValue(const juce::ArgumentList& args, const juce::String& option)
+	{
+		for (int i = 0; i < args.arguments.size(); i++)
+		{
+			const auto& text = args.arguments.getReference(i).text;
+
+			if (text.startsWith(option + "="))
+				return text.fromFirstOccurrenceOf("=", false, false).unquoted();
+
+			if (text == option)
+			{
+				if (i + 1 < args.arguments.size() && !args.arguments.getReference(i + 1).isOption())
+					return args.arguments.getReference(i + 1).text.unquoted();
+
+				return {};
+			}
+		}
+
+		return {};
+	}
+
+	/** Returns the memory of the process that is in RAM, in bytes, or 0 where it can't be read. */
+	size_t getResidentBytes()
+	{
+	#if JUCE_WINDOWS
+		/** PROCESS_MEMORY_COUNTERS and K32GetProcessMemoryInfo, without windows.h. */
+		struct ProcessMemoryCounters
+		{
+			juce::uint32 size, pageFaultCount;
+			size_t peakWorkingSetSize, workingSetSize;
+			size_t quotaPeakPagedPoolUsage, quotaPagedPoolUsage, quotaPeakNonPagedPoolUsage, quotaNonPagedPoolUsage;
+			size_t pagefileUsage, peakPagefileUsage;
+		};
+
+		using GetProcessMemoryInfo = int (__stdcall*)(void* process, ProcessMemoryCounters* counters, juce::uint32 size);
+
+		juce::DynamicLibrary kernel32("kernel32.dll");
+
+		if (auto getProcessMemoryInfo = (GetProcessMemoryInfo)kernel32.getFunction("K32GetProcessMemoryInfo"))
+		{
+			ProcessMemoryCounters counters {};
+			counters.size = sizeof(counters);
+
+			/** -1 is the handle of the current process. */
+			if (getProcessMemoryInfo((void*)(juce::pointer_sized_int)-1, &counters, counters.size))
+				return counters.workingSetSize;
+		}
+
+		return 0;
+	#elif JUCE_LINUX
+		/** The second field is the number of resident pages. */
+		const auto fields = juce::StringArray::fromTokens(juce::File("/proc/self/statm").loadFileAsString(), false);
+		return fields.size() > 1 ? (size_t)fields[1].getLargeIntValue() * (size_t)sysconf(_SC_PAGESIZE) : 0;
+	#elif JUCE_MAC
+		mach_task_basic_info info;
+		mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+
+		if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+			return (size_t)info.resident_size;
+
+		return 0;
+	#else
+		return 0;
+	#endif
+	}
+}
+
+bool BenchmarkRunner::runFromCommandLine(const juce::String& commandLine)
+{
+	const auto args = createArgumentList(commandLine);
+
+	/** Held for the whole run, so the budget applies to the cache the benchmarks use. */
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+	applyRenderCacheBudget(args, *renderCache);
+
+	/** There is no message loop to rebuild layers drawn stretched later, so they are rebuilt right away. */
+	renderCache->setDeferredRebuilds(false);
+
+	if (args.containsOption("--replay-paint-trace"))
+	{
+		replayPaintTrace(args);
+		return true;
+	}
+
+	if (args.containsOption("--replay-input-trace"))
+	{
+		replayInputTrace(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-lod"))
+	{
+		benchmarkLevelOfDetail(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-hover"))
+	{
+		benchmarkHoverSweep(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-preset"))
+	{
+		benchmarkPresetLoad(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-scale"))
+	{
+		benchmarkScaleSweep(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-resize"))
+	{
+		benchmarkLiveResize(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-orientation"))
+	{
+		benchmarkFaderOrientations(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-sdf"))
+	{
+		benchmarkGearSdf(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-roundrect"))
+	{
+		benchmarkRoundedRects(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-shadow"))
+	{
+		benchmarkShadows(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-parallel-layers"))
+	{
+		benchmarkParallelLayers(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-warmup"))
+	{
+		benchmarkCacheWarmUp(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-diskcache"))
+	{
+		benchmarkDiskCache(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-material"))
+	{
+		benchmarkSurfaceMaterial(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-coalesce"))
+	{
+		benchmarkDragCoalescing(args);
+		return true;
+	}
+
+	if (args.containsOption("--bench-panel"))
+	{
+		benchmarkParameterPanel(args);
+		return true;
+	}
+
+	return false;
+}
+
+void BenchmarkRunner::startRecording(const juce::String& commandLine)
+{
+	const auto args = createArgumentList(commandLine);
+
+	paintTraceFile = getFileForOption(args, "--record-paint-trace");
+	inputTraceFile = getFileForOption(args, "--record-input-trace");
+
+	if (paintTraceFile != juce::File())
+		PaintTrace::startRecording();
+
+	if (inputTraceFile != juce::File())
+		InputTrace::startRecording();
+}
+
+void BenchmarkRunner::finishRecording()
+{
+	if (PaintTrace::isRecording())
+	{
+		PaintTrace::stopRecording();
+		PaintTrace::writeToFile(paintTraceFile);
+	}
+
+	if (InputTrace::isRecording())
+	{
+		InputTrace::stopRecording();
+		InputTrace::writeToFile(inputTraceFile);
+	}
+}
+
+void BenchmarkRunner::replayPaintTrace(const juce::ArgumentList& args)
+{
+	const auto traceFile = getFileForOption(args, "--replay-paint-trace");
+
+	juce::Array<PaintTrace::Event> events;
+
+	if (!PaintTrace::readFromFile(traceFile, events))
+	{
+		writeReport(args, "Could not read paint trace: " + traceFile.getFullPathName() + juce::newLine);
+		return;
+	}
+
+	const int numIterations = getNumIterations(args, 10);
+
+	PaintTraceReplay replay;
+
+	/** One untimed pass so that fonts, gradients and layouts are not counted in the results. */
+	replay.run(events, 1);
+	replay.reset();
+
+	replay.run(events, numIterations);
+
+	juce::String report;
+	report << "Paint trace: " << traceFile.getFileName()
+		<< " (" << events.size() << " paints x " << numIterations << " iterations)" << juce::newLine
+		<< replay.createReport();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::replayInputTrace(const juce::ArgumentList& args)
+{
+	const auto traceFile = getFileForOption(args, "--replay-input-trace");
+
+	juce::Array<InputTrace::Event> events;
+	juce::String source;
+
+	if (traceFile != juce::File())
+	{
+		if (!InputTrace::readFromFile(traceFile, events))
+		{
+			writeReport(args, "Could not read input trace: " + traceFile.getFullPathName() + juce::newLine);
+			return;
+		}
+
+		source = traceFile.getFileName();
+	}
+	else
+	{
+		/** Synthetic drags at the sizes MainComponent uses, delivered like a 1000Hz mouse. */
+		events.addArray(InputTrace::createDragSweep(ControlType::gearKnob, 600, 360, { 0.f, -250.f }, 500, 1000.0));
+		events.addArray(InputTrace::createDragSweep(ControlType::mixingConsoleFader, 100, 360, { 0.f, -300.f }, 500, 1000.0));
+		events.addArray(InputTrace::createDragSweep(ControlType::mixingConsoleFader, 490, 140, { 400.f, 0.f }, 500, 1000.0));
+		events.addArray(InputTrace::createDragSweep(ControlType::synthBipolarFader, 100, 360, { 0.f, -300.f }, 500, 1000.0));
+		events.addArray(InputTrace::createDragSweep(ControlType::synthBipolarFader, 490, 140, { 400.f, 0.f }, 500, 1000.0));
+
+		source = "synthetic drags";
+	}
+
+	InputReplayDriver driver;
+	driver.run(events);
+
+	juce::String report;
+	report << "Input trace: " << source << " (" << events.size() << " events)" << juce::newLine
+		<< driver.createReport();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkLevelOfDetail(const juce::ArgumentList& args)
+{
+	/** Control sizes (fader length, knob diameter, button side) from tiny to full screen. */
+	constexpr int sizes[] = { 12, 24, 48, 96, 192, 384, 768 };
+	constexpr int numValues = 21;
+
+	juce::Array<PaintTrace::Event> events;
+
+	for (const int size : sizes)
+	{
+		for (int i = 0; i < numValues; i++)
+		{
+			PaintTrace::Event event;
+			event.value = (float)i / (numValues - 1);
+
+			/** Faders are as long as the size, plus their text box. */
+			event.bounds = { 0, 0, juce::jmax(24, size / 4), size + 40 };
+			event.controlType = ControlType::mixingConsoleFader;
+			events.add(event);
+			event.controlType = ControlType::synthBipolarFader;
+			events.add(event);
+
+			/** The knob is drawn in the top 3/4 of its bounds. */
+			event.bounds = { 0, 0, size, size * 4 / 3 };
+			event.controlType = ControlType::gearKnob;
+			events.add(event);
+
+			event.bounds = { 0, 0, size, size };
+			event.controlType = ControlType::waveformButton;
+			event.variant = (juce::uint8)(i % 5);
+			event.flags = (i % 3 == 0) ? PaintTrace::down : 0;
+			events.add(event);
+		}
+	}
+
+	const int numIterations = getNumIterations(args, 10);
+
+	PaintTraceReplay replay;
+
+	/** One untimed pass to fill the caches. */
+	replay.run(events, 1);
+	replay.reset();
+
+	replay.run(events, numIterations);
+
+	juce::String report;
+	report << "Level of detail sweep (" << events.size() << " paints x " << numIterations << " iterations)" << juce::newLine
+		<< replay.createReport();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkHoverSweep(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 10);
+
+	HoverSweep hoverSweep;
+
+	const auto direct = hoverSweep.run(numIterations, false);
+	const auto scheduled = hoverSweep.run(numIterations, true);
+
+	juce::String report;
+	report << "Hover sweep: " << HoverSweep::numRows << "x" << HoverSweep::numColumns << " waveform buttons ("
+		<< numIterations << " sweeps)" << juce::newLine
+		<< HoverSweep::createReport(direct, scheduled);
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkPresetLoad(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 10);
+
+	PresetLoad presetLoad;
+
+	/** One untimed load of each mode, to fill the caches and create the text layouts. */
+	presetLoad.run(1, false);
+	presetLoad.run(1, true);
+
+	const auto direct = presetLoad.run(numIterations, false);
+	const auto transaction = presetLoad.run(numIterations, true);
+
+	juce::String report;
+	report << "Preset load: " << PresetLoad::numChanges << " parameter changes to " << PresetLoad::numFaders << " faders, "
+		<< PresetLoad::numKnobs << " knobs and " << PresetLoad::numButtons << " buttons (" << numIterations << " loads)" << juce::newLine
+		<< PresetLoad::createReport(direct, transaction);
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkScaleSweep(const juce::ArgumentList& args)
+{
+	constexpr float scales[] = { 1.f, 1.5f, 2.f, 3.f };
+	constexpr int numScales = (int)std::size(scales);
+	constexpr int numValues = 5;
+
+	/** The controls at the sizes MainComponent uses. */
+	auto createEvents = [](float scale)
+	{
+		juce::Array<PaintTrace::Event> events;
+
+		for (int i = 0; i < numValues; i++)
+		{
+			PaintTrace::Event event;
+			event.scale = scale;
+			event.value = (float)i / (numValues - 1);
+
+			for (const auto controlType : { ControlType::mixingConsoleFader, ControlType::synthBipolarFader })
+			{
+				event.controlType = controlType;
+				event.bounds = { 0, 0, 100, 360 };
+				events.add(event);
+				event.bounds = { 0, 0, 490, 140 };
+				events.add(event);
+			}
+
+			event.controlType = ControlType::gearKnob;
+			event.bounds = { 0, 0, 300, 400 };
+			events.add(event);
+
+			event.controlType = ControlType::waveformButton;
+			event.bounds = { 0, 0, 60, 40 };
+			event.variant = (juce::uint8)i;
+			events.add(event);
+		}
+
+		return events;
+	};
+
+	const int numIterations = getNumIterations(args, 10);
+
+	PaintTraceReplay replay;
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+
+	/** Paints the events once, with the cache holding only the layers of the previous display. */
+	auto measureSwitch = [&](const juce::Array<PaintTrace::Event>& from, const juce::Array<PaintTrace::Event>& to, bool lazy)
+	{
+		renderCache->clear();
+		renderCache->setDeferredRebuilds(false);
+		replay.run(from, 1);
+
+		renderCache->setDeferredRebuilds(lazy);
+		replay.reset();
+		replay.run(to, 1);
+
+		return replay.getTotal().totalSeconds;
+	};
+
+	juce::String report;
+	report << "Scale sweep (" << createEvents(1.f).size() << " paints per frame, " << numIterations << " iterations)" << juce::newLine
+		<< "Switch: first frame after moving from the previous scale, rebuilding every layer or drawing them from the old scale" << juce::newLine
+		<< juce::String("Scale").paddedRight(' ', 8)
+		<< juce::String("Switch ms").paddedLeft(' ', 12)
+		<< juce::String("Lazy ms").paddedLeft(' ', 12)
+		<< juce::String("Fallbacks").paddedLeft(' ', 12)
+		<< juce::String("Mean us").paddedLeft(' ', 12)
+		<< juce::String("Layers").paddedLeft(' ', 10)
+		<< juce::String("KB").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	for (int i = 0; i < numScales; i++)
+	{
+		const auto events = createEvents(scales[i]);
+		const auto previousEvents = createEvents(scales[(i + numScales - 1) % numScales]);
+
+		const double switchSeconds = measureSwitch(previousEvents, events, false);
+		const double lazySwitchSeconds = measureSwitch(previousEvents, events, true);
+		const auto numFallbacks = renderCache->getStats().numStaleDraws;
+
+		/** Steady state at this scale only. */
+		renderCache->clear();
+		renderCache->setDeferredRebuilds(false);
+		replay.run(events, 1);
+		replay.reset();
+		replay.run(events, numIterations);
+
+		const auto stats = renderCache->getStats();
+
+		report << juce::String(scales[i], 1).paddedRight(' ', 8)
+			<< juce::String(switchSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(lazySwitchSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(numFallbacks).paddedLeft(' ', 12)
+			<< juce::String(replay.getTotal().getMeanSeconds() * 1.0e6, 1).paddedLeft(' ', 12)
+			<< juce::String(stats.numLayers).paddedLeft(' ', 10)
+			<< juce::String(stats.numBytes / 1024.0, 1).paddedLeft(' ', 10)
+			<< juce::newLine;
+	}
+
+	renderCache->clear();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkLiveResize(const juce::ArgumentList& args)
+{
+	constexpr int numResizeFrames = 60;
+	constexpr float finalSize = 1.5f;
+	constexpr int maxSettleFrames = 1000;
+
+	/** The controls at the sizes MainComponent uses, scaled by the window size. */
+	auto createEvents = [](float size)
+	{
+		auto scaled = [size](int width, int height) { return juce::Rectangle<int>(juce::roundToInt(width * size), juce::roundToInt(height * size)); };
+
+		juce::Array<PaintTrace::Event> events;
+		PaintTrace::Event event;
+		event.value = 0.5f;
+
+		for (const auto controlType : { ControlType::mixingConsoleFader, ControlType::synthBipolarFader })
+		{
+			event.controlType = controlType;
+			event.bounds = scaled(100, 360);
+			events.add(event);
+			event.bounds = scaled(490, 140);
+			events.add(event);
+		}
+
+		event.controlType = ControlType::gearKnob;
+		event.bounds = scaled(300, 400);
+		events.add(event);
+
+		event.controlType = ControlType::waveformButton;
+		event.bounds = scaled(60, 40);
+
+		for (int waveform = 0; waveform < 5; waveform++)
+		{
+			event.variant = (juce::uint8)waveform;
+			events.add(event);
+		}
+
+		return events;
+	};
+
+	struct Frames
+	{
+		int numFrames = 0;
+		double totalMilliseconds = 0.0;
+		double maxMilliseconds = 0.0;
+
+		void add(double milliseconds)
+		{
+			numFrames++;
+			totalMilliseconds += milliseconds;
+			maxMilliseconds = juce::jmax(maxMilliseconds, milliseconds);
+		}
+	};
+
+	struct Run
+	{
+		Frames resizing;
+		Frames settling;
+		juce::int64 numLayersRendered = 0;
+		juce::int64 numStaleDraws = 0;
+	};
+
+	const int numIterations = getNumIterations(args, 5);
+
+	PaintTraceReplay replay;
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+
+	/** Stands in for the top level component, so that the controls see a live resize. */
+	juce::Component window;
+
+	/** Resizes the window from its size to finalSize times that, then paints frames until no layer is drawn stretched. */
+	auto measureResize = [&](bool deferred)
+	{
+		Run run;
+
+		for (int iteration = 0; iteration < numIterations; iteration++)
+		{
+			renderCache->clear();
+			renderCache->setDeferredRebuilds(false);
+			replay.run(createEvents(1.f), 1);
+
+			renderCache->setDeferredRebuilds(deferred);
+			renderCache->resetStats();
+
+			auto paintFrame = [&](float size, Frames& frames)
+			{
+				renderCache->beginFrame();
+
+				const double start = juce::Time::getMillisecondCounterHiRes();
+				replay.run(createEvents(size), 1);
+				frames.add(juce::Time::getMillisecondCounterHiRes() - start);
+			};
+
+			InteractionQuality resize;
+			resize.attachTo(&window);
+
+			for (int frame = 1; frame <= numResizeFrames; frame++)
+			{
+				resize.resizeStarted();
+				paintFrame(1.f + (finalSize - 1.f) * frame / numResizeFrames, run.resizing);
+			}
+
+			resize.settle();
+
+			for (int frame = 0; frame < maxSettleFrames; frame++)
+			{
+				const auto numStaleDrawsBefore = renderCache->getStats().numStaleDraws;
+				paintFrame(finalSize, run.settling);
+
+				if (renderCache->getStats().numStaleDraws == numStaleDrawsBefore)
+					break;
+			}
+
+			const auto stats = renderCache->getStats();
+			run.numLayersRendered += stats.numMisses;
+			run.numStaleDraws += stats.numStaleDraws;
+		}
+
+		return run;
+	};
+
+	const auto eager = measureResize(false);
+	const auto deferred = measureResize(true);
+
+	auto addRow = [numIterations](juce::String& report, const juce::String& name, const Run& run)
+	{
+		report << name.paddedRight(' ', 10)
+			<< juce::String(run.resizing.totalMilliseconds / juce::jmax(1, run.resizing.numFrames), 2).paddedLeft(' ', 14)
+			<< juce::String(run.resizing.maxMilliseconds, 2).paddedLeft(' ', 14)
+			<< juce::String((double)run.settling.numFrames / numIterations, 1).paddedLeft(' ', 10)
+			<< juce::String(run.settling.maxMilliseconds, 2).paddedLeft(' ', 14)
+			<< juce::String((double)run.numLayersRendered / numIterations, 1).paddedLeft(' ', 10)
+			<< juce::String((double)run.numStaleDraws / numIterations, 1).paddedLeft(' ', 10)
+			<< juce::newLine;
+	};
+
+	juce::String report;
+	report << "Live resize: " << createEvents(1.f).size() << " controls resized to " << juce::String(finalSize, 1) << "x over "
+		<< numResizeFrames << " frames, then painted until settled (" << numIterations << " iterations, rebuild budget "
+		<< juce::String(renderCache->getRebuildBudget(), 1) << " ms per frame)" << juce::newLine
+		<< juce::String("Mode").paddedRight(' ', 10)
+		<< juce::String("Resize ms").paddedLeft(' ', 14)
+		<< juce::String("Resize max").paddedLeft(' ', 14)
+		<< juce::String("Settle").paddedLeft(' ', 10)
+		<< juce::String("Settle max").paddedLeft(' ', 14)
+		<< juce::String("Rendered").paddedLeft(' ', 10)
+		<< juce::String("Stale").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	addRow(report, "Eager", eager);
+	addRow(report, "Deferred", deferred);
+
+	renderCache->clear();
+	renderCache->setDeferredRebuilds(false);
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkFaderOrientations(const juce::ArgumentList& args)
+{
+	/** Fader lengths. Across, the faders have the proportions of the ones in MainComponent (100x360 and 490x140). */
+	constexpr int lengths[] = { 120, 240, 360, 480 };
+	constexpr int numValues = 21;
+
+	/** The faders of one type and orientation, swept across their range. */
+	auto createEvents = [](ControlType controlType, bool vertical)
+	{
+		juce::Array<PaintTrace::Event> events;
+
+		for (const int length : lengths)
+		{
+			for (int i = 0; i < numValues; i++)
+			{
+				PaintTrace::Event event;
+				event.controlType = controlType;
+				event.value = (float)i / (numValues - 1);
+				event.bounds = vertical ? juce::Rectangle<int>(length * 5 / 18, length) : juce::Rectangle<int>(length, length * 2 / 7);
+				events.add(event);
+			}
+		}
+
+		return events;
+	};
+
+	const int numIterations = getNumIterations(args, 10);
+
+	PaintTraceReplay replay;
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+
+	juce::String report;
+	report << "Fader orientations (" << createEvents(ControlType::mixingConsoleFader, true).size() << " paints per orientation, "
+		<< numIterations << " iterations)" << juce::newLine
+		<< "Cold: the render cache is cleared before every iteration, so the cached layers are rendered again" << juce::newLine
+		<< juce::String("Control").paddedRight(' ', 24)
+		<< juce::String("Orientation").paddedRight(' ', 14)
+		<< juce::String("Mean us").paddedLeft(' ', 12)
+		<< juce::String("Max us").paddedLeft(' ', 12)
+		<< juce::String("Cold us").paddedLeft(' ', 12)
+		<< juce::newLine;
+
+	for (const auto controlType : { ControlType::mixingConsoleFader, ControlType::synthBipolarFader })
+	{
+		for (const bool vertical : { true, false })
+		{
+			const auto events = createEvents(controlType, vertical);
+
+			/** Warm: every layer is cached. */
+			renderCache->clear();
+			replay.run(events, 1);
+			replay.reset();
+			replay.run(events, numIterations);
+			const auto warm = replay.getResult(controlType);
+
+			replay.reset();
+
+			for (int iteration = 0; iteration < numIterations; iteration++)
+			{
+				renderCache->clear();
+				replay.run(events, 1);
+			}
+
+			const auto cold = replay.getResult(controlType);
+
+			report << juce::String(getControlTypeName(controlType)).paddedRight(' ', 24)
+				<< juce::String(vertical ? "vertical" : "horizontal").paddedRight(' ', 14)
+				<< juce::String(warm.getMeanSeconds() * 1.0e6, 1).paddedLeft(' ', 12)
+				<< juce::String(warm.maxSeconds * 1.0e6, 1).paddedLeft(' ', 12)
+				<< juce::String(cold.getMeanSeconds() * 1.0e6, 1).paddedLeft(' ', 12)
+				<< juce::newLine;
+		}
+	}
+
+	renderCache->clear();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkGearSdf(const juce::ArgumentList& args)
+{
+	/** Knob diameters, from below the threaded size to a full screen knob. */
+	constexpr int diameters[] = { 48, 96, 192, 384, 768 };
+	constexpr int numAngles = 16;
+
+	const int numIterations = getNumIterations(args, 10);
+
+	RotaryKnob_GearShaped_LookAndFeel lookAndFeel;
+	GearSdfRenderer sdfRenderer;
+	const juce::SharedResourcePointer<RenderThreadPool> threadPool;
+
+	const auto theme = Theme::getCurrent();
+	const auto& colours = theme->getColours();
+
+	bool allWithinTolerance = true;
+
+	juce::String report;
+	report << "Gear knob, paths vs SDF (" << numAngles << " angles, " << numIterations << " iterations, "
+		<< threadPool->getNumThreads() << " threads from " << GearSdfRenderer::minPixelsForThreads << " pixels)" << juce::newLine
+		<< "Diff: mean difference in 8-bit levels, and the share of pixels more than "
+		<< ImageDifference::largeLevels << " levels apart" << juce::newLine
+		<< juce::String("Diameter").paddedRight(' ', 10)
+		<< juce::String("Paths us").paddedLeft(' ', 12)
+		<< juce::String("SDF us").paddedLeft(' ', 12)
+		<< juce::String("Speed-up").paddedLeft(' ', 10)
+		<< juce::String("Diff").paddedLeft(' ', 8)
+		<< juce::String("Large %").paddedLeft(' ', 10)
+		<< juce::String("Match").paddedLeft(' ', 8)
+		<< juce::newLine;
+
+	for (const int diameter : diameters)
+	{
+		GearSdfRenderer::Parameters knob;
+		knob.totalDiameter = (float)diameter;
+		knob.diskColour = colours.knobDisk;
+		knob.pointerColour = colours.knobPointer;
+		knob.gearColour = colours.knobGear;
+		knob.shadow = BoxBlurShadow(juce::Colours::black.withAlpha(0.5f), 20, { -20, 20 });
+
+		/** Both are rendered into an image covering the knob and its shadow, at a physical pixel scale of 1. */
+		const auto area = GearSdfRenderer::getDrawnArea(knob).getSmallestIntegerContainer();
+		knob.centre -= area.getPosition().toFloat();
+
+		juce::Image pathImage(juce::Image::ARGB, area.getWidth(), area.getHeight(), true, juce::SoftwareImageType());
+		juce::Image sdfImage(juce::Image::ARGB, area.getWidth(), area.getHeight(), true, juce::SoftwareImageType());
+		const auto imageArea = pathImage.getBounds().toFloat();
+
+		double pathSeconds = 0.0;
+		double sdfSeconds = 0.0;
+		ImageDifference worst;
+
+		for (int iteration = 0; iteration <= numIterations; iteration++)
+		{
+			for (int i = 0; i < numAngles; i++)
+			{
+				knob.angle = juce::MathConstants<float>::twoPi * i / numAngles;
+
+				pathImage.clear(pathImage.getBounds());
+
+				auto start = juce::Time::getMillisecondCounterHiRes();
+				{
+					juce::Graphics g(pathImage);
+					lookAndFeel.drawKnob(g, knob, false);
+				}
+				const auto pathMilliseconds = juce::Time::getMillisecondCounterHiRes() - start;
+
+				start = juce::Time::getMillisecondCounterHiRes();
+				sdfRenderer.render(sdfImage, imageArea, 1.f, knob);
+				const auto sdfMilliseconds = juce::Time::getMillisecondCounterHiRes() - start;
+
+				/** The first round only warms up the cached shadow mask and is compared, not timed. */
+				if (iteration == 0)
+				{
+					worst.takeWorst(ImageDifference::between(pathImage, sdfImage));
+					continue;
+				}
+
+				pathSeconds += pathMilliseconds / 1000.0;
+				sdfSeconds += sdfMilliseconds / 1000.0;
+			}
+		}
+
+		const auto numPaints = (double)(numIterations * numAngles);
+
+		/** Smaller knobs are compared too, but the LookAndFeel draws them from paths, so they don't fail the run. */
+		const bool drawnFromSdf = diameter >= GearSdfRenderer::minDiameter;
+		if (drawnFromSdf)
+			allWithinTolerance = allWithinTolerance && worst.isWithinTolerance();
+
+		report << juce::String(diameter).paddedRight(' ', 10)
+			<< juce::String(pathSeconds / numPaints * 1.0e6, 1).paddedLeft(' ', 12)
+			<< juce::String(sdfSeconds / numPaints * 1.0e6, 1).paddedLeft(' ', 12)
+			<< (juce::String(pathSeconds / juce::jmax(sdfSeconds, 1.0e-9), 2) + "x").paddedLeft(' ', 10)
+			<< juce::String(worst.meanLevels, 2).paddedLeft(' ', 8)
+			<< juce::String(worst.fractionLarge * 100.0, 2).paddedLeft(' ', 10)
+			<< juce::String(worst.isWithinTolerance() ? "yes" : "no").paddedLeft(' ', 8)
+			<< (drawnFromSdf ? "" : "  (drawn from paths)")
+			<< juce::newLine;
+	}
+
+	report << juce::newLine << "SDF matches paths at every diameter from " << GearSdfRenderer::minDiameter << " up: "
+		<< (allWithinTolerance ? "yes" : "no") << juce::newLine;
+
+	writeReport(args, report);
+
+	/** A mismatch fails the run, so scripts can check the SDF rendering against the paths. */
+	if (!allWithinTolerance && juce::JUCEApplication::getInstance() != nullptr)
+		juce::JUCEApplication::getInstance()->setApplicationReturnValue(1);
+}
+
+void BenchmarkRunner::benchmarkRoundedRects(const juce::ArgumentList& args)
+{
+	/** Rectangle widths. They're half as tall, with the 5 pixel corners of the fader caps and waveform buttons. */
+	constexpr int widths[] = { 24, 96, 384 };
+	constexpr float cornerSize = 5.f;
+	constexpr int numFillsPerIteration = 100;
+
+	/** The fills of the fader tracks (three colours across), the waveform buttons (radial) and the fader caps (solid). */
+	enum class FillKind { linear, radial, solid };
+
+	const int numIterations = getNumIterations(args, 10);
+
+	const auto theme = Theme::getCurrent();
+	const auto& colours = theme->getColours();
+
+	auto createGradient = [&colours](FillKind kind, juce::Rectangle<float> area)
+	{
+		if (kind == FillKind::radial)
+			return juce::ColourGradient(colours.buttonNormal.brighter(0.2f), area.getRelativePoint(0.8f, 0.2f),
+				colours.buttonNormal, area.getCentre(), true);
+
+		if (kind == FillKind::solid)
+		{
+			juce::ColourGradient solidColour;
+			solidColour.addColour(0.0, colours.sliderCap);
+			return solidColour;
+		}
+
+		auto gradient = juce::ColourGradient::horizontal(colours.sliderTrackSides, area.getX() + area.getWidth() / 4,
+			colours.sliderTrackSides, area.getRight() - area.getWidth() / 4);
+		gradient.addColour(0.5, colours.sliderTrackCenter);
+		return gradient;
+	};
+
+	/** Fills through Graphics: with the rasteriser enabled on a software image, or as Graphics would without it. */
+	auto fillWithGraphics = [&](juce::Image& image, FillKind kind, juce::Rectangle<float> area)
+	{
+		juce::Graphics g(image);
+
+		if (kind == FillKind::solid)
+			RoundedRectRasteriser::fill(g, area, cornerSize, colours.sliderCap);
+		else
+			RoundedRectRasteriser::fill(g, area, cornerSize, createGradient(kind, area));
+	};
+
+	/** Returns the mean time of one fill, in microseconds. */
+	auto timeFills = [numIterations](const std::function<void()>& fillOnce)
+	{
+		const auto start = juce::Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numIterations * numFillsPerIteration; i++)
+			fillOnce();
+
+		return (juce::Time::getMillisecondCounterHiRes() - start) * 1000.0 / (numIterations * numFillsPerIteration);
+	};
+
+	const bool wasEnabled = RoundedRectRasteriser::isEnabled();
+
+	juce::String report;
+	report << "Rounded rectangles (" << RoundedRectRasteriser::getInstructionSetName(RoundedRectRasteriser::getInstructionSet())
+		<< ", " << numFillsPerIteration << " fills x " << numIterations << " iterations)" << juce::newLine
+		<< "Graphics: fillRoundedRectangle(); Raster: through Graphics on a software image; Direct: straight into the image's pixels" << juce::newLine
+		<< juce::String("Fill").paddedRight(' ', 10)
+		<< juce::String("Size").paddedRight(' ', 10)
+		<< juce::String("Graphics us").paddedLeft(' ', 13)
+		<< juce::String("Raster us").paddedLeft(' ', 12)
+		<< juce::String("Direct us").paddedLeft(' ', 12)
+		<< juce::String("Speed-up").paddedLeft(' ', 10)
+		<< juce::String("Diff").paddedLeft(' ', 8)
+		<< juce::String("Match").paddedLeft(' ', 8)
+		<< juce::newLine;
+
+	for (const auto kind : { FillKind::linear, FillKind::radial, FillKind::solid })
+	{
+		for (const int width : widths)
+		{
+			/** Drawn over an opaque background, a little in from the edges, at fractional positions. */
+			const auto area = juce::Rectangle<float>(4.25f, 4.5f, (float)width, width / 2.f);
+			const auto bounds = area.getSmallestIntegerContainer().expanded(4);
+
+			juce::Image graphicsImage(juce::Image::ARGB, bounds.getRight(), bounds.getBottom(), false, juce::SoftwareImageType());
+			juce::Image rasterImage(juce::Image::ARGB, bounds.getRight(), bounds.getBottom(), false, juce::SoftwareImageType());
+			graphicsImage.clear(graphicsImage.getBounds(), colours.sliderTrackCenter.withAlpha(1.f));
+			rasterImage.clear(rasterImage.getBounds(), colours.sliderTrackCenter.withAlpha(1.f));
+
+			RoundedRectRasteriser::setEnabled(false);
+			fillWithGraphics(graphicsImage, kind, area);
+			const auto graphicsMicroseconds = timeFills([&] { fillWithGraphics(graphicsImage, kind, area); });
+
+			RoundedRectRasteriser::setEnabled(true);
+			fillWithGraphics(rasterImage, kind, area);
+			const auto difference = ImageDifference::between(graphicsImage, rasterImage);
+			const auto rasterMicroseconds = timeFills([&] { fillWithGraphics(rasterImage, kind, area); });
+
+			const auto gradient = createGradient(kind, area);
+			const auto directMicroseconds = timeFills([&]
+				{
+					const juce::Image::BitmapData bitmap(rasterImage, juce::Image::BitmapData::readWrite);
+					RoundedRectRasteriser::fill(bitmap, area, cornerSize, gradient);
+				});
+
+			report << juce::String(kind == FillKind::linear ? "linear" : kind == FillKind::radial ? "radial" : "solid").paddedRight(' ', 10)
+				<< (juce::String(width) + "x" + juce::String(width / 2)).paddedRight(' ', 10)
+				<< juce::String(graphicsMicroseconds, 2).paddedLeft(' ', 13)
+				<< juce::String(rasterMicroseconds, 2).paddedLeft(' ', 12)
+				<< juce::String(directMicroseconds, 2).paddedLeft(' ', 12)
+				<< (juce::String(graphicsMicroseconds / juce::jmax(rasterMicroseconds, 1.0e-6), 2) + "x").paddedLeft(' ', 10)
+				<< juce::String(difference.meanLevels, 2).paddedLeft(' ', 8)
+				<< juce::String(difference.isWithinTolerance() ? "yes" : "no").paddedLeft(' ', 8)
+				<< juce::newLine;
+		}
+	}
+
+	RoundedRectRasteriser::setEnabled(wasEnabled);
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkShadows(const juce::ArgumentList& args)
+{
+	/** The radius of every shadow in the app is 20. */
+	constexpr int radii[] = { 5, 20, 40 };
+
+	const int numIterations = getNumIterations(args, 20);
+
+	/** The shapes with path shadows: the gear knob at its default size and a bipolar fader cap. */
+	const std::pair<const char*, juce::Path> shapes[] = {
+		{ "gear", Shapes::getGearShapedPath(8, 200.f, 100.f, 100.f, 150.f) },
+		{ "cap", []
+			{
+				juce::Path cap;
+				cap.addRoundedRectangle(0.f, 0.f, 40.f, 80.f, 5.f);
+				return cap;
+			}() }
+	};
+
+	/**
+	 * Draws a white shadow into a mask the size of the shape and its padding, as the LookAndFeels
+	 * do into their cached masks, and returns the mean time of one in microseconds.
+	 */
+	auto timeShadow = [numIterations](juce::Image& mask, const std::function<void(juce::Graphics&)>& drawShadow)
+	{
+		const auto start = juce::Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numIterations; i++)
+		{
+			mask.clear(mask.getBounds());
+			juce::Graphics maskGraphics(mask);
+			drawShadow(maskGraphics);
+		}
+
+		return (juce::Time::getMillisecondCounterHiRes() - start) * 1000.0 / numIterations;
+	};
+
+	juce::String report;
+	report << "Path shadows, juce::DropShadow vs BoxBlurShadow (" << numIterations << " iterations)" << juce::newLine
+		<< "Diff: mean difference in 8-bit levels, and the share of pixels more than "
+		<< ImageDifference::largeLevels << " levels apart" << juce::newLine
+		<< juce::String("Shape").paddedRight(' ', 8)
+		<< juce::String("Radius").paddedLeft(' ', 8)
+		<< juce::String("Boxes").paddedLeft(' ', 10)
+		<< juce::String("JUCE us").paddedLeft(' ', 12)
+		<< juce::String("Box us").paddedLeft(' ', 12)
+		<< juce::String("Speed-up").paddedLeft(' ', 10)
+		<< juce::String("Diff").paddedLeft(' ', 8)
+		<< juce::String("Large %").paddedLeft(' ', 10)
+		<< juce::String("Match").paddedLeft(' ', 8)
+		<< juce::newLine;
+
+	for (const auto& [name, path] : shapes)
+	{
+		for (const int radius : radii)
+		{
+			const int padding = radius + 1;
+			const auto shapeBounds = path.getBounds().getSmallestIntegerContainer();
+
+			juce::Path shape(path);
+			shape.applyTransform(juce::AffineTransform::translation((float)(padding - shapeBounds.getX()), (float)(padding - shapeBounds.getY())));
+
+			juce::Image juceMask(juce::Image::SingleChannel, shapeBounds.getWidth() + 2 * padding, shapeBounds.getHeight() + 2 * padding,
+				true, juce::SoftwareImageType());
+			juce::Image boxMask(juce::Image::SingleChannel, juceMask.getWidth(), juceMask.getHeight(), true, juce::SoftwareImageType());
+
+			const juce::DropShadow juceShadow(juce::Colours::white, radius, {});
+			const BoxBlurShadow boxShadow(juce::Colours::white, radius, {});
+
+			const auto juceMicroseconds = timeShadow(juceMask, [&](juce::Graphics& g) { juceShadow.drawForPath(g, shape); });
+			const auto boxMicroseconds = timeShadow(boxMask, [&](juce::Graphics& g) { boxShadow.drawForPath(g, shape); });
+			const auto difference = ImageDifference::between(juceMask, boxMask);
+
+			const auto boxRadii = BoxBlurShadow::getBoxRadii(BoxBlurShadow::getSigmaForRadius((float)radius));
+
+			report << juce::String(name).paddedRight(' ', 8)
+				<< juce::String(radius).paddedLeft(' ', 8)
+				<< (juce::String(boxRadii[0]) + "," + juce::String(boxRadii[1]) + "," + juce::String(boxRadii[2])).paddedLeft(' ', 10)
+				<< juce::String(juceMicroseconds, 1).paddedLeft(' ', 12)
+				<< juce::String(boxMicroseconds, 1).paddedLeft(' ', 12)
+				<< (juce::String(juceMicroseconds / juce::jmax(boxMicroseconds, 1.0e-6), 2) + "x").paddedLeft(' ', 10)
+				<< juce::String(difference.meanLevels, 2).paddedLeft(' ', 8)
+				<< juce::String(difference.fractionLarge * 100.0, 2).paddedLeft(' ', 10)
+				<< juce::String(difference.isWithinTolerance() ? "yes" : "no").paddedLeft(' ', 8)
+				<< juce::newLine;
+		}
+	}
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkParallelLayers(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 10);
+
+	EditorFrame editorFrame;
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+	const juce::SharedResourcePointer<RenderThreadPool> threadPool;
+
+	juce::Image directFrame(juce::Image::ARGB, EditorFrame::width, EditorFrame::height, true, juce::SoftwareImageType());
+	juce::Image parallelFrameImage(juce::Image::ARGB, EditorFrame::width, EditorFrame::height, true, juce::SoftwareImageType());
+
+	/** Thread counts: 1, 2, 4... up to every thread of the pool. */
+	juce::Array<int> threadCounts;
+
+	for (int numThreads = 1; numThreads < threadPool->getNumThreads(); numThreads *= 2)
+		threadCounts.add(numThreads);
+
+	threadCounts.add(threadPool->getNumThreads());
+
+	/** Cold: the first frame with an empty render cache, so every cached layer is rendered too. */
+	auto paintCold = [&](juce::Image& frame, int numThreads)
+	{
+		renderCache->clear();
+		renderCache->setDeferredRebuilds(false);
+		const double seconds = editorFrame.paint(frame, 1, numThreads);
+		renderCache->setDeferredRebuilds(true);
+
+		return seconds;
+	};
+
+	const double directColdSeconds = paintCold(directFrame, 0);
+	const double directSeconds = editorFrame.paint(directFrame, numIterations, 0);
+
+	juce::String report;
+	report << "Full frame of " << EditorFrame::numControls << " controls at " << EditorFrame::width << "x" << EditorFrame::height
+		<< " (" << numIterations << " frames, " << juce::SystemStats::getNumCpus() << " cores)" << juce::newLine
+		<< "Direct: painted on the message thread only; Cold: the first frame after clearing the render cache;" << juce::newLine
+		<< "Layers: rendered across the threads in the cold frame" << juce::newLine
+		<< juce::String("Threads").paddedRight(' ', 10)
+		<< juce::String("Layers").paddedLeft(' ', 8)
+		<< juce::String("Frame ms").paddedLeft(' ', 12)
+		<< juce::String("Cold ms").paddedLeft(' ', 12)
+		<< juce::String("Speed-up").paddedLeft(' ', 10)
+		<< juce::String("Diff").paddedLeft(' ', 8)
+		<< juce::String("Match").paddedLeft(' ', 8)
+		<< juce::newLine
+		<< juce::String("direct").paddedRight(' ', 10)
+		<< juce::String("-").paddedLeft(' ', 8)
+		<< juce::String(directSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+		<< juce::String(directColdSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+		<< juce::String("1.00x").paddedLeft(' ', 10)
+		<< juce::String("-").paddedLeft(' ', 8)
+		<< juce::String("-").paddedLeft(' ', 8)
+		<< juce::newLine;
+
+	for (const int numThreads : threadCounts)
+	{
+		const double coldSeconds = paintCold(parallelFrameImage, numThreads);
+		const int numLayersRendered = editorFrame.getNumLayersRendered();
+		const double seconds = editorFrame.paint(parallelFrameImage, numIterations, numThreads);
+		const auto difference = ImageDifference::between(directFrame, parallelFrameImage);
+
+		report << juce::String(numThreads).paddedRight(' ', 10)
+			<< juce::String(numLayersRendered).paddedLeft(' ', 8)
+			<< juce::String(seconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(coldSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< (juce::String(directSeconds / juce::jmax(seconds, 1.0e-9), 2) + "x").paddedLeft(' ', 10)
+			<< juce::String(difference.meanLevels, 2).paddedLeft(' ', 8)
+			<< juce::String(difference.isWithinTolerance() ? "yes" : "no").paddedLeft(' ', 8)
+			<< juce::newLine;
+	}
+
+	renderCache->clear();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkCacheWarmUp(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 5);
+	const float scale = CacheWarmUp::getPrimaryDisplayScale();
+
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+	const juce::SharedResourcePointer<DigitGlyphAtlas> digitGlyphAtlas;
+	const juce::SharedResourcePointer<RenderThreadPool> threadPool;
+
+	applyRenderCacheBudget(args, *renderCache);
+
+	struct Launch
+	{
+		double firstFrameWarmUpSeconds = 0.0;
+		double warmUpSeconds = 0.0;
+		double firstFrameSeconds = 0.0;
+		double paintSeconds = 0.0;
+		double otherControlsSeconds = 0.0;
+	};
+
+	/**
+	 * A launch from empty caches, as in Custom_GUI_ElementsApplication::initialise(): the warm-up starts, the main
+	 * component is created and, once the warm-up has rendered the layers of the first frame, its first frame is painted.
+	 * Then, once the warm-up is done, every control it keeps hidden is painted once, as when it's first picked from the combo box.
+	 */
+	auto launch = [&](int numWarmUpThreads)
+	{
+		renderCache->clear();
+		renderCache->setDeferredRebuilds(false);
+		digitGlyphAtlas->clear();
+
+		Launch result;
+		const auto start = juce::Time::getMillisecondCounterHiRes();
+
+		std::unique_ptr<CacheWarmUp> cacheWarmUp;
+
+		if (numWarmUpThreads > 0)
+		{
+			cacheWarmUp.reset(new CacheWarmUp(scale, numWarmUpThreads));
+			cacheWarmUp->start();
+		}
+
+		MainComponent mainComponent;
+
+		if (cacheWarmUp != nullptr)
+		{
+			cacheWarmUp->waitUntilFirstFrameReady();
+			result.firstFrameWarmUpSeconds = cacheWarmUp->getFirstFrameSeconds();
+		}
+
+		auto paint = [scale](juce::Component& component)
+		{
+			juce::Image frame(juce::Image::ARGB, juce::jmax(1, juce::roundToInt(component.getWidth() * scale)),
+				juce::jmax(1, juce::roundToInt(component.getHeight() * scale)), true, juce::SoftwareImageType());
+			juce::Graphics g(frame);
+			g.addTransform(juce::AffineTransform::scale(scale));
+
+			const auto paintStart = juce::Time::getMillisecondCounterHiRes();
+			component.paintEntireComponent(g, true);
+
+			return (juce::Time::getMillisecondCounterHiRes() - paintStart) / 1000.0;
+		};
+
+		result.paintSeconds = paint(mainComponent);
+		result.firstFrameSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+
+		if (cacheWarmUp != nullptr)
+		{
+			cacheWarmUp->waitUntilDone();
+			result.warmUpSeconds = cacheWarmUp->getSeconds();
+		}
+
+		for (auto* child : mainComponent.getChildren())
+		{
+			if (!child->isVisible())
+				result.otherControlsSeconds += paint(*child);
+		}
+
+		renderCache->setDeferredRebuilds(true);
+
+		return result;
+	};
+
+	/** Fonts and typefaces stay loaded for the life of the process: load them before anything is measured. */
+	launch(0);
+	const int numWarmedUpControls = CacheWarmUp(scale).getNumControls();
+
+	juce::Array<int> threadCounts { 0, 1 };
+
+	if (threadPool->getNumThreads() > 1)
+		threadCounts.add(threadPool->getNumThreads());
+
+	juce::String report;
+	report << "Launch from empty caches at scale " << juce::String(scale, 2) << " (" << numIterations << " iterations, "
+		<< numWarmedUpControls << " controls warmed up)" << juce::newLine
+		<< "First frame: from the start of the launch until the main component is painted; Others: the first paint"
+		<< " of each hidden control; Warm-up: until the layers of the first frame, and all of them, were rendered" << juce::newLine
+		<< juce::String("Warm-up").paddedRight(' ', 12)
+		<< juce::String("1st set ms").paddedLeft(' ', 12)
+		<< juce::String("Warm-up ms").paddedLeft(' ', 12)
+		<< juce::String("First ms").paddedLeft(' ', 12)
+		<< juce::String("Paint ms").paddedLeft(' ', 12)
+		<< juce::String("Others ms").paddedLeft(' ', 12)
+		<< juce::String("Layers").paddedLeft(' ', 10)
+		<< juce::String("KB").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	for (const int numThreads : threadCounts)
+	{
+		Launch total;
+
+		for (int iteration = 0; iteration < numIterations; iteration++)
+		{
+			const auto result = launch(numThreads);
+
+			total.firstFrameWarmUpSeconds += result.firstFrameWarmUpSeconds / numIterations;
+			total.warmUpSeconds += result.warmUpSeconds / numIterations;
+			total.firstFrameSeconds += result.firstFrameSeconds / numIterations;
+			total.paintSeconds += result.paintSeconds / numIterations;
+			total.otherControlsSeconds += result.otherControlsSeconds / numIterations;
+		}
+
+		const auto stats = renderCache->getStats();
+		const auto name = numThreads == 0 ? juce::String("none")
+			: juce::String(numThreads) + (numThreads == 1 ? " thread" : " threads");
+
+		report << name.paddedRight(' ', 12)
+			<< juce::String(total.firstFrameWarmUpSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(total.warmUpSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(total.firstFrameSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(total.paintSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(total.otherControlsSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			<< juce::String(stats.numLayers).paddedLeft(' ', 10)
+			<< juce::String(stats.numBytes / 1024.0, 1).paddedLeft(' ', 10)
+			<< juce::newLine;
+	}
+
+	renderCache->clear();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkDiskCache(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 5);
+	const float scale = CacheWarmUp::getPrimaryDisplayScale();
+
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+	const juce::SharedResourcePointer<DigitGlyphAtlas> digitGlyphAtlas;
+
+	applyRenderCacheBudget(args, *renderCache);
+	renderCache->setDeferredRebuilds(false);
+
+	const auto cacheFile = juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("RenderCacheBenchmark.bin");
+
+	auto time = [](const std::function<void()>& function)
+	{
+		const auto start = juce::Time::getMillisecondCounterHiRes();
+		function();
+		return (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+	};
+
+	/** Every layer CacheWarmUp renders at startup. */
+	auto warmUp = [scale]
+	{
+		CacheWarmUp cacheWarmUp(scale);
+		cacheWarmUp.start();
+		cacheWarmUp.waitUntilDone();
+	};
+
+	/** The first frame of the main component, with the digit glyphs not rendered yet, as after a launch. */
+	juce::Image frame;
+
+	auto paintFirstFrame = [&]
+	{
+		digitGlyphAtlas->clear();
+
+		MainComponent mainComponent;
+		frame = juce::Image(juce::Image::ARGB, juce::roundToInt(mainComponent.getWidth() * scale),
+			juce::roundToInt(mainComponent.getHeight() * scale), true, juce::SoftwareImageType());
+
+		juce::Graphics g(frame);
+		g.addTransform(juce::AffineTransform::scale(scale));
+
+		return time([&] { mainComponent.paintEntireComponent(g, true); });
+	};
+
+	/** Fonts and typefaces stay loaded for the life of the process: load them before anything is measured. */
+	renderCache->clear();
+	paintFirstFrame();
+
+	double renderSeconds = 0.0, saveSeconds = 0.0, loadSeconds = 0.0, warmStartSeconds = 0.0;
+	double coldFrameSeconds = 0.0, mappedFrameSeconds = 0.0;
+	int numLoaded = 0;
+	RenderCache::Stats renderedStats, coldFrameStats;
+	juce::Image coldFrame, mappedFrame;
+
+	for (int iteration = 0; iteration < numIterations; iteration++)
+	{
+		renderCache->clear();
+		coldFrameSeconds += paintFirstFrame() / numIterations;
+		coldFrame = frame;
+		coldFrameStats = renderCache->getStats();
+
+		renderCache->clear();
+		renderSeconds += time(warmUp) / numIterations;
+		renderedStats = renderCache->getStats();
+
+		saveSeconds += time([&] { renderCache->saveToFile(cacheFile); }) / numIterations;
+
+		renderCache->clear();
+		loadSeconds += time([&] { numLoaded = renderCache->loadFromFile(cacheFile); }) / numIterations;
+		warmStartSeconds += time(warmUp) / numIterations;
+
+		renderCache->clear();
+		renderCache->loadFromFile(cacheFile);
+		mappedFrameSeconds += paintFirstFrame() / numIterations;
+		mappedFrame = frame;
+	}
+
+	const auto mappedStats = renderCache->getStats();
+	const auto difference = ImageDifference::between(coldFrame, mappedFrame);
+
+	/** A byte flipped in the pixels of one layer, then in the table of layers. */
+	auto loadDamaged = [&](juce::int64 position)
+	{
+		juce::MemoryBlock contents;
+		cacheFile.loadFileAsData(contents);
+
+		const auto damagedFile = cacheFile.getSiblingFile("RenderCacheBenchmarkDamaged.bin");
+		static_cast<juce::uint8*>(contents.getData())[position] ^= 0xff;
+		damagedFile.replaceWithData(contents.getData(), contents.getSize());
+
+		renderCache->clear();
+		const int numDamagedLoaded = renderCache->loadFromFile(damagedFile);
+		renderCache->clear();
+		damagedFile.deleteFile();
+
+		return numDamagedLoaded;
+	};
+
+	const int numLoadedWithDamagedPixels = loadDamaged(cacheFile.getSize() - 1);
+	/** The layer id of the first record, right after the 40 byte header. */
+	const int numLoadedWithDamagedTable = loadDamaged(44);
+
+	juce::String report;
+	report << "Render cache saved to and mapped from disk at scale " << juce::String(scale, 2)
+		<< " (" << numIterations << " iterations, " << juce::String(cacheFile.getSize() / 1024.0, 1) << " KB file)" << juce::newLine
+		<< "Warm start: the startup warm-up once the file is loaded; First frame: the main component from empty caches"
+		<< " and from the loaded file" << juce::newLine
+		<< juce::String("Step").paddedRight(' ', 24)
+		<< juce::String("ms").paddedLeft(' ', 10)
+		<< juce::String("Layers").paddedLeft(' ', 10)
+		<< juce::String("KB").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	auto addRow = [&report](const juce::String& name, double seconds, int numLayers, size_t numBytes)
+	{
+		report << name.paddedRight(' ', 24)
+			<< juce::String(seconds * 1.0e3, 2).paddedLeft(' ', 10)
+			<< juce::String(numLayers).paddedLeft(' ', 10)
+			<< juce::String(numBytes / 1024.0, 1).paddedLeft(' ', 10)
+			<< juce::newLine;
+	};
+
+	addRow("Render", renderSeconds, renderedStats.numLayers, renderedStats.numBytes);
+	addRow("Save", saveSeconds, renderedStats.numLayers, (size_t)cacheFile.getSize());
+	addRow("Load", loadSeconds, numLoaded, renderedStats.numBytes);
+	addRow("Warm start", warmStartSeconds, numLoaded, renderedStats.numBytes);
+	addRow("First frame, rendered", coldFrameSeconds, coldFrameStats.numLayers, coldFrameStats.numBytes);
+	addRow("First frame, mapped", mappedFrameSeconds, mappedStats.numMappedLayers, mappedStats.numBytes);
+
+	report << juce::newLine
+		<< "Frames rendered and mapped: " << juce::String(difference.meanLevels, 2) << " levels apart ("
+		<< (difference.isWithinTolerance() ? "match" : "differ") << ")" << juce::newLine
+		<< "Damaged pixels: " << numLoadedWithDamagedPixels << " of " << numLoaded << " layers loaded; damaged table: "
+		<< numLoadedWithDamagedTable << " loaded" << juce::newLine;
+
+	renderCache->setDeferredRebuilds(true);
+	cacheFile.deleteFile();
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkSurfaceMaterial(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 100);
+	const float scale = CacheWarmUp::getPrimaryDisplayScale();
+
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+	const juce::SharedResourcePointer<MaterialTexture> materialTexture;
+
+	applyRenderCacheBudget(args, *renderCache);
+	renderCache->setDeferredRebuilds(false);
+
+	auto time = [](const std::function<void()>& function)
+	{
+		const auto start = juce::Time::getMillisecondCounterHiRes();
+		function();
+		return (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+	};
+
+	/** Decoding is done once per run of the app, so it's timed fewer times than the paints. */
+	const int numDecodes = juce::jmin(numIterations, 10);
+	double decodeSeconds = 0.0, copiesSeconds = 0.0;
+
+	for (int i = 0; i < numDecodes; i++)
+	{
+		materialTexture->releaseResources();
+		decodeSeconds += time([&] { materialTexture->getLevel(std::numeric_limits<int>::max()); }) / numDecodes;
+		copiesSeconds += time([&] { materialTexture->getLevel(MaterialTexture::smallestLevelSize); }) / numDecodes;
+	}
+
+	const int numLevels = materialTexture->getNumLevels();
+	const size_t textureBytes = materialTexture->getNumBytes();
+
+	/** The controls build only the copies they need. */
+	materialTexture->releaseResources();
+
+	RotaryKnob_GearShaped knob;
+	knob.setSize(200, 200);
+
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+	juce::Slider mixingConsoleFader, synthBipolarFader;
+
+	for (auto* fader : { &mixingConsoleFader, &synthBipolarFader })
+	{
+		fader->setSliderStyle(juce::Slider::LinearVertical);
+		fader->setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
+		fader->setSize(100, 360);
+	}
+
+	mixingConsoleFader.setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+	synthBipolarFader.setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+	mixingConsoleFader.setRange(0, 1, 0.01);
+	synthBipolarFader.setRange(-1, 1, 0.01);
+
+	struct Control
+	{
+		juce::String name;
+		juce::Component& component;
+		std::function<void(bool)> setSurfaceMaterial;
+	};
+
+	const Control controls[] =
+	{
+		{ "Gear knob", knob, [&](bool material) { knob.setSurfaceMaterial(material); } },
+		{ "Mixing console fader", mixingConsoleFader, [&](bool material) { slider_MixingConsoleStyle_LookAndFeel.setSurfaceMaterial(material); } },
+		{ "Synth bipolar fader", synthBipolarFader, [&](bool material) { slider_SynthBipolar_LookAndFeel.setSurfaceMaterial(material); } }
+	};
+
+	auto paint = [scale](juce::Component& component)
+	{
+		juce::Image image(juce::Image::ARGB, juce::roundToInt(component.getWidth() * scale),
+			juce::roundToInt(component.getHeight() * scale), true, juce::SoftwareImageType());
+
+		juce::Graphics g(image);
+		g.addTransform(juce::AffineTransform::scale(scale));
+		component.paintEntireComponent(g, true);
+	};
+
+	/** Time per paint, with every layer cached or with the render cache cleared before each paint. */
+	auto timePaints = [&](juce::Component& component, bool cold)
+	{
+		renderCache->clear();
+		paint(component);
+
+		double seconds = 0.0;
+
+		for (int i = 0; i < numIterations; i++)
+		{
+			if (cold)
+				renderCache->clear();
+
+			seconds += time([&] { paint(component); });
+		}
+
+		return seconds / numIterations;
+	};
+
+	juce::String report;
+	report << "Surface material at scale " << juce::String(scale, 2) << " (" << numIterations << " iterations)" << juce::newLine
+		<< "Decode: " << juce::String(decodeSeconds * 1.0e3, 2) << " ms; pre-scaled copies down to "
+		<< MaterialTexture::smallestLevelSize << " px: " << juce::String(copiesSeconds * 1.0e3, 2) << " ms ("
+		<< numLevels << " levels, " << juce::String(textureBytes / 1024.0, 1) << " KB)" << juce::newLine
+		<< juce::String("Control").paddedRight(' ', 24)
+		<< juce::String("Off ms").paddedLeft(' ', 10)
+		<< juce::String("On ms").paddedLeft(' ', 10)
+		<< juce::String("Off cold").paddedLeft(' ', 10)
+		<< juce::String("On cold").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	for (const auto& control : controls)
+	{
+		double seconds[4];
+
+		for (int i = 0; i < 4; i++)
+		{
+			control.setSurfaceMaterial(i % 2 == 1);
+			seconds[i] = timePaints(control.component, i >= 2);
+		}
+
+		control.setSurfaceMaterial(false);
+
+		report << control.name.paddedRight(' ', 24);
+
+		for (const auto controlSeconds : seconds)
+			report << juce::String(controlSeconds * 1.0e3, 3).paddedLeft(' ', 10);
+
+		report << juce::newLine;
+	}
+
+	/** Every control with its material, as MainComponent draws them. */
+	renderCache->clear();
+
+	for (const auto& control : controls)
+	{
+		control.setSurfaceMaterial(true);
+		paint(control.component);
+	}
+
+	const auto stats = renderCache->getStats();
+
+	report << juce::newLine
+		<< "Texture built by the controls: " << materialTexture->getNumLevels() << " levels, "
+		<< juce::String(stats.numAssetBytes / 1024.0, 1) << " KB counted in the render cache" << juce::newLine
+		<< stats.toString() << juce::newLine;
+
+	mixingConsoleFader.setLookAndFeel(nullptr);
+	synthBipolarFader.setLookAndFeel(nullptr);
+	renderCache->setDeferredRebuilds(true);
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkDragCoalescing(const juce::ArgumentList& args)
+{
+	const int numIterations = getNumIterations(args, 5);
+	constexpr double eventsPerSecond = 1000.0;
+	constexpr double framesPerSecond = 60.0;
+	constexpr int numberOfDrags = 500;
+
+	int numValueChanges = 0;
+
+	/** Set up like the controls of MainComponent, and painted through probes as they have no window. */
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+	CoalescingSlider mixingConsoleFader("mixingConsoleFader"), synthBipolarFader("synthBipolarFader");
+	RotaryKnob_GearShaped gearKnob;
+
+	mixingConsoleFader.setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+	synthBipolarFader.setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+	mixingConsoleFader.setRange(0, 1, 0.01);
+	synthBipolarFader.setRange(-1, 1, 0.01);
+
+	std::array<CoalescingSlider*, numControlTypes> sliders {};
+	sliders[(size_t)ControlType::gearKnob] = &gearKnob;
+	sliders[(size_t)ControlType::mixingConsoleFader] = &mixingConsoleFader;
+	sliders[(size_t)ControlType::synthBipolarFader] = &synthBipolarFader;
+
+	for (auto* slider : { &mixingConsoleFader, &synthBipolarFader })
+		slider->setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+
+	for (auto* slider : sliders)
+	{
+		if (slider == nullptr)
+			continue;
+
+		/** Invisible components ignore repaint(), so they must be visible (they are still offscreen). */
+		slider->setVisible(true);
+		slider->setDragVelocityEstimation(true);
+		slider->onValueChange = [&numValueChanges] { numValueChanges++; };
+	}
+
+	struct Sweep
+	{
+		ControlType controlType;
+		int width;
+		int height;
+		juce::Point<float> distance;
+	};
+
+	/** The synthetic drags of the input trace replay, at the sizes MainComponent uses. */
+	const Sweep sweeps[] =
+	{
+		{ ControlType::gearKnob, 600, 360, { 0.f, -250.f } },
+		{ ControlType::mixingConsoleFader, 100, 360, { 0.f, -300.f } },
+		{ ControlType::mixingConsoleFader, 490, 140, { 400.f, 0.f } },
+		{ ControlType::synthBipolarFader, 100, 360, { 0.f, -300.f } },
+		{ ControlType::synthBipolarFader, 490, 140, { 400.f, 0.f } }
+	};
+
+	juce::String report;
+	report << "Drag coalescing: " << numberOfDrags << " drags at " << juce::String(eventsPerSecond, 0) << "Hz, painted at "
+		<< juce::String(framesPerSecond, 0) << "Hz (" << numIterations << " iterations)" << juce::newLine
+		<< "Velocity: estimated before the mouse up, and the actual speed of the sweep, in pixels per second" << juce::newLine
+		<< juce::String("Control").paddedRight(' ', 36)
+		<< juce::String("Drags").paddedLeft(' ', 8)
+		<< juce::String("Applied").paddedLeft(' ', 9)
+		<< juce::String("Changes").paddedLeft(' ', 9)
+		<< juce::String("Paints").paddedLeft(' ', 8)
+		<< juce::String("ms").paddedLeft(' ', 10)
+		<< juce::String("Value").paddedLeft(' ', 10)
+		<< juce::String("Velocity").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	for (const auto& sweep : sweeps)
+	{
+		auto& slider = *sliders[(size_t)sweep.controlType];
+
+		if (sweep.controlType != ControlType::gearKnob)
+			slider.setSliderStyle(FaderOrientation::getSliderStyle(sweep.width, sweep.height));
+
+		slider.setBounds(0, 0, sweep.width, sweep.height);
+
+		auto& probe = RepaintProbe::attachTo(slider);
+		const double startValue = slider.getValue();
+		const auto events = InputTrace::createDragSweep(sweep.controlType, sweep.width, sweep.height, sweep.distance,
+			numberOfDrags, eventsPerSecond);
+		const double actualSpeed = sweep.distance.getDistanceFromOrigin() * eventsPerSecond / numberOfDrags;
+
+		double finalValues[2] = {};
+
+		for (const bool coalesce : { false, true })
+		{
+			slider.setDragCoalescing(coalesce);
+
+			double seconds = 0.0;
+			float speed = 0.f;
+
+			for (int iteration = 0; iteration < numIterations; iteration++)
+			{
+				slider.setValue(startValue, juce::dontSendNotification);
+				probe.paintDirtyRegion();
+
+				probe.resetCounters();
+				slider.resetDragStats();
+				numValueChanges = 0;
+
+				const auto start = juce::Time::getMillisecondCounterHiRes();
+				double nextFrameMicroseconds = 1.0e6 / framesPerSecond;
+				juce::Point<float> mouseDownPosition;
+
+				for (const auto& event : events)
+				{
+					/** The vblanks since the last event: whatever was held back is applied and painted. */
+					for (; event.timeMicroseconds >= nextFrameMicroseconds; nextFrameMicroseconds += 1.0e6 / framesPerSecond)
+					{
+						slider.flushPendingDrag();
+						probe.paintDirtyRegion();
+					}
+
+					if (event.kind == InputTrace::mouseDown)
+						mouseDownPosition = event.position;
+
+					const juce::MouseEvent mouseEvent(juce::Desktop::getInstance().getMainMouseSource(), event.position,
+						juce::ModifierKeys(juce::ModifierKeys::leftButtonModifier),
+						juce::MouseInputSource::defaultPressure, juce::MouseInputSource::defaultOrientation,
+						juce::MouseInputSource::defaultRotation, juce::MouseInputSource::defaultTiltX, juce::MouseInputSource::defaultTiltY,
+						&slider, &slider, juce::Time((juce::int64)(event.timeMicroseconds / 1000)),
+						mouseDownPosition, juce::Time(0), 1,
+						event.kind != InputTrace::mouseDown && event.position != mouseDownPosition);
+
+					switch (event.kind)
+					{
+					case InputTrace::mouseDown:	slider.mouseDown(mouseEvent);	break;
+					case InputTrace::mouseDrag:	slider.mouseDrag(mouseEvent);	break;
+					case InputTrace::mouseUp:
+						speed = slider.getDragVelocity().getDistanceFromOrigin();
+						slider.mouseUp(mouseEvent);
+						break;
+					default:					break;
+					}
+				}
+
+				probe.paintDirtyRegion();
+				seconds += (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0 / numIterations;
+			}
+
+			finalValues[coalesce ? 1 : 0] = slider.getValue();
+
+			const auto dragStats = slider.getDragStats();
+			const juce::String name = juce::String(getControlTypeName(sweep.controlType)) + " " + juce::String(sweep.width)
+				+ "x" + juce::String(sweep.height) + (coalesce ? ", coalesced" : "");
+
+			report << name.paddedRight(' ', 36)
+				<< juce::String(dragStats.numDragEvents).paddedLeft(' ', 8)
+				<< juce::String(dragStats.numAppliedDrags).paddedLeft(' ', 9)
+				<< juce::String(numValueChanges).paddedLeft(' ', 9)
+				<< juce::String(probe.getNumPaints()).paddedLeft(' ', 8)
+				<< juce::String(seconds * 1.0e3, 2).paddedLeft(' ', 10)
+				<< juce::String(slider.getValue(), 4).paddedLeft(' ', 10)
+				<< (juce::String(speed, 0) + "/" + juce::String(actualSpeed, 0)).paddedLeft(' ', 10)
+				<< juce::newLine;
+		}
+
+		report << "  Final values " << (finalValues[0] == finalValues[1] ? "match" : "differ") << juce::newLine;
+
+		slider.setDragCoalescing(false);
+		slider.setValue(startValue, juce::dontSendNotification);
+		slider.setCachedComponentImage(nullptr);
+	}
+
+	mixingConsoleFader.setLookAndFeel(nullptr);
+	synthBipolarFader.setLookAndFeel(nullptr);
+
+	writeReport(args, report);
+}
+
+void BenchmarkRunner::benchmarkParameterPanel(const juce::ArgumentList& args)
+{
+	const int numFrames = getNumIterations(args, 300);
+	const int numParameters = args.containsOption("--parameters")
+		? juce::jmax(1, getOptionValue(args, "--parameters").getIntValue())
+		: 10000;
+	const float scale = CacheWarmUp::getPrimaryDisplayScale();
+
+	constexpr int width = 1280;
+	constexpr int height = 800;
+	/** Not a multiple of the row height, so rows scroll in and out at every offset. */
+	constexpr int pixelsPerFrame = 37;
+
+	const juce::SharedResourcePointer<RenderCache> renderCache;
+
+	auto time = [](const std::function<void()>& function)
+	{
+		const auto start = juce::Time::getMillisecondCounterHiRes();
+		function();
+		return (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+	};
+
+	auto getBytesAddedSince = [](size_t bytesBefore)
+	{
+		const size_t bytesAfter = getResidentBytes();
+		return bytesAfter > bytesBefore ? bytesAfter - bytesBefore : (size_t)0;
+	};
+
+	struct Result
+	{
+		juce::String name;
+		int numControls = 0;
+		double buildSeconds = 0.0;
+		size_t numBytes = 0;
+		double frameSeconds = 0.0;
+		double maxFrameSeconds = 0.0;
+		/** Times a painted control's range or interval wasn't its parameter's, for the panel. */
+		int numWrongRanges = 0;
+	};
+
+	/** Scrolls down a step per frame, and back to the top at the bottom, painting every frame. Calls afterFrame after each. */
+	auto scroll = [&](juce::Viewport& viewport, Result& result, const std::function<void()>& afterFrame)
+	{
+		juce::Image frame(juce::Image::ARGB, juce::roundToInt(width * scale), juce::roundToInt(height * scale), true,
+			juce::SoftwareImageType());
+
+		const int scrollRange = juce::jmax(1, viewport.getViewedComponent()->getHeight() - viewport.getMaximumVisibleHeight());
+
+		for (int i = 0; i < numFrames; i++)
+		{
+			const double seconds = time([&]
+				{
+					viewport.setViewPosition(0, (i * pixelsPerFrame) % scrollRange);
+
+					frame.clear(frame.getBounds());
+					juce::Graphics g(frame);
+					g.addTransform(juce::AffineTransform::scale(scale));
+					viewport.paintEntireComponent(g, true);
+				});
+
+			result.frameSeconds += seconds / numFrames;
+			result.maxFrameSeconds = juce::jmax(result.maxFrameSeconds, seconds);
+
+			if (afterFrame != nullptr)
+				afterFrame();
+		}
+	};
+
+	/** Fonts and typefaces stay loaded for the life of the process: load them before anything is measured. */
+	{
+		ParameterPanel panel;
+		panel.setParameters(ParameterPanel::createTestParameters(1000));
+		panel.setBounds(0, 0, width, height);
+		panel.setVisible(true);
+
+		Result warmUp;
+		scroll(panel, warmUp, {});
+	}
+
+	renderCache->clear();
+
+	Result model { "Model only" };
+	std::vector<ParameterPanel::Parameter> parameters;
+
+	size_t bytesBefore = getResidentBytes();
+	model.buildSeconds = time([&] { parameters = ParameterPanel::createTestParameters(numParameters); });
+	model.numBytes = getBytesAddedSince(bytesBefore);
+
+	Result virtualised { "Virtualised panel" };
+
+	{
+		bytesBefore = getResidentBytes();
+
+		ParameterPanel panel;
+
+		virtualised.buildSeconds = time([&]
+			{
+				panel.setParameters(parameters);
+				panel.setBounds(0, 0, width, height);
+				panel.setVisible(true);
+			});
+
+		/** The pooled controls are rebound as they scroll: each painted fader and knob must have its parameter's range. */
+		scroll(panel, virtualised, [&panel, &virtualised]
+			{
+				for (int i = 0; i < panel.getNumParameters(); i++)
+				{
+					if (auto* slider = dynamic_cast<juce::Slider*>(panel.getControl(i)))
+					{
+						const auto& parameter = panel.getParameter(i);
+
+						if (slider->getMinimum() != parameter.minimum || slider->getMaximum() != parameter.maximum
+							|| slider->getInterval() != parameter.interval)
+							virtualised.numWrongRanges++;
+					}
+				}
+			});
+
+		virtualised.numControls = panel.getNumControls();
+		virtualised.numBytes = getBytesAddedSince(bytesBefore);
+	}
+
+	const auto virtualisedStats = renderCache->getStats();
+	renderCache->clear();
+
+	Result direct { "A control per parameter" };
+
+	{
+		bytesBefore = getResidentBytes();
+
+		Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+		Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+		juce::Viewport viewport;
+		juce::Component content;
+		juce::OwnedArray<juce::Component> controls;
+
+		direct.buildSeconds = time([&]
+			{
+				viewport.setScrollBarsShown(true, false);
+				viewport.setViewedComponent(&content, false);
+				viewport.setBounds(0, 0, width, height);
+
+				const int numColumns = juce::jmax(1, viewport.getMaximumVisibleWidth() / ParameterPanel::cellWidth);
+				content.setSize(numColumns * ParameterPanel::cellWidth,
+					(numParameters + numColumns - 1) / numColumns * ParameterPanel::cellHeight);
+
+				/** Every parameter gets a control with a Label text box, laid out in the same grid as the panel's. */
+				for (int i = 0; i < numParameters; i++)
+				{
+					const auto& parameter = parameters[(size_t)i];
+					juce::Component* control = nullptr;
+
+					if (parameter.controlType == ControlType::waveformButton)
+					{
+						auto* button = new WaveformButton(parameter.name);
+						button->setWaveform(parameter.waveform);
+						button->setToggleState(parameter.value >= 0.5, juce::dontSendNotification);
+						control = button;
+					}
+					else
+					{
+						auto* slider = parameter.controlType == ControlType::gearKnob ? new RotaryKnob_GearShaped() : new juce::Slider(parameter.name);
+
+						if (parameter.controlType != ControlType::gearKnob)
+						{
+							slider->setSliderStyle(juce::Slider::LinearVertical);
+							slider->setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+							slider->setLookAndFeel(parameter.controlType == ControlType::mixingConsoleFader
+								? (juce::LookAndFeel*)&slider_MixingConsoleStyle_LookAndFeel
+								: (juce::LookAndFeel*)&slider_SynthBipolar_LookAndFeel);
+						}
+
+						slider->setRange(parameter.minimum, parameter.maximum, parameter.interval);
+						slider->setValue(parameter.value, juce::dontSendNotification);
+						control = slider;
+					}
+
+					const juce::Rectangle<int> cell((i % numColumns) * ParameterPanel::cellWidth, (i / numColumns) * ParameterPanel::cellHeight,
+						ParameterPanel::cellWidth, ParameterPanel::cellHeight);
+					control->setBounds(parameter.controlType == ControlType::waveformButton
+						? cell.withTrimmedBottom(ParameterPanel::nameHeight).reduced(5).withSizeKeepingCentre(60, 40)
+						: cell.withTrimmedBottom(ParameterPanel::nameHeight).reduced(5));
+
+					content.addAndMakeVisible(controls.add(control));
+				}
+			});
+
+		scroll(viewport, direct, {});
+
+		direct.numControls = controls.size();
+		direct.numBytes = getBytesAddedSince(bytesBefore);
+
+		for (auto* control : controls)
+			if (dynamic_cast<RotaryKnob_GearShaped*>(control) == nullptr && dynamic_cast<WaveformButton*>(control) == nullptr)
+				control->setLookAndFeel(nullptr);
+
+		controls.clear();
+		viewport.setViewedComponent(nullptr, false);
+	}
+
+	juce::String report;
+	report << "Parameter panel: " << numParameters << " parameters in " << width << "x" << height << " at scale "
+		<< juce::String(scale, 2) << ", " << numFrames << " frames scrolled " << pixelsPerFrame << " pixels each" << juce::newLine
+		<< "Memory: resident memory added by each, including the render cache layers its frames rendered" << juce::newLine
+		<< juce::String("Panel").paddedRight(' ', 28)
+		<< juce::String("Controls").paddedLeft(' ', 10)
+		<< juce::String("Build ms").paddedLeft(' ', 10)
+		<< juce::String("MB").paddedLeft(' ', 10)
+		<< juce::String("Frame ms").paddedLeft(' ', 10)
+		<< juce::String("Max ms").paddedLeft(' ', 10)
+		<< juce::newLine;
+
+	for (const auto& result : { model, virtualised, direct })
+	{
+		report << result.name.paddedRight(' ', 28)
+			<< juce::String(result.numControls).paddedLeft(' ', 10)
+			<< juce::String(result.buildSeconds * 1.0e3, 1).paddedLeft(' ', 10)
+			<< juce::String(result.numBytes / (1024.0 * 1024.0), 1).paddedLeft(' ', 10)
+			<< juce::String(result.frameSeconds * 1.0e3, 2).paddedLeft(' ', 10)
+			<< juce::String(result.maxFrameSeconds * 1.0e3, 2).paddedLeft(' ', 10)
+			<< juce::newLine;
+	}
+
+	report << juce::newLine << "Virtualised panel: " << virtualisedStats.toString() << juce::newLine
+		<< "Rebound controls painted with another range than their parameter's: " << virtualised.numWrongRanges << juce::newLine;
+
+	if (getResidentBytes() == 0)
+		report << "The resident memory of the process can't be read on this platform." << juce::newLine;
+
+	writeReport(args, report);
+
+	if (virtualised.numWrongRanges > 0 && juce::JUCEApplication::getInstance() != nullptr)
+		juce::JUCEApplication::getInstance()->setApplicationReturnValue(1);
+}
+
+void BenchmarkRunner::writeReport(const juce::ArgumentList& args, const juce::String& report)
+{
+	std::cout << report << std::flush;
+
+	const auto reportFile = getFileForOption(args, "--report");
+
+	if (reportFile != juce::File())
+		reportFile.replaceWithText(report);
+}
+
+void BenchmarkRunner::applyRenderCacheBudget(const juce::ArgumentList& args, RenderCache& renderCache)
+{
+	if (!args.containsOption("--cache-budget-kb"))
+		return;
+
+	renderCache.setByteBudget((size_t)juce::jmax(0, getOptionValue(args, "--cache-budget-kb").getIntValue()) * 1024);
+}
+
+int BenchmarkRunner::getNumIterations(const juce::ArgumentList& args, int defaultIterations)
+{
+	if (!args.containsOption("--iterations"))
+		return defaultIterations;
+
+	return juce::jmax(1, getOptionValue(args, "--iterations").getIntValue());
+}
+
+juce::File BenchmarkRunner::getFileForOption(const juce::ArgumentList& args, const juce::String& option)
+{
+	const auto path = getOptionValue(args, option);
+
+	if (path.isEmpty())
+		return {};
+
+	return juce::File::getCurrentWorkingDirectory().getChildFile(path);
+}
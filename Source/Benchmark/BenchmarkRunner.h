@@ -0,0 +1,162 @@
+/*
+  ==============================================================================
+
+    BenchmarkRunner.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Rendering/RenderCache.h"
+
+/**
+ * Command line entry point for the benchmarks.
+ *
+ * Usage:
+ *   Custom_GUI_Elements --record-paint-trace <file> --record-input-trace <file>
+ *       Runs the app normally and writes every control paint / knob and fader mouse event to the files on exit.
+ *   Custom_GUI_Elements --replay-paint-trace <file> [--iterations <n>] [--report <file>]
+ *       Replays a recorded paint trace headlessly and prints the total and per-control paint time.
+ *   Custom_GUI_Elements --replay-input-trace [<file>] [--report <file>]
+ *       Replays recorded mouse drags (or synthetic ones if no file is given) against offscreen
+ *       knobs and faders and prints drag-to-repaint latency histograms.
+ *   Custom_GUI_Elements --bench-lod [--iterations <n>] [--report <file>]
+ *       Paints every control at a sweep of sizes and prints the paint time per level of detail.
+ *   Custom_GUI_Elements --bench-hover [--iterations <n>] [--report <file>]
+ *       Sweeps the mouse across a 5x32 grid of waveform buttons and prints the repaints and paint time
+ *       with and without the repaint scheduler.
+ *   Custom_GUI_Elements --bench-preset [--iterations <n>] [--report <file>]
+ *       Applies preset loads of 1000 parameter changes one at a time and in a ParameterTransaction,
+ *       and prints the time, notifications and repaints of each.
+ *   Custom_GUI_Elements --bench-scale [--iterations <n>] [--report <file>]
+ *       Paints the controls at physical pixel scales of 1.0, 1.5, 2.0 and 3.0 and prints the paint time,
+ *       the first frame after switching scale and the memory of the cached layers at each.
+ *   Custom_GUI_Elements --bench-resize [--iterations <n>] [--report <file>]
+ *       Live-resizes the controls to 1.5 times their size, rebuilding their layers every frame or stretching
+ *       them until the size settles, and prints the frame times during the resize and until it settles.
+ *   Custom_GUI_Elements --bench-orientation [--iterations <n>] [--report <file>]
+ *       Paints both fader styles vertically and horizontally at a sweep of lengths and prints the paint time
+ *       of each orientation, with the cached layers warm and cold.
+ *   Custom_GUI_Elements --bench-sdf [--iterations <n>] [--report <file>]
+ *       Draws the gear knob from paths and from signed distance functions at a sweep of diameters and prints
+ *       the time of each and how far apart the two renderings are. Exits with 1 if they differ by more than
+ *       ImageDifference's tolerance at any diameter from GearSdfRenderer::minDiameter up, below which the
+ *       LookAndFeel draws the knob from paths.
+ *   Custom_GUI_Elements --bench-roundrect [--iterations <n>] [--report <file>]
+ *       Fills rounded rectangles with the gradients of the fader tracks and waveform buttons and the colour of the
+ *       fader caps, with Graphics and with the SIMD rasteriser, and prints the time of each and their difference.
+ *   Custom_GUI_Elements --bench-shadow [--iterations <n>] [--report <file>]
+ *       Draws the shadows of the gear and of a fader cap into masks with juce::DropShadow and with the box blur
+ *       at radii of 5, 20 and 40, and prints the time of each and their difference.
+ *   Custom_GUI_Elements --bench-parallel-layers [--iterations <n>] [--report <file>]
+ *       Paints a 4K editor of 352 controls whole on the message thread, and with its layers rendered on 1, 2, 4... threads,
+ *       and prints the full frame time of each, warm and with the render cache cleared.
+ *   Custom_GUI_Elements --bench-warmup [--iterations <n>] [--report <file>]
+ *       Launches the main component from empty caches without a cache warm-up and with one on 1 and on every
+ *       render thread, and prints the time to its first frame and the cost of painting it.
+ *   Custom_GUI_Elements --bench-diskcache [--iterations <n>] [--report <file>]
+ *       Renders the layers of the startup warm-up, saves them to a file and maps them back, and prints the time
+ *       of each step and of the first frame painted from rendered and from mapped layers.
+ *   Custom_GUI_Elements --bench-material [--iterations <n>] [--report <file>]
+ *       Decodes the surface material and builds its pre-scaled copies, then paints the knob and both faders with
+ *       and without it, with the cached layers warm and cold, and prints the time of each and the texture memory.
+ *   Custom_GUI_Elements --bench-coalesce [--iterations <n>] [--report <file>]
+ *       Drags the knob and both faders with a 1000Hz mouse, painting at 60Hz, with drag coalescing off and on,
+ *       and prints the drags applied, value changes, paints and time of each, their final values and the velocity
+ *       estimated from the drags.
+ *   Custom_GUI_Elements --bench-panel [--parameters <n>] [--iterations <n>] [--report <file>]
+ *       Builds a ParameterPanel of 10000 parameters and, for comparison, a component with a control per parameter,
+ *       scrolls both for a number of frames and prints the time to build them, their memory and the frame times.
+ *       Exits with 1 if the panel painted a rebound control with another range than its parameter's.
+ *
+ * The replays and the level of detail sweep accept --cache-budget-kb <n> to change the byte budget of the
+ * shared render cache, and report its hits, misses, memory and evictions.
+ */
+class BenchmarkRunner
+{
+public:
+	/**
+	 * Runs the benchmark requested on the command line, if any.
+	 *
+	 * \return True if a benchmark was run, in which case the app should quit without opening a window.
+	 */
+	static bool runFromCommandLine(const juce::String& commandLine);
+
+	/** Starts the recordings requested on the command line. */
+	static void startRecording(const juce::String& commandLine);
+
+	/** Stops the recordings and writes them to their files. */
+	static void finishRecording();
+
+private:
+	/** Replays a paint trace and reports its timings. */
+	static void replayPaintTrace(const juce::ArgumentList& args);
+
+	/** Replays mouse drags and reports their latencies. */
+	static void replayInputTrace(const juce::ArgumentList& args);
+
+	/** Paints every control at a sweep of sizes and reports the timings per level of detail. */
+	static void benchmarkLevelOfDetail(const juce::ArgumentList& args);
+
+	/** Sweeps the mouse across a grid of waveform buttons and reports the repaints. */
+	static void benchmarkHoverSweep(const juce::ArgumentList& args);
+
+	/** Applies preset loads with and without transactions and reports the costs. */
+	static void benchmarkPresetLoad(const juce::ArgumentList& args);
+
+	/** Paints the controls at a sweep of display scales and reports the timings and cache memory. */
+	static void benchmarkScaleSweep(const juce::ArgumentList& args);
+
+	/** Live-resizes the controls with and without deferred rebuilds and reports the frame times. */
+	static void benchmarkLiveResize(const juce::ArgumentList& args);
+
+	/** Paints the faders in both orientations and reports the timings of each. */
+	static void benchmarkFaderOrientations(const juce::ArgumentList& args);
+
+	/** Draws the gear knob from paths and from signed distance functions and reports the timings and differences. */
+	static void benchmarkGearSdf(const juce::ArgumentList& args);
+
+	/** Fills rounded rectangles with Graphics and with the SIMD rasteriser and reports the timings and differences. */
+	static void benchmarkRoundedRects(const juce::ArgumentList& args);
+
+	/** Draws path shadows with juce::DropShadow and with the box blur and reports the timings and differences. */
+	static void benchmarkShadows(const juce::ArgumentList& args);
+
+	/** Paints a 4K editor directly and with its layers rendered on a range of thread counts and reports the frame times. */
+	static void benchmarkParallelLayers(const juce::ArgumentList& args);
+
+	/** Launches the main component with and without a cache warm-up and reports the first frame times. */
+	static void benchmarkCacheWarmUp(const juce::ArgumentList& args);
+
+	/** Saves the render cache to disk and maps it back, and reports the timings of each step. */
+	static void benchmarkDiskCache(const juce::ArgumentList& args);
+
+	/** Decodes the surface material, paints the controls with and without it and reports the timings and memory. */
+	static void benchmarkSurfaceMaterial(const juce::ArgumentList& args);
+
+	/** Drags the controls with and without drag coalescing and reports what each drag sweep cost. */
+	static void benchmarkDragCoalescing(const juce::ArgumentList& args);
+
+	/** Builds and scrolls a virtualised parameter panel and a control per parameter, and reports the costs of each. */
+	static void benchmarkParameterPanel(const juce::ArgumentList& args);
+
+	/** Writes a report to stdout and, if requested, to the --report file. */
+	static void writeReport(const juce::ArgumentList& args, const juce::String& report);
+
+	/** Sets the byte budget of the shared render cache to the value of --cache-budget-kb, if given. */
+	static void applyRenderCacheBudget(const juce::ArgumentList& args, RenderCache& renderCache);
+
+	/** Returns the value of --iterations, or the default. */
+	static int getNumIterations(const juce::ArgumentList& args, int defaultIterations);
+
+	/** Returns the file given to an option, or File() if there is none. */
+	static juce::File getFileForOption(const juce::ArgumentList& args, const juce::String& option);
+
+	/** Files the recordings are written to on exit. */
+	static juce::File paintTraceFile;
+	static juce::File inputTraceFile;
+};
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    EditorFrame.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "EditorFrame.h"
+
+EditorFrame::EditorFrame()
+{
+	editor.setSize(width, height);
+	editor.setVisible(true);
+
+	/** Rows, from the top: vertical faders, horizontal faders, knobs and buttons. */
+	constexpr int verticalFadersPerRow = numVerticalFaders / 2;
+	constexpr int verticalFaderWidth = width / verticalFadersPerRow;
+	constexpr int verticalFaderHeight = 400;
+
+	constexpr int horizontalFadersPerRow = numHorizontalFaders / 4;
+	constexpr int horizontalFaderWidth = width / horizontalFadersPerRow;
+	constexpr int horizontalFaderHeight = 120;
+
+	constexpr int knobsPerRow = numKnobs / 2;
+	constexpr int knobWidth = width / knobsPerRow;
+	constexpr int knobHeight = 200;
+
+	constexpr int buttonsPerRow = numButtons / 4;
+	constexpr int buttonWidth = width / buttonsPerRow;
+	constexpr int buttonHeight = 120;
+
+	for (int i = 0; i < numVerticalFaders + numHorizontalFaders; i++)
+	{
+		auto* fader = faders.add(new juce::Slider("editorFrameFader"));
+		fader->setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
+
+		/** Both styles in every row. */
+		if (i % 2 == 0)
+		{
+			fader->setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+			fader->setRange(0, 1, 0.01);
+		}
+		else
+		{
+			fader->setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+			fader->setRange(-1, 1, 0.01);
+		}
+
+		if (i < numVerticalFaders)
+		{
+			fader->setSliderStyle(juce::Slider::LinearVertical);
+			fader->setBounds((i % verticalFadersPerRow) * verticalFaderWidth, (i / verticalFadersPerRow) * verticalFaderHeight,
+				verticalFaderWidth, verticalFaderHeight);
+		}
+		else
+		{
+			const int index = i - numVerticalFaders;
+			fader->setBounds((index % horizontalFadersPerRow) * horizontalFaderWidth,
+				2 * verticalFaderHeight + (index / horizontalFadersPerRow) * horizontalFaderHeight,
+				horizontalFaderWidth, horizontalFaderHeight);
+		}
+
+		editor.addAndMakeVisible(fader);
+	}
+
+	int top = 2 * verticalFaderHeight + 4 * horizontalFaderHeight;
+
+	for (int i = 0; i < numKnobs; i++)
+	{
+		auto* knob = knobs.add(new RotaryKnob_GearShaped());
+		knob->setBounds((i % knobsPerRow) * knobWidth, top + (i / knobsPerRow) * knobHeight, knobWidth, knobHeight);
+		editor.addAndMakeVisible(knob);
+	}
+
+	top += 2 * knobHeight;
+
+	for (int i = 0; i < numButtons; i++)
+	{
+		auto* button = buttons.add(new WaveformButton("editorFrameButton"));
+		button->setWaveform((WaveformButton_LookAndFeel::Waveform)(i % 5));
+		button->setBounds((i % buttonsPerRow) * buttonWidth, top + (i / buttonsPerRow) * buttonHeight, buttonWidth, buttonHeight);
+		editor.addAndMakeVisible(button);
+	}
+
+	changeValues(0);
+}
+
+EditorFrame::~EditorFrame()
+{
+	for (auto* fader : faders)
+		fader->setLookAndFeel(nullptr);
+}
+
+double EditorFrame::paint(juce::Image& frame, int numFrames, int numThreads)
+{
+	jassert(frame.getWidth() == width && frame.getHeight() == height);
+
+	layerRenderer.setMaxThreads(numThreads);
+
+	const auto start = juce::Time::getMillisecondCounterHiRes();
+
+	for (int i = 0; i < numFrames; i++)
+	{
+		/** Every frame starts from a cleared image, like a window's back buffer. */
+		frame.clear(frame.getBounds());
+		juce::Graphics g(frame);
+
+		if (numThreads == 0)
+			editor.paintEntireComponent(g, true);
+		else
+			layerRenderer.paint(g);
+	}
+
+	return (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0 / juce::jmax(1, numFrames);
+}
+
+void EditorFrame::changeValues(int seed)
+{
+	juce::Random random(seed);
+
+	for (auto* fader : faders)
+		fader->setValue(fader->proportionOfLengthToValue(random.nextDouble()), juce::dontSendNotification);
+
+	for (auto* knob : knobs)
+		knob->setValue(knob->proportionOfLengthToValue(random.nextDouble()), juce::dontSendNotification);
+
+	for (auto* button : buttons)
+		button->setToggleState(random.nextInt(5) == 0, juce::dontSendNotification);
+}
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    EditorFrame.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+#include "../Components/RotaryKnob_GearShaped.h"
+#include "../Components/WaveformButton.h"
+#include "../Rendering/ParallelLayerRenderer.h"
+
+/**
+ * An offscreen 4K editor of 352 faders, knobs and waveform buttons, painted whole into an image
+ * on the calling thread, as JUCE would, or by a ParallelLayerRenderer, which renders the missing
+ * layers across a number of threads, to measure full frame times against the number of cores.
+ */
+class EditorFrame
+{
+public:
+	static constexpr int width = 3840;
+	static constexpr int height = 2160;
+
+	static constexpr int numVerticalFaders = 128;
+	static constexpr int numHorizontalFaders = 32;
+	static constexpr int numKnobs = 96;
+	static constexpr int numButtons = 96;
+	static constexpr int numControls = numVerticalFaders + numHorizontalFaders + numKnobs + numButtons;
+
+	EditorFrame();
+	~EditorFrame();
+
+	/**
+	 * Paints the whole editor into the frame numFrames times and returns the mean seconds per frame.
+	 *
+	 * \param numThreads 0 paints the editor with Component::paintEntireComponent() on this thread,
+	 * anything else with the ParallelLayerRenderer, rendering layers on at most that many threads.
+	 */
+	double paint(juce::Image& frame, int numFrames, int numThreads);
+
+	/** Number of layers the last frame rendered across the threads. */
+	int getNumLayersRendered() const { return layerRenderer.getNumLayersRendered(); }
+
+	/** Moves every control to another value, so that the next frames don't paint the same pixels. */
+	void changeValues(int seed);
+
+private:
+	juce::Component editor;
+
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+
+	juce::OwnedArray<juce::Slider> faders;
+	juce::OwnedArray<RotaryKnob_GearShaped> knobs;
+	juce::OwnedArray<WaveformButton> buttons;
+
+	ParallelLayerRenderer layerRenderer { editor };
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EditorFrame)
+};
@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+
+    HoverSweep.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "HoverSweep.h"
+
+HoverSweep::HoverSweep()
+	: probe(RepaintProbe::attachTo(container)),
+	repaintScheduler(container)
+{
+	/** Buttons the size MainComponent uses, 5 pixels apart. */
+	constexpr int buttonWidth = 30;
+	constexpr int buttonHeight = 20;
+	constexpr int gap = 5;
+
+	container.setSize(numColumns * (buttonWidth + gap), numRows * (buttonHeight + gap));
+	container.setVisible(true);
+
+	for (int row = 0; row < numRows; row++)
+	{
+		for (int column = 0; column < numColumns; column++)
+		{
+			auto* button = buttons.add(new WaveformButton("hoverSweepButton"));
+			button->setWaveform((WaveformButton_LookAndFeel::Waveform)(column % 5));
+			button->setBounds(column * (buttonWidth + gap), row * (buttonHeight + gap), buttonWidth, buttonHeight);
+			container.addAndMakeVisible(button);
+		}
+	}
+}
+
+HoverSweep::Result HoverSweep::run(int numSweeps, bool scheduled)
+{
+	if (scheduled)
+	{
+		for (auto* button : buttons)
+			repaintScheduler.addControl(*button, [button] { return RepaintScheduler::getButtonVisualState(*button, (int)button->getRenderedState()); });
+	}
+
+	repaintScheduler.resetStats();
+
+	/** Paint the whole grid once so that the sweep starts from a settled state. */
+	container.repaint();
+	repaintScheduler.flush();
+	probe.paintDirtyRegion();
+	probe.resetCounters();
+
+	Result result;
+	const int numStateImagesRenderedBefore = getNumStateImagesRendered();
+
+	for (int sweep = 0; sweep < numSweeps; sweep++)
+	{
+		for (int row = 0; row < numRows; row++)
+		{
+			WaveformButton* hovered = nullptr;
+
+			for (int column = 0; column < numColumns; column++)
+			{
+				auto* next = buttons[row * numColumns + column];
+				moveHover(hovered, next, scheduled, result);
+				hovered = next;
+			}
+
+			moveHover(hovered, nullptr, scheduled, result);
+		}
+	}
+
+	result.numStateImagesRendered = getNumStateImagesRendered() - numStateImagesRenderedBefore;
+	result.numRepaintsExecuted = probe.getNumRequests();
+	result.numRepaintRequests = scheduled ? repaintScheduler.getStats().numRequested : probe.getNumRequests();
+
+	if (scheduled)
+	{
+		for (auto* button : buttons)
+			repaintScheduler.removeControl(*button);
+	}
+
+	return result;
+}
+
+void HoverSweep::moveHover(WaveformButton* from, WaveformButton* to, bool scheduled, Result& result)
+{
+	if (from != nullptr)
+	{
+		from->setState(juce::Button::buttonNormal);
+		result.numHoverChanges++;
+	}
+
+	if (to != nullptr)
+	{
+		to->setState(juce::Button::buttonOver);
+		result.numHoverChanges++;
+	}
+
+	/** End of the frame. */
+	if (scheduled)
+		repaintScheduler.flush();
+
+	if (probe.isDirty())
+	{
+		result.paintSeconds += probe.paintDirtyRegion();
+		result.numPaints++;
+	}
+}
+
+int HoverSweep::getNumStateImagesRendered() const
+{
+	int numRendered = 0;
+
+	for (auto* button : buttons)
+		numRendered += button->getNumStateImagesRendered();
+
+	return numRendered;
+}
+
+juce::String HoverSweep::createReport(const Result& direct, const Result& scheduled)
+{
+	auto formatRow = [](const juce::String& name, const Result& result)
+	{
+		return name.paddedRight(' ', 12)
+			+ juce::String(result.numHoverChanges).paddedLeft(' ', 10)
+			+ juce::String(result.numRepaintRequests).paddedLeft(' ', 12)
+			+ juce::String(result.numRepaintsExecuted).paddedLeft(' ', 12)
+			+ juce::String(result.numPaints).paddedLeft(' ', 10)
+			+ juce::String(result.paintSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			+ juce::String(result.numStateImagesRendered).paddedLeft(' ', 10)
+			+ juce::newLine;
+	};
+
+	juce::String report;
+	report << juce::String("Mode").paddedRight(' ', 12)
+		<< juce::String("Hovers").paddedLeft(' ', 10)
+		<< juce::String("Requested").paddedLeft(' ', 12)
+		<< juce::String("Executed").paddedLeft(' ', 12)
+		<< juce::String("Paints").paddedLeft(' ', 10)
+		<< juce::String("Paint ms").paddedLeft(' ', 12)
+		<< juce::String("Renders").paddedLeft(' ', 10)
+		<< juce::newLine
+		<< formatRow("Direct", direct)
+		<< formatRow("Scheduled", scheduled);
+
+	return report;
+}
@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    HoverSweep.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RepaintProbe.h"
+#include "../Components/WaveformButton.h"
+#include "../Rendering/RepaintScheduler.h"
+
+/**
+ * Sweeps the mouse across an offscreen grid of waveform buttons and measures
+ * how many repaints the hover changes cause and how long painting them takes.
+ *
+ * The mouse moves one button per frame. The grid is painted through a
+ * RepaintProbe on its container after every frame.
+ */
+class HoverSweep
+{
+public:
+	static constexpr int numColumns = 32;
+	static constexpr int numRows = 5;
+
+	/** Measurements of one sweep mode. */
+	struct Result
+	{
+		int numHoverChanges = 0;
+		/** repaint() calls made by the buttons. */
+		int numRepaintRequests = 0;
+		/** Repaints that reached the container. */
+		int numRepaintsExecuted = 0;
+		/** Frames that had anything to paint. */
+		int numPaints = 0;
+		double paintSeconds = 0.0;
+		/** State images rendered by the buttons during the sweep. */
+		int numStateImagesRendered = 0;
+	};
+
+	HoverSweep();
+
+	/**
+	 * Sweeps every row of the grid the given number of times.
+	 *
+	 * \param scheduled If true the buttons' repaints go through a RepaintScheduler, flushed once per frame.
+	 */
+	Result run(int numSweeps, bool scheduled);
+
+	/** Returns a table of both sweep modes. */
+	static juce::String createReport(const Result& direct, const Result& scheduled);
+
+private:
+	/** Moves the hover from one button to another (either can be nullptr) and paints the frame. */
+	void moveHover(WaveformButton* from, WaveformButton* to, bool scheduled, Result& result);
+
+	int getNumStateImagesRendered() const;
+
+	juce::Component container;
+	juce::OwnedArray<WaveformButton> buttons;
+	RepaintProbe& probe;
+	RepaintScheduler repaintScheduler;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HoverSweep)
+};
@@ -0,0 +1,187 @@
+/*
+  ==============================================================================
+
+    InputReplayDriver.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "InputReplayDriver.h"
+
+InputReplayDriver::InputReplayDriver()
+	: mixingConsoleFader("mixingConsoleFader"),
+	synthBipolarFader("synthBipolarFader")
+{
+	/** Match the setup of the sliders in MainComponent. */
+	mixingConsoleFader.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+	synthBipolarFader.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+
+	mixingConsoleFader.setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+	synthBipolarFader.setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+
+	mixingConsoleFader.setRange(0, 1, 0.01);
+	synthBipolarFader.setRange(-1, 1, 0.01);
+
+	probedSliders[(size_t)ControlType::mixingConsoleFader].slider = &mixingConsoleFader;
+	probedSliders[(size_t)ControlType::synthBipolarFader].slider = &synthBipolarFader;
+	probedSliders[(size_t)ControlType::gearKnob].slider = &gearKnob;
+
+	for (auto& probed : probedSliders)
+	{
+		if (probed.slider == nullptr)
+			continue;
+
+		/** Invisible components ignore repaint(), so the stand-ins must be visible (they are still offscreen). */
+		probed.slider->setVisible(true);
+		probed.slider->addListener(this);
+		probed.probe = &RepaintProbe::attachTo(*probed.slider);
+	}
+}
+
+InputReplayDriver::~InputReplayDriver()
+{
+	for (auto& probed : probedSliders)
+	{
+		if (probed.slider != nullptr)
+			probed.slider->removeListener(this);
+	}
+
+	mixingConsoleFader.setLookAndFeel(nullptr);
+	synthBipolarFader.setLookAndFeel(nullptr);
+}
+
+void InputReplayDriver::run(const juce::Array<InputTrace::Event>& events)
+{
+	for (const auto& event : events)
+		replayEvent(event);
+}
+
+InputReplayDriver::ProbedSlider* InputReplayDriver::getProbedSlider(ControlType controlType)
+{
+	auto& probed = probedSliders[(size_t)controlType];
+
+	return probed.slider != nullptr ? &probed : nullptr;
+}
+
+void InputReplayDriver::replayEvent(const InputTrace::Event& event)
+{
+	auto* probed = getProbedSlider(event.controlType);
+
+	if (probed == nullptr)
+		return;
+
+	auto& slider = *probed->slider;
+	auto& probe = *probed->probe;
+	auto& result = results[(size_t)event.controlType];
+
+	/** Resizes and their paints happen before the measurement. The faders are set up in the orientation of their size. */
+	if (event.controlType != ControlType::gearKnob)
+		slider.setSliderStyle(FaderOrientation::getSliderStyle(event.width, event.height));
+
+	slider.setBounds(0, 0, event.width, event.height);
+
+	for (int pass = 0; pass < 4 && probe.isDirty(); pass++)
+		probe.paintDirtyRegion();
+
+	const int requestsBefore = probe.getNumRequests();
+	const int requestsWhilePaintingBefore = probe.getNumRequestsWhilePainting();
+	const int paintsBefore = probe.getNumPaints();
+
+	const auto mouseEvent = createMouseEvent(slider, event);
+	valueChangeTicks = 0;
+
+	const auto startTicks = juce::Time::getHighResolutionTicks();
+
+	switch (event.kind)
+	{
+	case InputTrace::mouseDown:	slider.mouseDown(mouseEvent);	break;
+	case InputTrace::mouseDrag:	slider.mouseDrag(mouseEvent);	break;
+	case InputTrace::mouseUp:	slider.mouseUp(mouseEvent);		break;
+	default:					break;
+	}
+
+	const int requestsFromEvent = probe.getNumRequests() - requestsBefore;
+
+	if (probe.isDirty())
+	{
+		probe.paintDirtyRegion();
+		result.repaintLatency.add(juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks));
+	}
+
+	if (valueChangeTicks != 0)
+	{
+		result.numValueChanges++;
+		result.valueChangeLatency.add(juce::Time::highResolutionTicksToSeconds(valueChangeTicks - startTicks));
+	}
+
+	/** Repaints requested from inside paint() would be painted on the next frame. */
+	for (int pass = 0; pass < 4 && probe.isDirty(); pass++)
+		probe.paintDirtyRegion();
+
+	result.numEvents++;
+	result.numRepaintRequests += probe.getNumRequests() - requestsBefore;
+	result.numRepaintsRequestedWhilePainting += probe.getNumRequestsWhilePainting() - requestsWhilePaintingBefore;
+	result.numPaints += probe.getNumPaints() - paintsBefore;
+	result.numMergedRepaintRequests += juce::jmax(0, requestsFromEvent - 1);
+}
+
+juce::MouseEvent InputReplayDriver::createMouseEvent(juce::Slider& slider, const InputTrace::Event& event)
+{
+	const auto eventTime = juce::Time((juce::int64)(event.timeMicroseconds / 1000));
+
+	if (event.kind == InputTrace::mouseDown)
+	{
+		mouseDownPosition = event.position;
+		mouseDownTime = eventTime;
+	}
+
+	return juce::MouseEvent(juce::Desktop::getInstance().getMainMouseSource(),
+		event.position,
+		juce::ModifierKeys(juce::ModifierKeys::leftButtonModifier),
+		juce::MouseInputSource::defaultPressure,
+		juce::MouseInputSource::defaultOrientation,
+		juce::MouseInputSource::defaultRotation,
+		juce::MouseInputSource::defaultTiltX,
+		juce::MouseInputSource::defaultTiltY,
+		&slider,
+		&slider,
+		eventTime,
+		mouseDownPosition,
+		mouseDownTime,
+		1,
+		event.kind != InputTrace::mouseDown && event.position != mouseDownPosition);
+}
+
+void InputReplayDriver::sliderValueChanged(juce::Slider*)
+{
+	if (valueChangeTicks == 0)
+		valueChangeTicks = juce::Time::getHighResolutionTicks();
+}
+
+juce::String InputReplayDriver::createReport() const
+{
+	juce::String report;
+
+	for (int i = 0; i < numControlTypes; i++)
+	{
+		const auto& result = results[(size_t)i];
+
+		if (result.numEvents == 0)
+			continue;
+
+		report << getControlTypeName((ControlType)i) << juce::newLine
+			<< "  Events: " << result.numEvents
+			<< ", value changes: " << result.numValueChanges
+			<< ", repaint requests: " << result.numRepaintRequests
+			<< ", paints: " << result.numPaints << juce::newLine
+			<< "  Redundant repaints: " << result.numRepaintsRequestedWhilePainting << " requested from inside paint, "
+			<< result.numMergedRepaintRequests << " merged into the same frame" << juce::newLine
+			<< result.valueChangeLatency.toString("  Time to value change")
+			<< result.repaintLatency.toString("  Time to repaint completion")
+			<< juce::newLine;
+	}
+
+	return report;
+}
@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    InputReplayDriver.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "InputTrace.h"
+#include "LatencyHistogram.h"
+#include "RepaintProbe.h"
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+#include "../Components/RotaryKnob_GearShaped.h"
+
+/**
+ * Feeds recorded mouse events to offscreen knobs and faders and measures,
+ * per event, how long it takes until the value has changed and until the
+ * resulting repaint has been painted.
+ *
+ * No window is needed: the controls are never put on the desktop and their
+ * repaint requests are caught by a RepaintProbe and painted synchronously
+ * right after each event.
+ */
+class InputReplayDriver : private juce::Slider::Listener
+{
+public:
+	/** Measurements of one control type. */
+	struct Result
+	{
+		/** From dispatching the event to the value change notification. */
+		LatencyHistogram valueChangeLatency;
+		/** From dispatching the event to the end of the repaint it caused. */
+		LatencyHistogram repaintLatency;
+
+		int numEvents = 0;
+		int numValueChanges = 0;
+		int numRepaintRequests = 0;
+		int numPaints = 0;
+		/** Repaints requested while the control was painting itself (e.g. by setSliderStyle() or setRange()). */
+		int numRepaintsRequestedWhilePainting = 0;
+		/** Repaint requests beyond the first one of each event, which were merged into the same paint. */
+		int numMergedRepaintRequests = 0;
+	};
+
+	InputReplayDriver();
+	~InputReplayDriver() override;
+
+	/** Replays the events and accumulates the results. */
+	void run(const juce::Array<InputTrace::Event>& events);
+
+	/** Results of one control type. */
+	const Result& getResult(ControlType controlType) const { return results[(size_t)controlType]; }
+
+	/** Returns the counters and latency histograms of every control that received events. */
+	juce::String createReport() const;
+
+private:
+	/** A stand-in control and the probe watching its repaints. */
+	struct ProbedSlider
+	{
+		juce::Slider* slider = nullptr;
+		RepaintProbe* probe = nullptr;
+	};
+
+	/** Returns the stand-in for a control type, or nullptr if the type is not a slider. */
+	ProbedSlider* getProbedSlider(ControlType controlType);
+
+	/** Dispatches one event and measures what it caused. */
+	void replayEvent(const InputTrace::Event& event);
+
+	/** Creates the MouseEvent the control would have received. Mouse downs also update the drag start. */
+	juce::MouseEvent createMouseEvent(juce::Slider& slider, const InputTrace::Event& event);
+
+	/** Slider::Listener */
+	void sliderValueChanged(juce::Slider* slider) override;
+
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+
+	juce::Slider mixingConsoleFader;
+	juce::Slider synthBipolarFader;
+	RotaryKnob_GearShaped gearKnob;
+
+	std::array<ProbedSlider, numControlTypes> probedSliders;
+	std::array<Result, numControlTypes> results;
+
+	/** Position and time of the last mouse down, needed by the drag events. */
+	juce::Point<float> mouseDownPosition;
+	juce::Time mouseDownTime;
+
+	/** Ticks of the first value change caused by the event being replayed, or 0. */
+	juce::int64 valueChangeTicks = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InputReplayDriver)
+};
@@ -0,0 +1,240 @@
+/*
+  ==============================================================================
+
+    InputTrace.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "InputTrace.h"
+#include "../Components/RotaryKnob_GearShaped.h"
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+
+namespace
+{
+	/** Listens to the mouse events of every component and keeps those of the knobs and faders. */
+	class Recorder : public juce::MouseListener
+	{
+	public:
+		Recorder()
+		{
+			events.ensureStorageAllocated(4096);
+			startTicks = juce::Time::getHighResolutionTicks();
+			juce::Desktop::getInstance().addGlobalMouseListener(this);
+		}
+
+		~Recorder() override
+		{
+			juce::Desktop::getInstance().removeGlobalMouseListener(this);
+		}
+
+		void mouseDown(const juce::MouseEvent& e) override { add(e, InputTrace::mouseDown); }
+		void mouseDrag(const juce::MouseEvent& e) override { add(e, InputTrace::mouseDrag); }
+		void mouseUp(const juce::MouseEvent& e) override { add(e, InputTrace::mouseUp); }
+
+		juce::Array<InputTrace::Event> events;
+
+	private:
+		void add(const juce::MouseEvent& e, InputTrace::Kind kind)
+		{
+			if (e.eventComponent == nullptr)
+				return;
+
+			InputTrace::Event event;
+
+			if (!InputTrace::getSliderControlType(*e.eventComponent, event.controlType))
+				return;
+
+			event.kind = kind;
+			event.width = e.eventComponent->getWidth();
+			event.height = e.eventComponent->getHeight();
+			event.position = e.position;
+			event.timeMicroseconds = (juce::uint32)(1.0e6 * juce::Time::highResolutionTicksToSeconds(
+				juce::Time::getHighResolutionTicks() - startTicks));
+
+			events.add(event);
+		}
+
+		juce::int64 startTicks = 0;
+	};
+
+	std::unique_ptr<Recorder> recorder;
+	juce::Array<InputTrace::Event> lastRecording;
+}
+
+void InputTrace::startRecording()
+{
+	JUCE_ASSERT_MESSAGE_THREAD
+
+	lastRecording.clear();
+	recorder = std::make_unique<Recorder>();
+}
+
+void InputTrace::stopRecording()
+{
+	JUCE_ASSERT_MESSAGE_THREAD
+
+	if (recorder != nullptr)
+	{
+		lastRecording = std::move(recorder->events);
+		recorder.reset();
+	}
+}
+
+bool InputTrace::isRecording()
+{
+	return recorder != nullptr;
+}
+
+juce::Array<InputTrace::Event> InputTrace::getRecordedEvents()
+{
+	return recorder != nullptr ? recorder->events : lastRecording;
+}
+
+bool InputTrace::writeToFile(const juce::File& file)
+{
+	juce::FileOutputStream output(file);
+
+	if (!output.openedOk())
+		return false;
+
+	output.setPosition(0);
+	output.truncate();
+
+	return writeEvents(output, getRecordedEvents());
+}
+
+bool InputTrace::writeEvents(juce::OutputStream& output, const juce::Array<Event>& events)
+{
+	bool ok = output.writeInt(magic)
+		&& output.writeInt(formatVersion)
+		&& output.writeInt(events.size());
+
+	for (const auto& event : events)
+	{
+		ok = ok
+			&& output.writeByte((char)event.controlType)
+			&& output.writeByte((char)event.kind)
+			&& output.writeShort(0)
+			&& output.writeShort((short)event.width)
+			&& output.writeShort((short)event.height)
+			&& output.writeFloat(event.position.x)
+			&& output.writeFloat(event.position.y)
+			&& output.writeInt((int)event.timeMicroseconds);
+	}
+
+	output.flush();
+
+	return ok;
+}
+
+bool InputTrace::readFromFile(const juce::File& file, juce::Array<Event>& events)
+{
+	juce::FileInputStream input(file);
+
+	if (!input.openedOk())
+		return false;
+
+	return readEvents(input, events);
+}
+
+bool InputTrace::readEvents(juce::InputStream& input, juce::Array<Event>& events)
+{
+	events.clearQuick();
+
+	if (input.readInt() != magic || input.readInt() != formatVersion)
+		return false;
+
+	const int numEvents = input.readInt();
+
+	const auto bytesLeft = input.getNumBytesRemaining();
+	if (numEvents < 0 || (bytesLeft >= 0 && bytesLeft < (juce::int64)numEvents * bytesPerEvent))
+		return false;
+
+	events.ensureStorageAllocated(numEvents);
+
+	for (int i = 0; i < numEvents; i++)
+	{
+		Event event;
+
+		const auto controlType = (juce::uint8)input.readByte();
+		const auto kind = (juce::uint8)input.readByte();
+		if (controlType >= numControlTypes || kind > mouseUp)
+			return false;
+
+		event.controlType = (ControlType)controlType;
+		event.kind = (Kind)kind;
+		input.readShort();	// Padding
+		event.width = input.readShort();
+		event.height = input.readShort();
+		event.position.x = input.readFloat();
+		event.position.y = input.readFloat();
+		event.timeMicroseconds = (juce::uint32)input.readInt();
+
+		events.add(event);
+	}
+
+	return true;
+}
+
+bool InputTrace::getSliderControlType(const juce::Component& component, ControlType& controlType)
+{
+	if (dynamic_cast<const RotaryKnob_GearShaped*>(&component) != nullptr)
+	{
+		controlType = ControlType::gearKnob;
+		return true;
+	}
+
+	if (auto* slider = dynamic_cast<const juce::Slider*>(&component))
+	{
+		auto& lookAndFeel = slider->getLookAndFeel();
+
+		if (dynamic_cast<Slider_MixingConsoleStyle_LookAndFeel*>(&lookAndFeel) != nullptr)
+		{
+			controlType = ControlType::mixingConsoleFader;
+			return true;
+		}
+
+		if (dynamic_cast<Slider_SynthBipolar_LookAndFeel*>(&lookAndFeel) != nullptr)
+		{
+			controlType = ControlType::synthBipolarFader;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+juce::Array<InputTrace::Event> InputTrace::createDragSweep(ControlType controlType, int width, int height,
+	juce::Point<float> distance, int numberOfDrags, double eventsPerSecond)
+{
+	juce::Array<Event> events;
+	events.ensureStorageAllocated(numberOfDrags + 2);
+
+	const juce::Point<float> start(width / 2.f, height / 2.f);
+	const double microsecondsPerEvent = 1.0e6 / eventsPerSecond;
+
+	auto add = [&](Kind kind, juce::Point<float> position, int index)
+	{
+		Event event;
+		event.controlType = controlType;
+		event.kind = kind;
+		event.width = width;
+		event.height = height;
+		event.position = position;
+		event.timeMicroseconds = (juce::uint32)(index * microsecondsPerEvent);
+		events.add(event);
+	};
+
+	add(mouseDown, start, 0);
+
+	for (int i = 1; i <= numberOfDrags; i++)
+		add(mouseDrag, start + distance * ((float)i / (float)numberOfDrags), i);
+
+	add(mouseUp, start + distance, numberOfDrags + 1);
+
+	return events;
+}
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    InputTrace.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Components/ControlType.h"
+
+/**
+ * Records the mouse down/drag/up events that reach the knob and the faders,
+ * so that the drags of a real session can be replayed by InputReplayDriver.
+ *
+ * The binary file has the same layout idea as PaintTrace:
+ *
+ *  - Header: magic "ITRC", format version, number of events (int32 each).
+ *  - Events: 20 bytes each (see Event), little-endian.
+ */
+class InputTrace
+{
+public:
+	/** The kind of mouse event. */
+	enum Kind : juce::uint8
+	{
+		mouseDown,
+		mouseDrag,
+		mouseUp
+	};
+
+	/** A single recorded mouse event. */
+	struct Event
+	{
+		/** The control that received the event. */
+		ControlType controlType = ControlType::gearKnob;
+		Kind kind = mouseDown;
+		/** Size of the control when the event happened. */
+		int width = 0;
+		int height = 0;
+		/** Mouse position relative to the control. */
+		juce::Point<float> position;
+		/** Microseconds since the recording was started. */
+		juce::uint32 timeMicroseconds = 0;
+	};
+
+	/** Size of one event in the binary file. */
+	static constexpr int bytesPerEvent = 20;
+
+	/** Starts recording the mouse events of all knobs and faders in the app. */
+	static void startRecording();
+
+	/** Stops recording. The recorded events are kept until the next startRecording(). */
+	static void stopRecording();
+
+	/** True while recording. */
+	static bool isRecording();
+
+	/** Returns a copy of the events recorded so far. */
+	static juce::Array<Event> getRecordedEvents();
+
+	/** Writes the recorded events to a file, replacing it. */
+	static bool writeToFile(const juce::File& file);
+
+	/** Writes events in the binary trace format. */
+	static bool writeEvents(juce::OutputStream& output, const juce::Array<Event>& events);
+
+	/** Reads a trace file. Returns false if the file is missing or not a valid trace. */
+	static bool readFromFile(const juce::File& file, juce::Array<Event>& events);
+
+	/** Reads events in the binary trace format. */
+	static bool readEvents(juce::InputStream& input, juce::Array<Event>& events);
+
+	/**
+	 * Finds out which of the custom sliders a component is.
+	 *
+	 * \return False if the component is not one of the knobs or faders.
+	 */
+	static bool getSliderControlType(const juce::Component& component, ControlType& controlType);
+
+	/**
+	 * Creates a synthetic drag: a mouse down in the middle of the control,
+	 * numberOfDrags drag events spread over the given distance, and a mouse up.
+	 * Events are spaced at the given rate, like a high-rate mouse would deliver them.
+	 */
+	static juce::Array<Event> createDragSweep(ControlType controlType, int width, int height,
+		juce::Point<float> distance, int numberOfDrags, double eventsPerSecond);
+
+private:
+	static constexpr int magic = 0x43525449;	// "ITRC"
+	static constexpr int formatVersion = 1;
+};
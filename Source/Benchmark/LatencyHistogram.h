@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    LatencyHistogram.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Histogram of latencies with power-of-two microsecond buckets
+ * (< 1us, 1-2us, 2-4us ... and a final overflow bucket).
+ */
+class LatencyHistogram
+{
+public:
+	static constexpr int numBuckets = 20;
+
+	/** Adds a latency, in seconds. */
+	void add(double seconds)
+	{
+		const double microseconds = seconds * 1.0e6;
+
+		int bucket = 0;
+		while (bucket < numBuckets - 1 && microseconds >= (double)(1 << bucket))
+			bucket++;
+
+		counts[(size_t)bucket]++;
+		numSamples++;
+		totalSeconds += seconds;
+		maxSeconds = juce::jmax(maxSeconds, seconds);
+	}
+
+	int getNumSamples() const { return numSamples; }
+	double getMeanSeconds() const { return numSamples > 0 ? totalSeconds / numSamples : 0.0; }
+	double getMaxSeconds() const { return maxSeconds; }
+
+	/** Returns an approximate percentile (0 to 100), in seconds, from the bucket boundaries. */
+	double getPercentileSeconds(double percentile) const
+	{
+		const auto target = (int)std::ceil(numSamples * percentile / 100.0);
+		int seen = 0;
+
+		for (int bucket = 0; bucket < numBuckets; bucket++)
+		{
+			seen += counts[(size_t)bucket];
+
+			if (seen >= target && seen > 0)
+				return juce::jmin(maxSeconds, (double)(1 << bucket) * 1.0e-6);
+		}
+
+		return maxSeconds;
+	}
+
+	/** Returns the histogram as text, one line per non-empty bucket. */
+	juce::String toString(const juce::String& title) const
+	{
+		juce::String text;
+		text << title << ": " << numSamples << " samples, mean "
+			<< juce::String(getMeanSeconds() * 1.0e6, 1) << " us, p99 "
+			<< juce::String(getPercentileSeconds(99.0) * 1.0e6, 1) << " us, max "
+			<< juce::String(maxSeconds * 1.0e6, 1) << " us" << juce::newLine;
+
+		const int largestCount = *std::max_element(counts.begin(), counts.end());
+
+		for (int bucket = 0; bucket < numBuckets; bucket++)
+		{
+			if (counts[(size_t)bucket] == 0)
+				continue;
+
+			const juce::String lower = bucket == 0 ? juce::String("0") : juce::String(1 << (bucket - 1));
+			const juce::String upper = bucket == numBuckets - 1 ? juce::String("inf") : juce::String(1 << bucket);
+			const int barLength = juce::roundToInt(40.0 * counts[(size_t)bucket] / juce::jmax(1, largestCount));
+
+			text << ("  " + lower + "-" + upper + " us").paddedRight(' ', 22)
+				<< juce::String(counts[(size_t)bucket]).paddedLeft(' ', 8) << " "
+				<< juce::String::repeatedString("#", juce::jmax(1, barLength)) << juce::newLine;
+		}
+
+		return text;
+	}
+
+private:
+	std::array<int, numBuckets> counts {};
+	int numSamples = 0;
+	double totalSeconds = 0.0;
+	double maxSeconds = 0.0;
+};
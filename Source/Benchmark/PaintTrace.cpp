@@ -0,0 +1,175 @@
+/*
+  ==============================================================================
+
+    PaintTrace.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "PaintTrace.h"
+
+std::atomic<bool> PaintTrace::recording { false };
+
+namespace
+{
+	/** The events recorded in this process. */
+	struct Recording
+	{
+		juce::CriticalSection lock;
+		juce::Array<PaintTrace::Event> events;
+		juce::int64 startTicks = 0;
+	};
+
+	Recording& getRecording()
+	{
+		static Recording instance;
+		return instance;
+	}
+}
+
+void PaintTrace::startRecording()
+{
+	auto& rec = getRecording();
+	const juce::ScopedLock sl(rec.lock);
+
+	rec.events.clearQuick();
+	rec.events.ensureStorageAllocated(4096);
+	rec.startTicks = juce::Time::getHighResolutionTicks();
+
+	recording = true;
+}
+
+void PaintTrace::stopRecording()
+{
+	recording = false;
+}
+
+juce::Array<PaintTrace::Event> PaintTrace::getRecordedEvents()
+{
+	auto& rec = getRecording();
+	const juce::ScopedLock sl(rec.lock);
+
+	return rec.events;
+}
+
+void PaintTrace::record(ControlType controlType, juce::Graphics& g, juce::Component& component,
+	float value, juce::uint8 flags, juce::uint8 variant)
+{
+	Event event;
+	event.controlType = controlType;
+	event.flags = flags;
+	event.variant = variant;
+	event.scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+	event.value = value;
+
+	/** Store the bounds relative to the top level component so that the layout can be reconstructed. */
+	if (auto* topLevel = component.getTopLevelComponent(); topLevel != nullptr && topLevel != &component)
+		event.bounds = topLevel->getLocalArea(&component, component.getLocalBounds());
+	else
+		event.bounds = component.getLocalBounds();
+
+	auto& rec = getRecording();
+	const juce::ScopedLock sl(rec.lock);
+
+	event.timeMicroseconds = (juce::uint32)(1.0e6 * juce::Time::highResolutionTicksToSeconds(
+		juce::Time::getHighResolutionTicks() - rec.startTicks));
+
+	rec.events.add(event);
+}
+
+bool PaintTrace::writeToFile(const juce::File& file)
+{
+	juce::FileOutputStream output(file);
+
+	if (!output.openedOk())
+		return false;
+
+	output.setPosition(0);
+	output.truncate();
+
+	return writeEvents(output, getRecordedEvents());
+}
+
+bool PaintTrace::writeEvents(juce::OutputStream& output, const juce::Array<Event>& events)
+{
+	bool ok = output.writeInt(magic)
+		&& output.writeInt(formatVersion)
+		&& output.writeInt(events.size());
+
+	for (const auto& event : events)
+	{
+		ok = ok
+			&& output.writeByte((char)event.controlType)
+			&& output.writeByte((char)event.flags)
+			&& output.writeByte((char)event.variant)
+			&& output.writeByte(0)
+			&& output.writeShort((short)event.bounds.getX())
+			&& output.writeShort((short)event.bounds.getY())
+			&& output.writeShort((short)event.bounds.getWidth())
+			&& output.writeShort((short)event.bounds.getHeight())
+			&& output.writeFloat(event.scale)
+			&& output.writeFloat(event.value)
+			&& output.writeInt((int)event.timeMicroseconds);
+	}
+
+	output.flush();
+
+	return ok;
+}
+
+bool PaintTrace::readFromFile(const juce::File& file, juce::Array<Event>& events)
+{
+	juce::FileInputStream input(file);
+
+	if (!input.openedOk())
+		return false;
+
+	return readEvents(input, events);
+}
+
+bool PaintTrace::readEvents(juce::InputStream& input, juce::Array<Event>& events)
+{
+	events.clearQuick();
+
+	if (input.readInt() != magic || input.readInt() != formatVersion)
+		return false;
+
+	const int numEvents = input.readInt();
+
+	/** Reject truncated files before allocating anything. */
+	const auto bytesLeft = input.getNumBytesRemaining();
+	if (numEvents < 0 || (bytesLeft >= 0 && bytesLeft < (juce::int64)numEvents * bytesPerEvent))
+		return false;
+
+	events.ensureStorageAllocated(numEvents);
+
+	for (int i = 0; i < numEvents; i++)
+	{
+		Event event;
+
+		const auto controlType = (juce::uint8)input.readByte();
+		if (controlType >= numControlTypes)
+			return false;
+
+		event.controlType = (ControlType)controlType;
+		event.flags = (juce::uint8)input.readByte();
+		event.variant = (juce::uint8)input.readByte();
+		input.readByte();	// Padding
+
+		const int x = input.readShort();
+		const int y = input.readShort();
+		const int width = input.readShort();
+		const int height = input.readShort();
+		event.bounds = juce::Rectangle<int>(x, y, width, height);
+
+		event.scale = input.readFloat();
+		event.value = input.readFloat();
+		event.timeMicroseconds = (juce::uint32)input.readInt();
+
+		events.add(event);
+	}
+
+	return true;
+}
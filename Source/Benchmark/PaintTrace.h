@@ -0,0 +1,119 @@
+/*
+  ==============================================================================
+
+    PaintTrace.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Components/ControlType.h"
+
+/**
+ * Records the paints of the custom controls during a real run of the app,
+ * together with everything needed to repeat them offline.
+ *
+ * Recording is off by default and costs a single relaxed atomic load per paint.
+ * The recording is written to a compact binary file:
+ *
+ *  - Header: magic "PTRC", format version, number of events (int32 each).
+ *  - Events: 24 bytes each (see Event), little-endian.
+ */
+class PaintTrace
+{
+public:
+	/** State flags stored with each paint. */
+	enum Flags : juce::uint8
+	{
+		highlighted = 1 << 0,
+		down = 1 << 1,
+		toggled = 1 << 2
+	};
+
+	/** A single recorded paint. */
+	struct Event
+	{
+		/** The control that was painted. */
+		ControlType controlType = ControlType::mixingConsoleFader;
+		/** Combination of Flags. */
+		juce::uint8 flags = 0;
+		/** Type specific detail (the waveform of a waveform button, the selected segment of a waveform selector). */
+		juce::uint8 variant = 0;
+		/** Bounds of the control, relative to its top level component. */
+		juce::Rectangle<int> bounds;
+		/** Physical pixel scale of the graphics context. */
+		float scale = 1.f;
+		/** Slider value as a proportion of its length (0 to 1), or the hovered segment of a waveform selector. Unused for buttons. */
+		float value = 0.f;
+		/** Microseconds since the recording was started. */
+		juce::uint32 timeMicroseconds = 0;
+	};
+
+	/** Size of one event in the binary file. */
+	static constexpr int bytesPerEvent = 24;
+
+	/** Clears any previous recording and starts a new one. */
+	static void startRecording();
+
+	/** Stops recording. The recorded events are kept until the next startRecording(). */
+	static void stopRecording();
+
+	/** True while recording. */
+	static bool isRecording() noexcept { return recording.load(std::memory_order_relaxed); }
+
+	/** Records a paint of a slider based control. Does nothing unless recording. */
+	static void recordSlider(ControlType controlType, juce::Graphics& g, juce::Slider& slider)
+	{
+		if (isRecording())
+			record(controlType, g, slider, (float)slider.valueToProportionOfLength(slider.getValue()),
+				slider.isMouseOverOrDragging() ? highlighted : 0, 0);
+	}
+
+	/** Records a paint of a button based control. Does nothing unless recording. */
+	static void recordButton(ControlType controlType, juce::Graphics& g, juce::Button& button,
+		int variant, bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown)
+	{
+		if (isRecording())
+			record(controlType, g, button, 0.f,
+				(juce::uint8)((shouldDrawButtonAsHighlighted ? highlighted : 0)
+					| (shouldDrawButtonAsDown ? down : 0)
+					| (button.getToggleState() ? toggled : 0)),
+				(juce::uint8)variant);
+	}
+
+	/** Records a paint of any other control. Does nothing unless recording. */
+	static void recordComponent(ControlType controlType, juce::Graphics& g, juce::Component& component,
+		float value, int variant, bool shouldDrawAsHighlighted)
+	{
+		if (isRecording())
+			record(controlType, g, component, value, shouldDrawAsHighlighted ? highlighted : 0, (juce::uint8)variant);
+	}
+
+	/** Returns a copy of the events recorded so far. */
+	static juce::Array<Event> getRecordedEvents();
+
+	/** Writes the recorded events to a file, replacing it. */
+	static bool writeToFile(const juce::File& file);
+
+	/** Writes events in the binary trace format. */
+	static bool writeEvents(juce::OutputStream& output, const juce::Array<Event>& events);
+
+	/** Reads a trace file. Returns false if the file is missing or not a valid trace. */
+	static bool readFromFile(const juce::File& file, juce::Array<Event>& events);
+
+	/** Reads events in the binary trace format. */
+	static bool readEvents(juce::InputStream& input, juce::Array<Event>& events);
+
+private:
+	static void record(ControlType controlType, juce::Graphics& g, juce::Component& component,
+		float value, juce::uint8 flags, juce::uint8 variant);
+
+	static std::atomic<bool> recording;
+
+	static constexpr int magic = 0x43525450;	// "PTRC"
+	static constexpr int formatVersion = 1;
+};
@@ -0,0 +1,220 @@
+/*
+  ==============================================================================
+
+    PaintTraceReplay.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "PaintTraceReplay.h"
+
+PaintTraceReplay::PaintTraceReplay()
+	: mixingConsoleFader("mixingConsoleFader"),
+	synthBipolarFader("synthBipolarFader")
+{
+	/** Match the setup of the sliders in MainComponent. */
+	mixingConsoleFader.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+	synthBipolarFader.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+
+	mixingConsoleFader.setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+	synthBipolarFader.setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+
+	mixingConsoleFader.setRange(0, 1, 0.01);
+	synthBipolarFader.setRange(-1, 1, 0.01);
+}
+
+PaintTraceReplay::~PaintTraceReplay()
+{
+	mixingConsoleFader.setLookAndFeel(nullptr);
+	synthBipolarFader.setLookAndFeel(nullptr);
+}
+
+void PaintTraceReplay::run(const juce::Array<PaintTrace::Event>& events, int numIterations)
+{
+	for (int iteration = 0; iteration < numIterations; iteration++)
+	{
+		for (const auto& event : events)
+		{
+			const double seconds = paintEvent(event);
+
+			results[(size_t)event.controlType].add(seconds);
+			tierResults[(size_t)event.controlType][(size_t)getLevelOfDetailTier(event.controlType)].add(seconds);
+		}
+	}
+}
+
+double PaintTraceReplay::paintEvent(const PaintTrace::Event& event)
+{
+	auto& control = prepareControl(event);
+
+	const int canvasWidth = juce::jmax(1, juce::roundToInt(event.bounds.getWidth() * event.scale));
+	const int canvasHeight = juce::jmax(1, juce::roundToInt(event.bounds.getHeight() * event.scale));
+
+	if (canvas.getWidth() != canvasWidth || canvas.getHeight() != canvasHeight)
+		canvas = juce::Image(juce::Image::ARGB, canvasWidth, canvasHeight, true);
+	else
+		canvas.clear(canvas.getBounds());
+
+	juce::Graphics g(canvas);
+	g.addTransform(juce::AffineTransform::scale(event.scale));
+
+	const auto startTicks = juce::Time::getHighResolutionTicks();
+	control.paintEntireComponent(g, true);
+	const auto endTicks = juce::Time::getHighResolutionTicks();
+
+	return juce::Time::highResolutionTicksToSeconds(endTicks - startTicks);
+}
+
+void PaintTraceReplay::reset()
+{
+	for (auto& result : results)
+		result = Result();
+
+	for (auto& controlTierResults : tierResults)
+		for (auto& result : controlTierResults)
+			result = Result();
+
+	renderCache->resetStats();
+}
+
+PaintTraceReplay::Result PaintTraceReplay::getTotal() const
+{
+	Result total;
+
+	for (const auto& result : results)
+	{
+		total.numPaints += result.numPaints;
+		total.totalSeconds += result.totalSeconds;
+		total.maxSeconds = juce::jmax(total.maxSeconds, result.maxSeconds);
+	}
+
+	return total;
+}
+
+juce::String PaintTraceReplay::createReport() const
+{
+	auto formatRow = [](const juce::String& name, const Result& result)
+	{
+		return name.paddedRight(' ', 24)
+			+ juce::String(result.numPaints).paddedLeft(' ', 10)
+			+ juce::String(result.totalSeconds * 1.0e3, 2).paddedLeft(' ', 12)
+			+ juce::String(result.getMeanSeconds() * 1.0e6, 1).paddedLeft(' ', 12)
+			+ juce::String(result.maxSeconds * 1.0e6, 1).paddedLeft(' ', 12)
+			+ juce::newLine;
+	};
+
+	juce::String report;
+	report << juce::String("Control").paddedRight(' ', 24)
+		<< juce::String("Paints").paddedLeft(' ', 10)
+		<< juce::String("Total ms").paddedLeft(' ', 12)
+		<< juce::String("Mean us").paddedLeft(' ', 12)
+		<< juce::String("Max us").paddedLeft(' ', 12)
+		<< juce::newLine;
+
+	for (int i = 0; i < numControlTypes; i++)
+	{
+		if (results[(size_t)i].numPaints > 0)
+			report << formatRow(getControlTypeName((ControlType)i), results[(size_t)i]);
+	}
+
+	report << formatRow("Total", getTotal());
+
+	report << juce::newLine << "By level of detail" << juce::newLine;
+
+	for (int i = 0; i < numControlTypes; i++)
+	{
+		for (int tier = 0; tier < LevelOfDetail::numTiers; tier++)
+		{
+			const auto& result = tierResults[(size_t)i][(size_t)tier];
+
+			if (result.numPaints > 0)
+				report << formatRow(juce::String(getControlTypeName((ControlType)i)) + " / "
+					+ LevelOfDetail::getTierName((LevelOfDetail::Tier)tier), result);
+		}
+	}
+
+	report << juce::newLine << renderCache->getStats().toString() << juce::newLine;
+
+	return report;
+}
+
+juce::Component& PaintTraceReplay::getControl(ControlType controlType)
+{
+	switch (controlType)
+	{
+	case ControlType::mixingConsoleFader:	return mixingConsoleFader;
+	case ControlType::synthBipolarFader:	return synthBipolarFader;
+	case ControlType::gearKnob:				return gearKnob;
+	case ControlType::waveformButton:		return waveformButton;
+	case ControlType::waveformSelector:		return waveformSelector;
+	default:								break;
+	}
+
+	jassertfalse;
+	return mixingConsoleFader;
+}
+
+LevelOfDetail::Tier PaintTraceReplay::getLevelOfDetailTier(ControlType controlType)
+{
+	switch (controlType)
+	{
+	case ControlType::mixingConsoleFader:
+		return slider_MixingConsoleStyle_LookAndFeel.getLevelOfDetailTier(mixingConsoleFader);
+	case ControlType::synthBipolarFader:
+		return slider_SynthBipolar_LookAndFeel.getLevelOfDetailTier(synthBipolarFader);
+	case ControlType::gearKnob:
+		if (auto* lookAndFeel = dynamic_cast<RotaryKnob_GearShaped_LookAndFeel*>(&gearKnob.getLookAndFeel()))
+			return lookAndFeel->getLevelOfDetailTier(gearKnob);
+		break;
+	case ControlType::waveformButton:
+		if (auto* lookAndFeel = dynamic_cast<WaveformButton_LookAndFeel*>(&waveformButton.getLookAndFeel()))
+			return lookAndFeel->getLevelOfDetailTier(waveformButton);
+		break;
+	default:
+		break;
+	}
+
+	return LevelOfDetail::medium;
+}
+
+juce::Component& PaintTraceReplay::prepareControl(const PaintTrace::Event& event)
+{
+	auto& control = getControl(event.controlType);
+
+	/** The faders were recorded in the orientation of their size. */
+	if (event.controlType == ControlType::mixingConsoleFader || event.controlType == ControlType::synthBipolarFader)
+	{
+		if (auto* slider = dynamic_cast<juce::Slider*>(&control))
+			slider->setSliderStyle(FaderOrientation::getSliderStyle(event.bounds.getWidth(), event.bounds.getHeight()));
+	}
+
+	/** setBounds() does nothing when the size hasn't changed, so layouts only happen on real size changes. */
+	control.setBounds(event.bounds.withZeroOrigin());
+
+	if (auto* slider = dynamic_cast<juce::Slider*>(&control))
+	{
+		slider->setValue(slider->proportionOfLengthToValue(juce::jlimit(0.0, 1.0, (double)event.value)),
+			juce::dontSendNotification);
+	}
+	else if (event.controlType == ControlType::waveformButton)
+	{
+		waveformButton.setWaveform((WaveformButton_LookAndFeel::Waveform)juce::jlimit(0, 4, (int)event.variant));
+		waveformButton.setToggleState((event.flags & PaintTrace::toggled) != 0, juce::dontSendNotification);
+
+		if ((event.flags & PaintTrace::down) != 0)
+			waveformButton.setState(juce::Button::buttonDown);
+		else if ((event.flags & PaintTrace::highlighted) != 0)
+			waveformButton.setState(juce::Button::buttonOver);
+		else
+			waveformButton.setState(juce::Button::buttonNormal);
+	}
+	else if (event.controlType == ControlType::waveformSelector)
+	{
+		waveformSelector.setSelectedIndex((int)event.variant, juce::dontSendNotification);
+		waveformSelector.setHoveredIndex(juce::roundToInt(event.value));
+	}
+
+	return control;
+}
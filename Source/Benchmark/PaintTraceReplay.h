@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    PaintTraceReplay.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PaintTrace.h"
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+#include "../Components/RotaryKnob_GearShaped.h"
+#include "../Components/WaveformButton.h"
+#include "../Components/WaveformSelector.h"
+#include "../Rendering/LevelOfDetail.h"
+#include "../Rendering/RenderCache.h"
+
+/**
+ * Replays a recorded paint trace headlessly.
+ * Every event is painted by an offscreen stand-in control that uses the same
+ * LookAndFeel as the original, into a software image at the recorded scale.
+ * Only the paint itself is timed.
+ */
+class PaintTraceReplay
+{
+public:
+	/** Timing of the paints of one control type. */
+	struct Result
+	{
+		int numPaints = 0;
+		double totalSeconds = 0.0;
+		double maxSeconds = 0.0;
+
+		void add(double seconds)
+		{
+			numPaints++;
+			totalSeconds += seconds;
+			maxSeconds = juce::jmax(maxSeconds, seconds);
+		}
+
+		double getMeanSeconds() const { return numPaints > 0 ? totalSeconds / numPaints : 0.0; }
+	};
+
+	PaintTraceReplay();
+	~PaintTraceReplay();
+
+	/** Replays all events the given number of times, accumulating the results. */
+	void run(const juce::Array<PaintTrace::Event>& events, int numIterations);
+
+	/** Paints a single event and returns the time it took, in seconds. */
+	double paintEvent(const PaintTrace::Event& event);
+
+	/** Clears the accumulated results and the render cache counters. */
+	void reset();
+
+	/** Results of one control type. */
+	const Result& getResult(ControlType controlType) const { return results[(size_t)controlType]; }
+
+	/** Results of one control type, drawn at one level of detail. */
+	const Result& getResult(ControlType controlType, LevelOfDetail::Tier tier) const { return tierResults[(size_t)controlType][(size_t)tier]; }
+
+	/** Results of all control types combined. */
+	Result getTotal() const;
+
+	/** Returns a table of the total, per-control and per-level of detail timings, followed by the render cache counters. */
+	juce::String createReport() const;
+
+	/** Returns the stand-in control used for a control type. */
+	juce::Component& getControl(ControlType controlType);
+
+	/** Returns the level of detail the stand-in control of a control type is drawn at, at its current size. */
+	LevelOfDetail::Tier getLevelOfDetailTier(ControlType controlType);
+
+private:
+	/** Sets the stand-in control up to match an event. */
+	juce::Component& prepareControl(const PaintTrace::Event& event);
+
+	/** LookAndFeels of the stand-in sliders (the knob and button own theirs). */
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+
+	/** Stand-in controls. */
+	juce::Slider mixingConsoleFader;
+	juce::Slider synthBipolarFader;
+	RotaryKnob_GearShaped gearKnob;
+	WaveformButton waveformButton = WaveformButton(juce::String("waveformButton"));
+	WaveformSelector waveformSelector;
+
+	/** The cache the LookAndFeels share, for its counters. */
+	juce::SharedResourcePointer<RenderCache> renderCache;
+
+	/** The image everything is painted into. Reused while the size stays the same. */
+	juce::Image canvas;
+
+	std::array<Result, numControlTypes> results;
+	std::array<std::array<Result, LevelOfDetail::numTiers>, numControlTypes> tierResults;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PaintTraceReplay)
+};
@@ -0,0 +1,204 @@
+/*
+  ==============================================================================
+
+    PresetLoad.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "PresetLoad.h"
+#include "../Components/ParameterTransaction.h"
+
+PresetLoad::PresetLoad()
+	: probe(RepaintProbe::attachTo(editor)),
+	repaintScheduler(editor)
+{
+	/** Control sizes MainComponent uses (faders with a text box below, knobs, buttons), in rows. */
+	constexpr int faderWidth = 50;
+	constexpr int faderHeight = 200;
+	constexpr int knobSize = 80;
+	constexpr int buttonWidth = 30;
+	constexpr int buttonHeight = 20;
+	constexpr int controlsPerRow = 32;
+
+	editor.setSize(controlsPerRow * faderWidth, 2 * faderHeight + knobSize * 5 / 4 + buttonHeight);
+	editor.setVisible(true);
+
+	for (int i = 0; i < numFaders; i++)
+	{
+		auto* fader = sliders.add(new juce::Slider("presetLoadFader"));
+		fader->setSliderStyle(juce::Slider::LinearVertical);
+		fader->setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+
+		if (i < numFaders / 2)
+		{
+			fader->setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+			fader->setRange(0, 1, 0.01);
+		}
+		else
+		{
+			fader->setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+			fader->setRange(-1, 1, 0.01);
+		}
+
+		fader->setBounds((i % controlsPerRow) * faderWidth, (i / controlsPerRow) * faderHeight, faderWidth, faderHeight);
+		editor.addAndMakeVisible(fader);
+	}
+
+	for (int i = 0; i < numKnobs; i++)
+	{
+		auto* knob = sliders.add(new RotaryKnob_GearShaped());
+		knob->setBounds(i * faderWidth, 2 * faderHeight, knobSize * 5 / 8, knobSize * 5 / 4);
+		editor.addAndMakeVisible(knob);
+	}
+
+	for (int i = 0; i < numButtons; i++)
+	{
+		auto* button = buttons.add(new WaveformButton("presetLoadButton"));
+		button->setWaveform((WaveformButton_LookAndFeel::Waveform)(i % 5));
+		button->setBounds(i * faderWidth, editor.getHeight() - buttonHeight, buttonWidth, buttonHeight);
+		editor.addAndMakeVisible(button);
+	}
+
+	for (auto* slider : sliders)
+	{
+		slider->addListener(this);
+		repaintScheduler.addControl(*slider, [slider] { return RepaintScheduler::getSliderVisualState(*slider); });
+	}
+
+	for (auto* button : buttons)
+	{
+		button->addListener(this);
+		repaintScheduler.addControl(*button, [button] { return RepaintScheduler::getButtonVisualState(*button, (int)button->getRenderedState()); });
+	}
+}
+
+PresetLoad::~PresetLoad()
+{
+	for (auto* slider : sliders)
+	{
+		slider->removeListener(this);
+		repaintScheduler.removeControl(*slider);
+	}
+
+	for (auto* button : buttons)
+	{
+		button->removeListener(this);
+		repaintScheduler.removeControl(*button);
+	}
+
+	for (int i = 0; i < numFaders; i++)
+		sliders[i]->setLookAndFeel(nullptr);
+}
+
+PresetLoad::Result PresetLoad::run(int numLoads, bool inTransaction)
+{
+	/** Paint the editor once so that the loads start from a settled state. */
+	editor.repaint();
+	repaintScheduler.flush();
+	probe.paintDirtyRegion();
+
+	repaintScheduler.resetStats();
+	probe.resetCounters();
+	numNotifications = 0;
+
+	Result result;
+
+	for (int load = 0; load < numLoads; load++)
+	{
+		applyPreset(load, inTransaction, result);
+
+		/** The vblank after the load. */
+		repaintScheduler.flush();
+		result.paintSeconds += probe.paintDirtyRegion();
+		result.numLoads++;
+	}
+
+	result.numNotifications = numNotifications;
+	result.numRepaintRequests = repaintScheduler.getStats().numRequested;
+	result.numRepaintsExecuted = probe.getNumRequests();
+
+	return result;
+}
+
+void PresetLoad::applyPreset(int presetIndex, bool inTransaction, Result& result)
+{
+	/**
+	 * The changes cycle through the controls, so each is set several times per preset,
+	 * like a preset load followed by macro mappings and host parameter echoes.
+	 */
+	const int numControls = sliders.size() + buttons.size();
+
+	auto getProportion = [presetIndex](int change) { return (float)((change * 37 + presetIndex * 101) % 1000) / 999.f; };
+	auto getToggleState = [presetIndex, numControls](int change) { return ((change / numControls + presetIndex) % 2) == 1; };
+
+	const auto startTicks = juce::Time::getHighResolutionTicks();
+
+	if (inTransaction)
+	{
+		ParameterTransaction transaction(&repaintScheduler);
+		transaction.onCommit = [this](const ParameterTransaction&) { numNotifications++; };
+
+		for (int change = 0; change < numChanges; change++)
+		{
+			const int index = change % numControls;
+
+			if (index < sliders.size())
+				transaction.setValue(*sliders[index], sliders[index]->proportionOfLengthToValue(getProportion(change)));
+			else
+				transaction.setToggleState(*buttons[index - sliders.size()], getToggleState(change));
+		}
+
+		result.numChangesRequested += transaction.getNumChangesRequested();
+	}
+	else
+	{
+		for (int change = 0; change < numChanges; change++)
+		{
+			const int index = change % numControls;
+
+			if (index < sliders.size())
+				sliders[index]->setValue(sliders[index]->proportionOfLengthToValue(getProportion(change)), juce::sendNotificationSync);
+			else
+				buttons[index - sliders.size()]->setToggleState(getToggleState(change), juce::sendNotificationSync);
+		}
+
+		result.numChangesRequested += numChanges;
+	}
+
+	result.applySeconds += juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+}
+
+juce::String PresetLoad::createReport(const Result& direct, const Result& transaction)
+{
+	auto formatRow = [](const juce::String& name, const Result& result)
+	{
+		const int numLoads = juce::jmax(1, result.numLoads);
+
+		return name.paddedRight(' ', 14)
+			+ juce::String(result.numChangesRequested / numLoads).paddedLeft(' ', 10)
+			+ juce::String(result.numNotifications / numLoads).paddedLeft(' ', 12)
+			+ juce::String(result.numRepaintRequests / numLoads).paddedLeft(' ', 12)
+			+ juce::String(result.numRepaintsExecuted / numLoads).paddedLeft(' ', 12)
+			+ juce::String(result.applySeconds * 1.0e3 / numLoads, 3).paddedLeft(' ', 12)
+			+ juce::String(result.paintSeconds * 1.0e3 / numLoads, 3).paddedLeft(' ', 12)
+			+ juce::newLine;
+	};
+
+	juce::String report;
+	report << "Per preset load:" << juce::newLine
+		<< juce::String("Mode").paddedRight(' ', 14)
+		<< juce::String("Changes").paddedLeft(' ', 10)
+		<< juce::String("Notified").paddedLeft(' ', 12)
+		<< juce::String("Requested").paddedLeft(' ', 12)
+		<< juce::String("Executed").paddedLeft(' ', 12)
+		<< juce::String("Apply ms").paddedLeft(' ', 12)
+		<< juce::String("Paint ms").paddedLeft(' ', 12)
+		<< juce::newLine
+		<< formatRow("Direct", direct)
+		<< formatRow("Transaction", transaction);
+
+	return report;
+}
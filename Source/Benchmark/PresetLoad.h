@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    PresetLoad.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RepaintProbe.h"
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+#include "../Components/RotaryKnob_GearShaped.h"
+#include "../Components/WaveformButton.h"
+#include "../Rendering/RepaintScheduler.h"
+
+/**
+ * Applies preset loads of 1000 parameter changes to an offscreen editor of faders,
+ * knobs and waveform buttons, one change at a time or in a ParameterTransaction,
+ * and measures the time taken, the listener calls and the repaints.
+ *
+ * The controls' repaints go through a RepaintScheduler like in MainComponent,
+ * flushed and painted once after each load, as the next vblank would.
+ */
+class PresetLoad : private juce::Slider::Listener, private juce::Button::Listener
+{
+public:
+	static constexpr int numChanges = 1000;
+	static constexpr int numFaders = 64;
+	static constexpr int numKnobs = 32;
+	static constexpr int numButtons = 32;
+
+	/** Measurements of one mode. */
+	struct Result
+	{
+		int numLoads = 0;
+		int numChangesRequested = 0;
+		/** Slider and button listener calls, or transaction commits. */
+		int numNotifications = 0;
+		/** repaint() calls made by the controls. */
+		int numRepaintRequests = 0;
+		/** Repaints that reached the editor. */
+		int numRepaintsExecuted = 0;
+		double applySeconds = 0.0;
+		double paintSeconds = 0.0;
+	};
+
+	PresetLoad();
+	~PresetLoad() override;
+
+	/**
+	 * Loads the given number of presets.
+	 *
+	 * \param inTransaction If true each preset is applied in a ParameterTransaction.
+	 */
+	Result run(int numLoads, bool inTransaction);
+
+	/** Returns a table of both modes. */
+	static juce::String createReport(const Result& direct, const Result& transaction);
+
+private:
+	/** Applies the changes of one preset, the n-th one. */
+	void applyPreset(int presetIndex, bool inTransaction, Result& result);
+
+	/** Listeners */
+	void sliderValueChanged(juce::Slider*) override { numNotifications++; }
+	void buttonClicked(juce::Button*) override { numNotifications++; }
+
+	juce::Component editor;
+	RepaintProbe& probe;
+
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+
+	juce::OwnedArray<juce::Slider> sliders;
+	juce::OwnedArray<WaveformButton> buttons;
+
+	RepaintScheduler repaintScheduler;
+
+	int numNotifications = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetLoad)
+};
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    RepaintProbe.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Catches the repaint requests of an offscreen component and paints them on demand.
+ *
+ * Components route every repaint() of themselves and of their children through
+ * their CachedComponentImage, so installing one is enough to see all requests
+ * of a component that is not on the desktop.
+ * The probe takes ownership of nothing: the component owns the probe.
+ */
+class RepaintProbe : public juce::CachedComponentImage
+{
+public:
+	/** Creates a probe and installs it on the component (which takes ownership of it). */
+	static RepaintProbe& attachTo(juce::Component& component)
+	{
+		auto* probe = new RepaintProbe(component);
+		component.setCachedComponentImage(probe);
+		return *probe;
+	}
+
+	/** True if anything has been invalidated since the last paint. */
+	bool isDirty() const { return !dirtyRegion.isEmpty(); }
+
+	/** Number of repaint requests since the last reset. */
+	int getNumRequests() const { return numRequests; }
+
+	/** Number of repaint requests made by the component while it was being painted. */
+	int getNumRequestsWhilePainting() const { return numRequestsWhilePainting; }
+
+	/** Number of times the dirty region was painted since the last reset. */
+	int getNumPaints() const { return numPaints; }
+
+	/** Resets the counters. */
+	void resetCounters()
+	{
+		numRequests = 0;
+		numRequestsWhilePainting = 0;
+		numPaints = 0;
+	}
+
+	/**
+	 * Paints the dirty region of the component into an offscreen image and clears it.
+	 *
+	 * \return The time the paint took, in seconds (0 if nothing was dirty).
+	 */
+	double paintDirtyRegion()
+	{
+		if (!isDirty())
+			return 0.0;
+
+		const auto area = dirtyRegion.getBounds().getIntersection(owner.getLocalBounds());
+		dirtyRegion.clear();
+
+		if (area.isEmpty())
+			return 0.0;
+
+		if (canvas.getWidth() < owner.getWidth() || canvas.getHeight() < owner.getHeight())
+			canvas = juce::Image(juce::Image::ARGB, juce::jmax(1, owner.getWidth()), juce::jmax(1, owner.getHeight()), true);
+
+		juce::Graphics g(canvas);
+		g.reduceClipRegion(area);
+
+		const auto startTicks = juce::Time::getHighResolutionTicks();
+
+		isPainting = true;
+		owner.paintEntireComponent(g, true);
+		isPainting = false;
+
+		numPaints++;
+
+		return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+	}
+
+	/** CachedComponentImage */
+	void paint(juce::Graphics& g) override
+	{
+		owner.paintEntireComponent(g, false);
+	}
+
+	bool invalidateAll() override
+	{
+		return invalidate(owner.getLocalBounds());
+	}
+
+	bool invalidate(const juce::Rectangle<int>& area) override
+	{
+		numRequests++;
+
+		if (isPainting)
+			numRequestsWhilePainting++;
+
+		dirtyRegion.add(area);
+
+		/** The component is offscreen, so there is nothing to pass the request on to. */
+		return false;
+	}
+
+	void releaseResources() override
+	{
+		canvas = {};
+	}
+
+private:
+	explicit RepaintProbe(juce::Component& componentToProbe)
+		: owner(componentToProbe)
+	{
+	}
+
+	juce::Component& owner;
+	juce::RectangleList<int> dirtyRegion;
+	juce::Image canvas;
+
+	bool isPainting = false;
+	int numRequests = 0;
+	int numRequestsWhilePainting = 0;
+	int numPaints = 0;
+
+	JUCE_DECLARE_NON_COPYABLE(RepaintProbe)
+};
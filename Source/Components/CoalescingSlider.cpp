@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+
+    CoalescingSlider.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "CoalescingSlider.h"
+
+CoalescingSlider::CoalescingSlider(const juce::String& componentName)
+	: juce::Slider(componentName)
+{
+}
+
+CoalescingSlider::~CoalescingSlider()
+{
+	vBlankAttachment.reset();
+}
+
+void CoalescingSlider::setDragCoalescing(bool shouldCoalesceDrags)
+{
+	dragCoalescing = shouldCoalesceDrags;
+
+	if (!dragCoalescing)
+		flushPendingDrag();
+}
+
+void CoalescingSlider::flushPendingDrag()
+{
+	if (!pendingDrag.has_value())
+		return;
+
+	/** Taken out first: the listeners may hold back another drag. */
+	const auto drag = *pendingDrag;
+	pendingDrag.reset();
+
+	applyDrag(drag);
+}
+
+void CoalescingSlider::setDragVelocityEstimation(bool shouldEstimateDragVelocity)
+{
+	dragVelocityEstimation = shouldEstimateDragVelocity;
+	numVelocitySamples = 0;
+}
+
+juce::Point<float> CoalescingSlider::getDragVelocity() const
+{
+	if (numVelocitySamples < 2)
+		return {};
+
+	const auto& latest = velocitySamples[(size_t)numVelocitySamples - 1];
+
+	/** The oldest sample still within the window, but never the latest itself. */
+	int oldest = 0;
+
+	while (oldest < numVelocitySamples - 2 && latest.milliseconds - velocitySamples[(size_t)oldest].milliseconds > velocityWindowMilliseconds)
+		oldest++;
+
+	const auto& first = velocitySamples[(size_t)oldest];
+	const double seconds = (latest.milliseconds - first.milliseconds) / 1000.0;
+
+	if (seconds <= 0.0)
+		return {};
+
+	return (latest.position - first.position) / (float)seconds;
+}
+
+void CoalescingSlider::mouseDown(const juce::MouseEvent& event)
+{
+	flushPendingDrag();
+	numVelocitySamples = 0;
+
+	juce::Slider::mouseDown(event);
+}
+
+void CoalescingSlider::mouseDrag(const juce::MouseEvent& event)
+{
+	dragStats.numDragEvents++;
+
+	if (dragVelocityEstimation)
+		addVelocitySample(event);
+
+	if (!dragCoalescing || !canCoalesce(event))
+	{
+		/** In order: a drag held back comes before this one. */
+		flushPendingDrag();
+		applyDrag(event);
+		return;
+	}
+
+	pendingDrag.emplace(event);
+
+	if (vBlankAttachment == nullptr)
+		vBlankAttachment = std::make_unique<juce::VBlankAttachment>(this, [this] { flushPendingDrag(); });
+}
+
+void CoalescingSlider::mouseUp(const juce::MouseEvent& event)
+{
+	/** The release uses the value of the last drag, like it would have without coalescing. */
+	flushPendingDrag();
+	vBlankAttachment.reset();
+	numVelocitySamples = 0;
+
+	juce::Slider::mouseUp(event);
+}
+
+bool CoalescingSlider::canCoalesce(const juce::MouseEvent& event) const
+{
+	switch (getSliderStyle())
+	{
+	case LinearHorizontal:
+	case LinearVertical:
+	case LinearBar:
+	case LinearBarVertical:
+	case RotaryHorizontalDrag:
+	case RotaryVerticalDrag:
+	case RotaryHorizontalVerticalDrag:
+		break;
+
+	/** Rotary follows the angle from one drag to the next, the two and three value styles pick a thumb per drag. */
+	default:
+		return false;
+	}
+
+	/** Velocity mode adds up the movement of every drag. The modifier keys can swap modes in the middle of a drag. */
+	const bool swapsMode = getVelocityModeIsSwappable() && event.mods.testFlags(juce::ModifierKeys::ctrlAltCommandModifiers);
+	return getVelocityBasedMode() == swapsMode;
+}
+
+void CoalescingSlider::applyDrag(const juce::MouseEvent& event)
+{
+	dragStats.numAppliedDrags++;
+	juce::Slider::mouseDrag(event);
+}
+
+void CoalescingSlider::addVelocitySample(const juce::MouseEvent& event)
+{
+	if (numVelocitySamples == maxVelocitySamples)
+	{
+		std::move(velocitySamples.begin() + 1, velocitySamples.end(), velocitySamples.begin());
+		numVelocitySamples--;
+	}
+
+	velocitySamples[(size_t)numVelocitySamples++] = { event.position, (double)event.eventTime.toMilliseconds() };
+}
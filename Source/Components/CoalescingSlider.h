@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    CoalescingSlider.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * A slider that can collapse the mouse drags of a frame into one.
+ *
+ * High rate mice and trackpads send several drag events per frame, and each of them runs the slider's
+ * whole value pipeline: snapping, listeners, the text box and a repaint. With drag coalescing on, a drag
+ * event is held back instead, replaced by any later one, and the latest is applied at the next vblank of
+ * the slider's display or when the mouse is released. Listeners and repaints then run at most once a frame.
+ *
+ * Only drags whose value depends on nothing but the current mouse position and where the drag started
+ * are held back: the linear styles and the rotary drag styles, outside of velocity mode. The value after
+ * the latest drag is then exactly what it would have been after every drag. Other drags are applied as
+ * they come, once any drag held back before them has been applied.
+ *
+ * The speed of the mouse can be estimated from every drag event, including the ones held back
+ * (see setDragVelocityEstimation()).
+ */
+class CoalescingSlider : public juce::Slider
+{
+public:
+	/** Drag events used for the velocity estimate, at most. */
+	static constexpr int maxVelocitySamples = 8;
+
+	/** The velocity estimate is taken over the drag events of this long before the latest one. */
+	static constexpr double velocityWindowMilliseconds = 50.0;
+
+	/** Drag events received and drag events applied to the slider. */
+	struct DragStats
+	{
+		juce::int64 numDragEvents = 0;
+		juce::int64 numAppliedDrags = 0;
+	};
+
+	CoalescingSlider() = default;
+	explicit CoalescingSlider(const juce::String& componentName);
+	~CoalescingSlider() override;
+
+	/** Applies at most one drag per frame. Off by default. */
+	void setDragCoalescing(bool shouldCoalesceDrags);
+	bool getDragCoalescing() const { return dragCoalescing; }
+
+	/**
+	 * Applies the drag held back, if any. Called at every vblank while the slider is dragged, and on
+	 * mouse up. Call it from elsewhere to apply the drags of an offscreen slider, which gets no vblanks.
+	 */
+	void flushPendingDrag();
+
+	/** True if a drag is waiting for the next frame. */
+	bool hasPendingDrag() const { return pendingDrag.has_value(); }
+
+	/** Keeps the positions and times of the latest drag events for getDragVelocity(). Off by default. */
+	void setDragVelocityEstimation(bool shouldEstimateDragVelocity);
+	bool getDragVelocityEstimation() const { return dragVelocityEstimation; }
+
+	/**
+	 * Returns the speed of the mouse over the latest drag events, in pixels per second.
+	 * Zero when the slider isn't being dragged or the estimation is off.
+	 */
+	juce::Point<float> getDragVelocity() const;
+
+	DragStats getDragStats() const { return dragStats; }
+	void resetDragStats() { dragStats = {}; }
+
+	/** Slider */
+	void mouseDown(const juce::MouseEvent& event) override;
+	void mouseDrag(const juce::MouseEvent& event) override;
+	void mouseUp(const juce::MouseEvent& event) override;
+
+private:
+	/** True if the value after the drag doesn't depend on the drags before it. */
+	bool canCoalesce(const juce::MouseEvent& event) const;
+
+	/** Runs the drag through the slider. */
+	void applyDrag(const juce::MouseEvent& event);
+
+	/** Adds a drag event to the velocity estimate. */
+	void addVelocitySample(const juce::MouseEvent& event);
+
+	/** Position and time of a drag event. */
+	struct VelocitySample
+	{
+		juce::Point<float> position;
+		double milliseconds = 0.0;
+	};
+
+	bool dragCoalescing = false;
+	std::optional<juce::MouseEvent> pendingDrag;
+
+	bool dragVelocityEstimation = false;
+	/** Latest samples, oldest first. */
+	std::array<VelocitySample, maxVelocitySamples> velocitySamples;
+	int numVelocitySamples = 0;
+
+	DragStats dragStats;
+
+	/** Only attached from the first drag held back until the mouse is released. Declared last, so it's detached first. */
+	std::unique_ptr<juce::VBlankAttachment> vBlankAttachment;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CoalescingSlider)
+};
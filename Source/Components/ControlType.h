@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    ControlType.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Identifies the kinds of custom controls in this project.
+ * Used wherever a control has to be described without a pointer to it
+ * (paint traces, benchmark reports).
+ */
+enum class ControlType : juce::uint8
+{
+	mixingConsoleFader,
+	synthBipolarFader,
+	gearKnob,
+	waveformButton,
+	waveformSelector
+};
+
+/** Number of entries in ControlType. */
+constexpr int numControlTypes = 5;
+
+/** Returns a readable name for a control type. */
+inline const char* getControlTypeName(ControlType controlType)
+{
+	switch (controlType)
+	{
+	case ControlType::mixingConsoleFader:	return "Mixing console fader";
+	case ControlType::synthBipolarFader:	return "Synth bipolar fader";
+	case ControlType::gearKnob:				return "Gear-shaped knob";
+	case ControlType::waveformButton:		return "Waveform button";
+	case ControlType::waveformSelector:		return "Waveform selector";
+	default:								return "Unknown";
+	}
+}
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    PaintedValueReadout.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "PaintedValueReadout.h"
+#include "../Rendering/Theme.h"
+
+PaintedValueReadout::~PaintedValueReadout()
+{
+	attachTo(nullptr);
+}
+
+void PaintedValueReadout::attachTo(juce::Slider* newSlider)
+{
+	if (slider != nullptr)
+	{
+		hideEditor(false);
+		slider->removeMouseListener(this);
+
+		if (snapsChanged)
+			slider->setSliderSnapsToMousePosition(true);
+	}
+
+	slider = newSlider;
+	snapsChanged = false;
+
+	if (slider == nullptr)
+		return;
+
+	/** No Label: the LookAndFeel paints the value. The text box size is kept for the layout. */
+	slider->setTextBoxStyle(juce::Slider::NoTextBox, true, slider->getTextBoxWidth(), slider->getTextBoxHeight());
+	slider->addMouseListener(this, false);
+
+	if (!readoutClicksSnap && slider->getSliderSnapsToMousePosition())
+	{
+		slider->setSliderSnapsToMousePosition(false);
+		snapsChanged = true;
+	}
+}
+
+void PaintedValueReadout::setReadoutClicksSnap(bool shouldReadoutClicksSnap)
+{
+	readoutClicksSnap = shouldReadoutClicksSnap;
+	attachTo(slider);
+}
+
+juce::Rectangle<int> PaintedValueReadout::getReadoutBounds() const
+{
+	if (auto* lookAndFeelMethods = dynamic_cast<juce::Slider::LookAndFeelMethods*>(&slider->getLookAndFeel()))
+		return lookAndFeelMethods->getSliderLayout(*slider).textBoxBounds;
+
+	return {};
+}
+
+void PaintedValueReadout::showEditor()
+{
+	editor = std::make_unique<juce::TextEditor>("valueEditor");
+	editor->setJustification(juce::Justification::centred);
+	const auto theme = Theme::getCurrent();
+	editor->setColour(juce::TextEditor::textColourId, theme->getColours().text);
+	editor->setColour(juce::TextEditor::backgroundColourId, theme->getColours().textEditorBackground);
+	editor->setColour(juce::TextEditor::outlineColourId, theme->getColours().text);
+	editor->setText(slider->getTextFromValue(slider->getValue()), false);
+	editor->addListener(this);
+
+	slider->addAndMakeVisible(editor.get());
+	editor->setBounds(getReadoutBounds());
+	editor->selectAll();
+	editor->grabKeyboardFocus();
+}
+
+void PaintedValueReadout::hideEditor(bool applyValue)
+{
+	if (editor == nullptr)
+		return;
+
+	/** Moved out first, as removing the editor can make it lose focus and call back in here. */
+	auto closingEditor = std::move(editor);
+	closingEditor->removeListener(this);
+
+	if (slider != nullptr)
+	{
+		if (applyValue)
+			slider->setValue(slider->getValueFromText(closingEditor->getText()), juce::sendNotificationSync);
+
+		slider->removeChildComponent(closingEditor.get());
+	}
+
+	/** Deleted later, as this is usually called from one of the editor's own callbacks. */
+	juce::MessageManager::callAsync([deletedEditor = std::shared_ptr<juce::TextEditor>(std::move(closingEditor))] {});
+}
+
+void PaintedValueReadout::mouseDoubleClick(const juce::MouseEvent& event)
+{
+	if (slider == nullptr || editor != nullptr)
+		return;
+
+	if (getReadoutBounds().contains(event.getEventRelativeTo(slider).getPosition()))
+		showEditor();
+}
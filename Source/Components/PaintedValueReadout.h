@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    PaintedValueReadout.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Switches a slider from a Label text box to a value readout painted by its LookAndFeel.
+ *
+ * The slider gets no text box component; its LookAndFeel draws the value in
+ * the text box area of its layout instead (see setPaintedValueReadout() of the
+ * slider LookAndFeels). Double-clicking the readout opens a transient
+ * TextEditor to type a value, which is removed once the value is entered or
+ * the editor loses focus.
+ *
+ * Attaching a readout doesn't change how the slider is dragged. Without a
+ * Label over it, a click on the readout reaches the slider, which makes the
+ * value jump to the mouse if the slider snaps to it; see setReadoutClicksSnap().
+ */
+class PaintedValueReadout : private juce::MouseListener, private juce::TextEditor::Listener
+{
+public:
+	PaintedValueReadout() = default;
+	~PaintedValueReadout() override;
+
+	/** Removes the slider's text box and starts handling double-clicks on its readout. Pass nullptr to detach. */
+	void attachTo(juce::Slider* newSlider);
+
+	/**
+	 * Whether clicks make the slider's value jump to the mouse, as they do on the track of a slider
+	 * that snaps to the mouse position. On by default. Turned off, the slider stops snapping to the
+	 * mouse altogether while the readout is attached (JUCE can't tell a click on the readout apart),
+	 * so double-clicking the readout to type a value doesn't move the value first.
+	 */
+	void setReadoutClicksSnap(bool shouldReadoutClicksSnap);
+	bool getReadoutClicksSnap() const { return readoutClicksSnap; }
+
+	/** True while the transient editor is open. */
+	bool isEditing() const { return editor != nullptr; }
+
+private:
+	/** Returns the area the LookAndFeel draws the readout in. */
+	juce::Rectangle<int> getReadoutBounds() const;
+
+	void showEditor();
+	void hideEditor(bool applyValue);
+
+	void mouseDoubleClick(const juce::MouseEvent& event) override;
+
+	void textEditorReturnKeyPressed(juce::TextEditor&) override { hideEditor(true); }
+	void textEditorEscapeKeyPressed(juce::TextEditor&) override { hideEditor(false); }
+	void textEditorFocusLost(juce::TextEditor&) override { hideEditor(true); }
+
+	juce::Component::SafePointer<juce::Slider> slider;
+	std::unique_ptr<juce::TextEditor> editor;
+
+	bool readoutClicksSnap = true;
+	/** True if the slider snapped to the mouse until the readout was attached. */
+	bool snapsChanged = false;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PaintedValueReadout)
+};
@@ -0,0 +1,342 @@
+/*
+  ==============================================================================
+
+    ParameterPanel.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "ParameterPanel.h"
+#include "../Rendering/Theme.h"
+
+ParameterPanel::ParameterPanel()
+{
+	slider_MixingConsoleStyle_LookAndFeel.setPaintedValueReadout(true);
+	slider_SynthBipolar_LookAndFeel.setPaintedValueReadout(true);
+	slider_MixingConsoleStyle_LookAndFeel.setSurfaceMaterial(true);
+	slider_SynthBipolar_LookAndFeel.setSurfaceMaterial(true);
+
+	setScrollBarsShown(true, false);
+	setViewedComponent(&content, false);
+}
+
+ParameterPanel::~ParameterPanel()
+{
+	setViewedComponent(nullptr, false);
+
+	for (auto* control : controls)
+		control->component->setLookAndFeel(nullptr);
+
+	boundControls.clear();
+	controls.clear();
+}
+
+void ParameterPanel::setParameters(std::vector<Parameter> newParameters)
+{
+	/** Every control goes back to its pool: the same indices may now be other types. */
+	for (auto& bound : boundControls)
+		releaseControl(*bound.second);
+
+	boundControls.clear();
+	parameters = std::move(newParameters);
+
+	updateContentSize();
+	updateControls();
+	content.repaint();
+}
+
+void ParameterPanel::setParameterValue(int index, double newValue)
+{
+	jassert(juce::isPositiveAndBelow(index, getNumParameters()));
+
+	parameters[(size_t)index].value = newValue;
+
+	if (auto found = boundControls.find(index); found != boundControls.end())
+		bindControl(*found->second, index);
+}
+
+juce::Component* ParameterPanel::getControl(int parameterIndex) const
+{
+	if (auto found = boundControls.find(parameterIndex); found != boundControls.end())
+		return found->second->component.get();
+
+	return nullptr;
+}
+
+juce::Rectangle<int> ParameterPanel::getCellBounds(int parameterIndex) const
+{
+	const int numColumns = getNumColumns();
+
+	return { (parameterIndex % numColumns) * cellWidth, (parameterIndex / numColumns) * cellHeight, cellWidth, cellHeight };
+}
+
+std::vector<ParameterPanel::Parameter> ParameterPanel::createTestParameters(int numParameters)
+{
+	std::vector<Parameter> testParameters((size_t)juce::jmax(0, numParameters));
+	juce::Random random(1);
+
+	for (int i = 0; i < numParameters; i++)
+	{
+		auto& parameter = testParameters[(size_t)i];
+		parameter.name = "Parameter " + juce::String(i + 1);
+
+		switch (i % 4)
+		{
+		case 0:
+			/** Levels, like the sliders of MainComponent, every other one from 0 to 10 so that a fader rebound from one to the next changes range. */
+			parameter.controlType = ControlType::mixingConsoleFader;
+			parameter.maximum = (i / 4) % 2 == 0 ? 1.0 : 10.0;
+			parameter.interval = parameter.maximum / 100.0;
+			parameter.value = parameter.maximum * random.nextDouble();
+			break;
+		case 1:
+			parameter.controlType = ControlType::synthBipolarFader;
+			parameter.minimum = -1.0;
+			parameter.interval = 0.01;
+			parameter.value = parameter.minimum + 2.0 * random.nextDouble();
+			break;
+		case 2:
+			parameter.controlType = ControlType::gearKnob;
+			parameter.value = random.nextDouble();
+			break;
+		default:
+			parameter.controlType = ControlType::waveformButton;
+			parameter.waveform = (WaveformButton_LookAndFeel::Waveform)((i / 4) % 5);
+			parameter.value = random.nextBool() ? 1.0 : 0.0;
+			break;
+		}
+	}
+
+	return testParameters;
+}
+
+void ParameterPanel::resized()
+{
+	juce::Viewport::resized();
+
+	updateContentSize();
+
+	/** The number of columns may have changed, and with it every cell. */
+	for (auto& bound : boundControls)
+		bound.second->component->setBounds(getControlBounds(bound.first));
+
+	updateControls();
+}
+
+void ParameterPanel::visibleAreaChanged(const juce::Rectangle<int>&)
+{
+	updateControls();
+}
+
+void ParameterPanel::visibilityChanged()
+{
+	updateControls();
+}
+
+int ParameterPanel::getNumColumns() const
+{
+	return juce::jmax(1, getMaximumVisibleWidth() / cellWidth);
+}
+
+void ParameterPanel::updateContentSize()
+{
+	const int numColumns = getNumColumns();
+	const int numRows = (getNumParameters() + numColumns - 1) / numColumns;
+
+	content.setSize(numColumns * cellWidth, numRows * cellHeight);
+}
+
+void ParameterPanel::updateControls()
+{
+	/** A hidden panel keeps no controls, so one that is never shown never creates any. */
+	if (!isVisible())
+	{
+		for (auto& bound : boundControls)
+			releaseControl(*bound.second);
+
+		boundControls.clear();
+		return;
+	}
+
+	const int numColumns = getNumColumns();
+	const auto viewArea = getViewArea();
+
+	const int firstRow = juce::jmax(0, viewArea.getY() / cellHeight - overscanRows);
+	const int lastRow = (viewArea.getBottom() - 1) / cellHeight + overscanRows;
+
+	const int firstIndex = firstRow * numColumns;
+	const int endIndex = juce::jmin(getNumParameters(), (lastRow + 1) * numColumns);
+
+	/** Controls scrolled out of range first, so the cells scrolled into range can reuse them. */
+	for (auto bound = boundControls.begin(); bound != boundControls.end();)
+	{
+		const int index = bound->first;
+		auto& control = *bound->second;
+
+		/** A control being dragged keeps its parameter until it's released. */
+		if ((index < firstIndex || index >= endIndex) && !control.component->isMouseButtonDown(true))
+		{
+			releaseControl(control);
+			bound = boundControls.erase(bound);
+		}
+		else
+		{
+			++bound;
+		}
+	}
+
+	for (int index = firstIndex; index < endIndex; index++)
+	{
+		if (boundControls.find(index) != boundControls.end())
+			continue;
+
+		auto& control = acquireControl(parameters[(size_t)index].controlType);
+		bindControl(control, index);
+		boundControls[index] = &control;
+	}
+}
+
+ParameterPanel::PooledControl& ParameterPanel::acquireControl(ControlType controlType)
+{
+	auto& pool = pools[(size_t)controlType];
+
+	if (!pool.isEmpty())
+		return *pool.removeAndReturn(pool.size() - 1);
+
+	auto* control = controls.add(new PooledControl());
+	control->controlType = controlType;
+
+	switch (controlType)
+	{
+	case ControlType::mixingConsoleFader:
+	case ControlType::synthBipolarFader:
+	{
+		/** Set up like the vertical faders of MainComponent. */
+		auto* fader = new CoalescingSlider();
+		control->component.reset(fader);
+
+		fader->setSliderStyle(juce::Slider::LinearVertical);
+		fader->setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+
+		if (controlType == ControlType::mixingConsoleFader)
+			fader->setLookAndFeel(&slider_MixingConsoleStyle_LookAndFeel);
+		else
+			fader->setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
+
+		control->valueReadout = std::make_unique<PaintedValueReadout>();
+		control->valueReadout->attachTo(fader);
+
+		fader->setDragCoalescing(true);
+		fader->onValueChange = [this, control] { controlValueChanged(*control); };
+		break;
+	}
+	case ControlType::gearKnob:
+	{
+		auto* knob = new RotaryKnob_GearShaped();
+		control->component.reset(knob);
+
+		knob->setPaintedValueReadout(true);
+		knob->setSurfaceMaterial(true);
+		knob->setDragCoalescing(true);
+		knob->onValueChange = [this, control] { controlValueChanged(*control); };
+		break;
+	}
+	case ControlType::waveformButton:
+	{
+		auto* button = new WaveformButton("parameterButton");
+		control->component.reset(button);
+
+		button->onClick = [this, control] { controlValueChanged(*control); };
+		break;
+	}
+	default:
+		/** The waveform selector holds five parameters, not one. */
+		jassertfalse;
+		control->component = std::make_unique<juce::Component>();
+		break;
+	}
+
+	content.addChildComponent(control->component.get());
+
+	return *control;
+}
+
+void ParameterPanel::releaseControl(PooledControl& control)
+{
+	control.component->setVisible(false);
+	control.parameterIndex = -1;
+
+	pools[(size_t)control.controlType].add(&control);
+}
+
+void ParameterPanel::bindControl(PooledControl& control, int parameterIndex)
+{
+	const auto& parameter = parameters[(size_t)parameterIndex];
+	control.parameterIndex = parameterIndex;
+
+	if (auto* slider = dynamic_cast<juce::Slider*>(control.component.get()))
+	{
+		slider->setRange(parameter.minimum, parameter.maximum, parameter.interval);
+		slider->setValue(parameter.value, juce::dontSendNotification);
+	}
+	else if (auto* button = dynamic_cast<WaveformButton*>(control.component.get()))
+	{
+		button->setWaveform(parameter.waveform);
+		button->setToggleState(parameter.value >= 0.5, juce::dontSendNotification);
+	}
+
+	control.component->setBounds(getControlBounds(parameterIndex));
+	control.component->setVisible(true);
+}
+
+void ParameterPanel::controlValueChanged(PooledControl& control)
+{
+	if (control.parameterIndex < 0)
+		return;
+
+	double newValue = 0.0;
+
+	if (auto* slider = dynamic_cast<juce::Slider*>(control.component.get()))
+		newValue = slider->getValue();
+	else if (auto* button = dynamic_cast<juce::Button*>(control.component.get()))
+		newValue = button->getToggleState() ? 1.0 : 0.0;
+
+	parameters[(size_t)control.parameterIndex].value = newValue;
+
+	if (onValueChange != nullptr)
+		onValueChange(control.parameterIndex, newValue);
+}
+
+juce::Rectangle<int> ParameterPanel::getControlBounds(int parameterIndex) const
+{
+	auto bounds = getCellBounds(parameterIndex).withTrimmedBottom(nameHeight).reduced(5);
+
+	/** Waveform buttons are drawn at the size of the ones of MainComponent, twice over. */
+	if (parameters[(size_t)parameterIndex].controlType == ControlType::waveformButton)
+		return bounds.withSizeKeepingCentre(60, 40);
+
+	return bounds;
+}
+
+void ParameterPanel::Content::paint(juce::Graphics& g)
+{
+	const int numParameters = panel.getNumParameters();
+	const int numColumns = panel.getNumColumns();
+	const auto clip = g.getClipBounds();
+
+	const int firstRow = juce::jmax(0, clip.getY() / cellHeight);
+	const int lastRow = (clip.getBottom() - 1) / cellHeight;
+
+	g.setColour(Theme::getCurrent()->getColours().text);
+	g.setFont(juce::Font(nameHeight * 0.6f));
+
+	for (int index = firstRow * numColumns; index < juce::jmin(numParameters, (lastRow + 1) * numColumns); index++)
+	{
+		const auto nameBounds = panel.getCellBounds(index).removeFromBottom(nameHeight);
+
+		if (nameBounds.intersects(clip))
+			g.drawText(panel.getParameter(index).name, nameBounds.reduced(2, 0), juce::Justification::centred, true);
+	}
+}
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    ParameterPanel.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ControlType.h"
+#include "CoalescingSlider.h"
+#include "RotaryKnob_GearShaped.h"
+#include "WaveformButton.h"
+#include "PaintedValueReadout.h"
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+
+/**
+ * A scrolling grid of controls for parameter sets too large to give every parameter a control.
+ *
+ * The parameters are plain values in the panel's model, apart from the controls. Only the cells in
+ * the viewport and a row or two around it get a control: controls come from a pool per control type,
+ * and the ones scrolled out of view go back to their pool and are reused for the cells scrolled into
+ * view. The number of controls depends on the size of the viewport, not on the number of parameters.
+ *
+ * Faders, bipolar faders, gear knobs and waveform buttons are supported. The sliders paint their
+ * values (see PaintedValueReadout) rather than having a Label each, and coalesce their drags.
+ * The names of the parameters are painted by the panel under their cells.
+ */
+class ParameterPanel : public juce::Viewport
+{
+public:
+	/** Size of the cell of a parameter: its control and its name under it. */
+	static constexpr int cellWidth = 100;
+	static constexpr int cellHeight = 180;
+	static constexpr int nameHeight = 20;
+
+	/** Rows above and below the viewport that get controls too, so a scroll by less than a row creates none. */
+	static constexpr int overscanRows = 1;
+
+	/** A parameter of the model. */
+	struct Parameter
+	{
+		juce::String name;
+		/** Any type but the waveform selector. */
+		ControlType controlType = ControlType::mixingConsoleFader;
+		/** Range of the faders and the knob. */
+		double minimum = 0.0;
+		double maximum = 1.0;
+		double interval = 0.0;
+		/** The value of a fader or knob, or 1 if a waveform button is on and 0 if it's off. */
+		double value = 0.0;
+		/** Waveform drawn by a waveform button. */
+		WaveformButton_LookAndFeel::Waveform waveform = WaveformButton_LookAndFeel::Sawtooth;
+	};
+
+	ParameterPanel();
+	~ParameterPanel() override;
+
+	/** Replaces the model. The controls in view are bound to the new parameters. */
+	void setParameters(std::vector<Parameter> newParameters);
+
+	int getNumParameters() const { return (int)parameters.size(); }
+
+	const Parameter& getParameter(int index) const { return parameters[(size_t)index]; }
+
+	/** Sets the value of a parameter, and of its control if it has one, without calling onValueChange. */
+	void setParameterValue(int index, double newValue);
+
+	/** Called when a control changes the value of its parameter. */
+	std::function<void(int parameterIndex, double newValue)> onValueChange;
+
+	/** Number of controls created, in use or in the pools. */
+	int getNumControls() const { return controls.size(); }
+
+	/** Number of controls bound to a parameter. */
+	int getNumBoundControls() const { return (int)boundControls.size(); }
+
+	/** Returns the control of a parameter, or nullptr if the parameter isn't near the viewport. */
+	juce::Component* getControl(int parameterIndex) const;
+
+	/** Returns the bounds of the cell of a parameter, in the coordinates of the scrolled content. */
+	juce::Rectangle<int> getCellBounds(int parameterIndex) const;
+
+	/** Creates parameters of every supported type in turn, for the demo and the benchmarks. */
+	static std::vector<Parameter> createTestParameters(int numParameters);
+
+	/** Viewport */
+	void resized() override;
+	void visibleAreaChanged(const juce::Rectangle<int>& newVisibleArea) override;
+	void visibilityChanged() override;
+
+private:
+	/** The scrolled content: as large as the whole grid, with controls in the cells near the viewport only. */
+	class Content : public juce::Component
+	{
+	public:
+		explicit Content(ParameterPanel& panelToShow) : panel(panelToShow) {}
+
+		/** Paints the names of the parameters in the clip region. */
+		void paint(juce::Graphics& g) override;
+
+	private:
+		ParameterPanel& panel;
+	};
+
+	/** A control of a pool, and the parameter it is bound to, if any. */
+	struct PooledControl
+	{
+		ControlType controlType = ControlType::mixingConsoleFader;
+		std::unique_ptr<juce::Component> component;
+		/** The readout of a fader. Declared after the fader, so it's detached before the fader is deleted. */
+		std::unique_ptr<PaintedValueReadout> valueReadout;
+		int parameterIndex = -1;
+	};
+
+	/** Number of columns that fit the viewport. */
+	int getNumColumns() const;
+
+	/** Sizes the content to the grid. */
+	void updateContentSize();
+
+	/** Gives the cells near the viewport a control each and returns the others to the pools. */
+	void updateControls();
+
+	/** Returns a control of the type from its pool, creating one if the pool is empty. */
+	PooledControl& acquireControl(ControlType controlType);
+
+	/** Unbinds a control and returns it to its pool. */
+	void releaseControl(PooledControl& control);
+
+	/** Shows the value of a parameter on a control and places it in the parameter's cell. */
+	void bindControl(PooledControl& control, int parameterIndex);
+
+	/** Writes the value of a control to its parameter. */
+	void controlValueChanged(PooledControl& control);
+
+	/** Bounds of the control in a cell. */
+	juce::Rectangle<int> getControlBounds(int parameterIndex) const;
+
+	std::vector<Parameter> parameters;
+
+	/** LookAndFeels of the faders. The knobs and buttons own theirs. */
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+
+	Content content { *this };
+
+	/** Every control created. Declared after the content and the LookAndFeels, so it's deleted first. */
+	juce::OwnedArray<PooledControl> controls;
+	/** Controls not bound to a parameter, by control type. */
+	std::array<juce::Array<PooledControl*>, numControlTypes> pools;
+	/** Controls bound to a parameter, by parameter index. */
+	std::map<int, PooledControl*> boundControls;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterPanel)
+};
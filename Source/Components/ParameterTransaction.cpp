@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    ParameterTransaction.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "ParameterTransaction.h"
+
+ParameterTransaction::ParameterTransaction(RepaintScheduler* schedulerToSuspend)
+	: scheduler(schedulerToSuspend)
+{
+	if (scheduler != nullptr)
+		scheduler->suspend();
+}
+
+ParameterTransaction::~ParameterTransaction()
+{
+	commit();
+}
+
+void ParameterTransaction::setValue(juce::Slider& slider, double newValue)
+{
+	record(sliderChanges, slider, newValue);
+}
+
+void ParameterTransaction::setToggleState(juce::Button& button, bool shouldBeOn)
+{
+	record(buttonChanges, button, shouldBeOn);
+}
+
+void ParameterTransaction::setTheme(Theme::Ptr newTheme)
+{
+	jassert(!committed);
+
+	numChangesRequested++;
+	theme = std::move(newTheme);
+}
+
+template <typename ControlType, typename ValueType>
+void ParameterTransaction::record(std::vector<Change<ControlType, ValueType>>& changes, ControlType& control, ValueType value)
+{
+	jassert(!committed);
+
+	numChangesRequested++;
+
+	const auto [found, inserted] = changeIndices.try_emplace(&control, changes.size());
+
+	if (inserted)
+		changes.push_back({ &control, value });
+	else
+		changes[found->second].value = value;
+}
+
+void ParameterTransaction::commit()
+{
+	if (committed)
+		return;
+
+	committed = true;
+
+	/** The theme first, so the text boxes updated below already use its colours. */
+	if (theme != nullptr)
+		Theme::setCurrent(theme);
+
+	/** Without notifications: the listeners of N controls would otherwise run N times between two frames. */
+	for (const auto& change : sliderChanges)
+	{
+		if (change.control != nullptr)
+			change.control->setValue(change.value, juce::dontSendNotification);
+	}
+
+	for (const auto& change : buttonChanges)
+	{
+		if (change.control != nullptr)
+			change.control->setToggleState(change.value, juce::dontSendNotification);
+	}
+
+	/** The one notification of the whole transaction, while the repaints it causes are still held back. */
+	if (onCommit != nullptr)
+		onCommit(*this);
+
+	if (scheduler != nullptr)
+		scheduler->resume();
+}
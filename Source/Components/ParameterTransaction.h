@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    ParameterTransaction.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Rendering/RepaintScheduler.h"
+#include "../Rendering/Theme.h"
+
+/**
+ * Applies a group of control changes (e.g. a preset load) in one pass.
+ *
+ * While the transaction is open, changes are only recorded: setting the same
+ * control several times keeps the last value, and no listener, text box update
+ * or repaint happens. commit() (or the destructor) then switches the theme at most
+ * once and sets each changed control once without notifying its listeners, while
+ * the repaint scheduler is still held back. The changes are announced in a single
+ * call to onCommit, and the scheduler flushes everything at the next vblank.
+ *
+ *     {
+ *         ParameterTransaction transaction(&repaintScheduler);
+ *         transaction.onCommit = [this](const ParameterTransaction& t) { parametersChanged(t.getSliderChanges()); };
+ *         for (auto& parameter : preset)
+ *             transaction.setValue(*sliders[parameter.index], parameter.value);
+ *     }
+ */
+class ParameterTransaction
+{
+public:
+	/** A control and the value it is set to. */
+	template <typename ControlType, typename ValueType>
+	struct Change
+	{
+		juce::Component::SafePointer<ControlType> control;
+		ValueType value;
+	};
+
+	using SliderChange = Change<juce::Slider, double>;
+	using ButtonChange = Change<juce::Button, bool>;
+
+	/**
+	 * Opens a transaction.
+	 *
+	 * \param schedulerToSuspend The scheduler of the changed controls, held back until the changes are applied. Can be nullptr.
+	 */
+	explicit ParameterTransaction(RepaintScheduler* schedulerToSuspend = nullptr);
+
+	/** Commits the transaction, if it wasn't committed already. */
+	~ParameterTransaction();
+
+	/** Sets the value of a slider or knob when the transaction is committed. */
+	void setValue(juce::Slider& slider, double newValue);
+
+	/** Sets the toggle state of a button when the transaction is committed. */
+	void setToggleState(juce::Button& button, bool shouldBeOn);
+
+	/** Makes a theme the current one when the transaction is committed. */
+	void setTheme(Theme::Ptr newTheme);
+
+	/**
+	 * Called once by commit(), after every change was applied and before the repaints are resumed.
+	 * The controls' own listeners aren't called: this replaces their notifications.
+	 */
+	std::function<void(const ParameterTransaction&)> onCommit;
+
+	/** Applies the changes, calls onCommit and resumes the repaints. */
+	void commit();
+
+	/** The slider and button changes, one per control, in the order the controls were first changed. */
+	const std::vector<SliderChange>& getSliderChanges() const { return sliderChanges; }
+	const std::vector<ButtonChange>& getButtonChanges() const { return buttonChanges; }
+
+	/** Number of changes requested so far. */
+	int getNumChangesRequested() const { return numChangesRequested; }
+
+	/** Number of controls that will be (or were) changed. */
+	int getNumControlsChanged() const { return (int)sliderChanges.size() + (int)buttonChanges.size(); }
+
+private:
+	/** Records a change, replacing an earlier change of the same control. */
+	template <typename ControlType, typename ValueType>
+	void record(std::vector<Change<ControlType, ValueType>>& changes, ControlType& control, ValueType value);
+
+	RepaintScheduler* scheduler;
+	bool committed = false;
+
+	std::vector<SliderChange> sliderChanges;
+	std::vector<ButtonChange> buttonChanges;
+	/** Index of each changed control in its changes, so repeated changes stay O(1). */
+	std::unordered_map<juce::Component*, size_t> changeIndices;
+
+	Theme::Ptr theme;
+
+	int numChangesRequested = 0;
+
+	JUCE_DECLARE_NON_COPYABLE(ParameterTransaction)
+};
@@ -12,9 +12,46 @@ RotaryKnob_GearShaped::RotaryKnob_GearShaped()
 	this->setSliderStyle(Slider::RotaryVerticalDrag);
 
 	this->setNumDecimalPlacesToDisplay(2);
+
+	interactionQuality.attachTo(this);
 }
 
 RotaryKnob_GearShaped::~RotaryKnob_GearShaped()
 {
+	interactionQuality.attachTo(nullptr);
+	paintedValueReadout.attachTo(nullptr);
+
 	this->setLookAndFeel(nullptr);
 }
+
+int RotaryKnob_GearShaped::getQuantisedPointerPosition(float physicalPixelScale)
+{
+	return rotaryKnob_GearShaped_LookAndFeel.getQuantisedPointerPosition(*this, physicalPixelScale);
+}
+
+void RotaryKnob_GearShaped::setPaintedValueReadout(bool shouldPaintValueReadout)
+{
+	rotaryKnob_GearShaped_LookAndFeel.setPaintedValueReadout(shouldPaintValueReadout);
+
+	if (shouldPaintValueReadout)
+	{
+		paintedValueReadout.attachTo(this);
+	}
+	else
+	{
+		paintedValueReadout.attachTo(nullptr);
+		setTextBoxStyle(TextBoxBelow, false, getTextBoxWidth(), getTextBoxHeight());
+	}
+}
+
+void RotaryKnob_GearShaped::setSdfRendering(bool shouldUseSdfRendering)
+{
+	rotaryKnob_GearShaped_LookAndFeel.setSdfRendering(shouldUseSdfRendering);
+	repaint();
+}
+
+void RotaryKnob_GearShaped::setSurfaceMaterial(bool shouldUseSurfaceMaterial)
+{
+	rotaryKnob_GearShaped_LookAndFeel.setSurfaceMaterial(shouldUseSurfaceMaterial);
+	repaint();
+}
@@ -3,20 +3,41 @@
 
 #include "JuceHeader.h"
 #include "..\LookAndFeels\RotaryKnob_GearShaped_LookAndFeel.h"
+#include "..\Rendering\InteractionQuality.h"
+#include "PaintedValueReadout.h"
+#include "CoalescingSlider.h"
 
 
 using namespace juce;
 
 
-class RotaryKnob_GearShaped : public Slider
+class RotaryKnob_GearShaped : public CoalescingSlider
 {
 public:
 	RotaryKnob_GearShaped();
 
 	~RotaryKnob_GearShaped();
 
+	/** Returns the position of the pointer tip along its arc, in physical pixels. */
+	int getQuantisedPointerPosition(float physicalPixelScale);
+
+	/** Paints the value instead of using a Label text box. Double-click the value to type one. */
+	void setPaintedValueReadout(bool shouldPaintValueReadout);
+
+	/** Draws the knob from signed distance functions instead of paths (see GearSdfRenderer). */
+	void setSdfRendering(bool shouldUseSdfRendering);
+
+	/** Overlays the rough plastic texture on the gear (see MaterialTexture). */
+	void setSurfaceMaterial(bool shouldUseSurfaceMaterial);
+
 
 private:
 	RotaryKnob_GearShaped_LookAndFeel rotaryKnob_GearShaped_LookAndFeel;
+
+	/** Draws the knob on the fast path while it's dragged. */
+	InteractionQuality interactionQuality;
+
+	/** Handles the painted value readout, when it's used. */
+	PaintedValueReadout paintedValueReadout;
 	
 };
@@ -1,4 +1,5 @@
 #include "WaveformButton.h"
+#include "../Benchmark/PaintTrace.h"
 
 
 WaveformButton::WaveformButton(const juce::String& buttonName)
@@ -22,6 +23,30 @@ WaveformButton::~WaveformButton()
 
 void WaveformButton::paintButton(Graphics& g, bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown)
 {
+    PaintTrace::recordButton(ControlType::waveformButton, g, *this, (int)getWaveform(),
+        shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
+
+    /**
+     * Each state is rendered once per size, scale, waveform and theme into the shared render cache,
+     * and then drawn from its image.
+     */
+    const auto buttonState = waveformButton_LookAndFeel.getButtonState(getToggleState(),
+        shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
+
+    const auto stateImage = renderCache->getImage(
+        getStateImageKey(g, buttonState),
+        Image::ARGB,
+        [this, buttonState](Graphics& imageGraphics) { paintState(imageGraphics, buttonState); },
+        this);
+
+    g.drawImage(stateImage, getLocalBounds().toFloat());
+}
+
+void WaveformButton::paintState(Graphics& g, WaveformButton_LookAndFeel::ButtonState buttonState)
+{
+    const bool shouldDrawButtonAsHighlighted = buttonState == WaveformButton_LookAndFeel::overState;
+    const bool shouldDrawButtonAsDown = buttonState == WaveformButton_LookAndFeel::downState;
+
     /** Draw button background. */
     waveformButton_LookAndFeel.drawButtonBackground(g, *this, waveformButton_LookAndFeel.getButtonBackgroundColour(),
         shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
@@ -30,8 +55,24 @@ void WaveformButton::paintButton(Graphics& g, bool shouldDrawButtonAsHighlighted
     waveformButton_LookAndFeel.drawButtonBody(g, *this, shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
 
     /** Draw the waveform shape */
-    waveformButton_LookAndFeel.drawWaveformShape(g, waveformButton_LookAndFeel.Sawtooth,
+    waveformButton_LookAndFeel.drawWaveformShape(g, getWaveform(),
         this->getLocalBounds(), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
+
+    numStateImagesRendered++;
+}
+
+RenderCache::Key WaveformButton::getStateImageKey(Graphics& g, WaveformButton_LookAndFeel::ButtonState buttonState)
+{
+    auto key = RenderCache::makeKey(ControlType::waveformButton, (int)buttonState, getWidth(), getHeight(), g, (int64)getWaveform());
+    key.themeVersion = waveformButton_LookAndFeel.getThemeVersion();
+
+    return key;
+}
+
+WaveformButton_LookAndFeel::ButtonState WaveformButton::getRenderedState()
+{
+    return waveformButton_LookAndFeel.getButtonState(getToggleState(),
+        isOver() || isDown(), isDown());
 }
 
 void WaveformButton::setWaveform(WaveformButton_LookAndFeel::Waveform newWaveform)
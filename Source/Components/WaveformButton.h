@@ -3,6 +3,7 @@
 
 #include "JuceHeader.h"
 #include "..\LookAndFeels\WaveformButton_LookAndFeel.h"
+#include "..\Rendering\RenderCache.h"
 
 
 using namespace juce;
@@ -21,8 +22,29 @@ public:
 	void setWaveform(WaveformButton_LookAndFeel::Waveform newWaveform);
 
 	WaveformButton_LookAndFeel::Waveform getWaveform();
+
+	/**
+	 * Returns the state the button is currently drawn in.
+	 * States that are drawn the same return the same value, so changes between them don't need a repaint.
+	 */
+	WaveformButton_LookAndFeel::ButtonState getRenderedState();
+
+	/** Number of button state images rendered by this button so far. Images rendered by identical buttons are reused. */
+	int getNumStateImagesRendered() const { return numStateImagesRendered; }
+
 private:
+	/** Paints a button state in logical coordinates. */
+	void paintState(Graphics& g, WaveformButton_LookAndFeel::ButtonState buttonState);
+
+	/** Returns the cache key of the image of a button state: its size, scale, waveform and theme. */
+	RenderCache::Key getStateImageKey(Graphics& g, WaveformButton_LookAndFeel::ButtonState buttonState);
+
 	WaveformButton_LookAndFeel waveformButton_LookAndFeel;
 	
 	float toggleButtonCornerSize = 10.f;
+
+	/** Rendered images of the button states, shared with every identical button. */
+	SharedResourcePointer<RenderCache> renderCache;
+
+	int numStateImagesRendered = 0;
 };
@@ -0,0 +1,205 @@
+/*
+  ==============================================================================
+
+    WaveformSelector.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "WaveformSelector.h"
+#include "../Benchmark/PaintTrace.h"
+
+WaveformSelector::WaveformSelector()
+	: WaveformSelector({ WaveformButton_LookAndFeel::Sawtooth, WaveformButton_LookAndFeel::Pulse,
+		WaveformButton_LookAndFeel::Triangle, WaveformButton_LookAndFeel::Sinewave, WaveformButton_LookAndFeel::Noise })
+{
+}
+
+WaveformSelector::WaveformSelector(const juce::Array<WaveformButton_LookAndFeel::Waveform>& waveforms)
+{
+	setOptions(waveforms);
+	setRepaintsOnMouseActivity(false);
+}
+
+void WaveformSelector::setOptions(const juce::Array<WaveformButton_LookAndFeel::Waveform>& waveforms)
+{
+	options = waveforms;
+	selectedIndex = options.isEmpty() ? -1 : 0;
+	hoveredIndex = -1;
+	pressedIndex = -1;
+
+	repaint();
+}
+
+void WaveformSelector::setSelectedIndex(int newIndex, juce::NotificationType notification)
+{
+	if (!juce::isPositiveAndBelow(newIndex, options.size()) || newIndex == selectedIndex)
+		return;
+
+	const int previousIndex = selectedIndex;
+	const auto previousState = getSegmentState(previousIndex);
+	const auto newIndexPreviousState = getSegmentState(newIndex);
+
+	selectedIndex = newIndex;
+
+	repaintSegmentIfChanged(previousIndex, previousState);
+	repaintSegmentIfChanged(newIndex, newIndexPreviousState);
+
+	if (notification == juce::dontSendNotification || onChange == nullptr)
+		return;
+
+	if (notification == juce::sendNotificationAsync)
+	{
+		juce::Component::SafePointer<WaveformSelector> safeThis(this);
+		juce::MessageManager::callAsync([safeThis]
+			{
+				if (safeThis != nullptr && safeThis->onChange != nullptr)
+					safeThis->onChange();
+			});
+	}
+	else
+	{
+		onChange();
+	}
+}
+
+void WaveformSelector::setSelectedWaveform(WaveformButton_LookAndFeel::Waveform waveform, juce::NotificationType notification)
+{
+	setSelectedIndex(options.indexOf(waveform), notification);
+}
+
+WaveformButton_LookAndFeel::Waveform WaveformSelector::getSelectedWaveform() const
+{
+	return options[selectedIndex];
+}
+
+void WaveformSelector::setHoveredIndex(int newIndex)
+{
+	if (newIndex == hoveredIndex)
+		return;
+
+	const int previousIndex = hoveredIndex;
+	const auto previousState = getSegmentState(previousIndex);
+	const auto newIndexPreviousState = getSegmentState(newIndex);
+
+	hoveredIndex = newIndex;
+
+	repaintSegmentIfChanged(previousIndex, previousState);
+	repaintSegmentIfChanged(newIndex, newIndexPreviousState);
+}
+
+int WaveformSelector::getSegmentAt(juce::Point<int> position) const
+{
+	for (int i = 0; i < options.size(); i++)
+	{
+		if (getSegmentBounds(i).contains(position))
+			return i;
+	}
+
+	return -1;
+}
+
+juce::Rectangle<int> WaveformSelector::getSegmentBounds(int index) const
+{
+	if (!juce::isPositiveAndBelow(index, options.size()))
+		return {};
+
+	const int numOptions = options.size();
+	const bool vertical = getHeight() > getWidth();
+	const int length = (vertical ? getHeight() : getWidth()) + segmentGap;
+
+	/** Each segment gets an equal share of the length, including the gap after it. */
+	const int start = index * length / numOptions;
+	const int end = (index + 1) * length / numOptions - segmentGap;
+
+	return vertical ? juce::Rectangle<int>(0, start, getWidth(), end - start)
+		: juce::Rectangle<int>(start, 0, end - start, getHeight());
+}
+
+void WaveformSelector::paint(juce::Graphics& g)
+{
+	PaintTrace::recordComponent(ControlType::waveformSelector, g, *this, (float)hoveredIndex, selectedIndex, hoveredIndex >= 0);
+
+	for (int i = 0; i < options.size(); i++)
+	{
+		const auto segmentBounds = getSegmentBounds(i);
+
+		/** Only the segments that were repainted. */
+		if (!g.clipRegionIntersects(segmentBounds))
+			continue;
+
+		const auto state = getSegmentState(i);
+
+		lookAndFeel->drawButtonBody(g, segmentBounds,
+			state == WaveformButton_LookAndFeel::overState, state == WaveformButton_LookAndFeel::downState);
+
+		/** The waveform shape, from the glyph cache shared by all the selectors. */
+		const auto waveform = options.getUnchecked(i);
+		const auto glyph = glyphCache->getMask(
+			RenderCache::makeKey(ControlType::waveformSelector, glyphLayer, segmentBounds.getWidth(), segmentBounds.getHeight(), g, waveform),
+			[this, waveform, segmentBounds](juce::Graphics& glyphGraphics)
+			{
+				lookAndFeel->drawWaveformShape(glyphGraphics, waveform, segmentBounds.withZeroOrigin(), false, false);
+			}, this);
+
+		RenderCache::drawMask(g, glyph, segmentBounds.toFloat(), lookAndFeel->getWaveformColour());
+	}
+}
+
+void WaveformSelector::mouseMove(const juce::MouseEvent& event)
+{
+	setHoveredIndex(getSegmentAt(event.getPosition()));
+}
+
+void WaveformSelector::mouseExit(const juce::MouseEvent&)
+{
+	setHoveredIndex(-1);
+}
+
+void WaveformSelector::mouseDown(const juce::MouseEvent& event)
+{
+	const int index = getSegmentAt(event.getPosition());
+	setHoveredIndex(index);
+
+	const auto previousState = getSegmentState(index);
+
+	pressedIndex = index;
+	repaintSegmentIfChanged(index, previousState);
+}
+
+void WaveformSelector::mouseDrag(const juce::MouseEvent& event)
+{
+	/** Like a button, a segment is drawn pressed only while the mouse is over it. */
+	setHoveredIndex(getSegmentAt(event.getPosition()));
+}
+
+void WaveformSelector::mouseUp(const juce::MouseEvent& event)
+{
+	const int index = pressedIndex;
+	const auto previousState = getSegmentState(index);
+
+	pressedIndex = -1;
+	repaintSegmentIfChanged(index, previousState);
+
+	/** Radio group: releasing over the pressed segment selects it, selecting never deselects. */
+	if (index >= 0 && getSegmentAt(event.getPosition()) == index)
+		setSelectedIndex(index);
+}
+
+WaveformButton_LookAndFeel::ButtonState WaveformSelector::getSegmentState(int index)
+{
+	if (!juce::isPositiveAndBelow(index, options.size()))
+		return WaveformButton_LookAndFeel::normalState;
+
+	const bool isHovered = index == hoveredIndex;
+
+	return lookAndFeel->getButtonState(index == selectedIndex, isHovered, isHovered && index == pressedIndex);
+}
+
+void WaveformSelector::repaintSegmentIfChanged(int index, WaveformButton_LookAndFeel::ButtonState previousState)
+{
+	if (juce::isPositiveAndBelow(index, options.size()) && getSegmentState(index) != previousState)
+		repaint(getSegmentBounds(index));
+}
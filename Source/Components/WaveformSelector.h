@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    WaveformSelector.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../LookAndFeels/WaveformButton_LookAndFeel.h"
+#include "../Rendering/RenderCache.h"
+
+/**
+ * A radio group of waveforms in a single component.
+ *
+ * Replaces a row or column of WaveformButtons: all segments are painted in
+ * one paint, the waveform shapes come from a glyph cache shared by every
+ * selector, and hit-testing is done internally. Selection and hover changes
+ * only repaint the segments that change.
+ * The segments are laid out along the longest side of the component.
+ */
+class WaveformSelector : public juce::Component
+{
+public:
+	/** Creates a selector with all the waveforms. */
+	WaveformSelector();
+
+	/** Creates a selector with the given waveforms, in that order. */
+	explicit WaveformSelector(const juce::Array<WaveformButton_LookAndFeel::Waveform>& waveforms);
+
+	/** Sets the waveforms to choose from. The first one is selected. */
+	void setOptions(const juce::Array<WaveformButton_LookAndFeel::Waveform>& waveforms);
+
+	int getNumOptions() const { return options.size(); }
+
+	/** Selects a segment. onChange is called if notification is not dontSendNotification. */
+	void setSelectedIndex(int newIndex, juce::NotificationType notification = juce::sendNotificationAsync);
+
+	int getSelectedIndex() const { return selectedIndex; }
+
+	/** Selects a waveform, if it is one of the options. */
+	void setSelectedWaveform(WaveformButton_LookAndFeel::Waveform waveform, juce::NotificationType notification = juce::sendNotificationAsync);
+
+	WaveformButton_LookAndFeel::Waveform getSelectedWaveform() const;
+
+	/** Sets the segment drawn highlighted, -1 for none. Normally follows the mouse. */
+	void setHoveredIndex(int newIndex);
+
+	int getHoveredIndex() const { return hoveredIndex; }
+
+	/** Returns the segment at a position, or -1 if it is between or outside the segments. */
+	int getSegmentAt(juce::Point<int> position) const;
+
+	/** Returns the bounds of a segment. */
+	juce::Rectangle<int> getSegmentBounds(int index) const;
+
+	/** Called when the selection changes. */
+	std::function<void()> onChange;
+
+	/** Component */
+	void paint(juce::Graphics& g) override;
+	void mouseMove(const juce::MouseEvent& event) override;
+	void mouseExit(const juce::MouseEvent& event) override;
+	void mouseDown(const juce::MouseEvent& event) override;
+	void mouseDrag(const juce::MouseEvent& event) override;
+	void mouseUp(const juce::MouseEvent& event) override;
+
+private:
+	/** Returns the state a segment is drawn in. */
+	WaveformButton_LookAndFeel::ButtonState getSegmentState(int index);
+
+	/** Repaints a segment if its drawn state differs from the given one. */
+	void repaintSegmentIfChanged(int index, WaveformButton_LookAndFeel::ButtonState previousState);
+
+	/** Space between segments, the same as between the waveform buttons in MainComponent. */
+	static constexpr int segmentGap = 5;
+
+	/** Cached layers. */
+	enum CachedLayer
+	{
+		glyphLayer
+	};
+
+	/** One LookAndFeel and one glyph cache for every selector. */
+	juce::SharedResourcePointer<WaveformButton_LookAndFeel> lookAndFeel;
+	juce::SharedResourcePointer<RenderCache> glyphCache;
+
+	juce::Array<WaveformButton_LookAndFeel::Waveform> options;
+	int selectedIndex = 0;
+	int hoveredIndex = -1;
+	int pressedIndex = -1;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveformSelector)
+};
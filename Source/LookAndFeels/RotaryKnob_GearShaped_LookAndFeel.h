@@ -3,6 +3,15 @@
 
 #include "JuceHeader.h"
 #include "..\Shapes\Shapes.h"
+#include "..\Benchmark\PaintTrace.h"
+#include "..\Rendering\RenderCache.h"
+#include "..\Rendering\LevelOfDetail.h"
+#include "..\Rendering\InteractionQuality.h"
+#include "..\Rendering\DigitGlyphAtlas.h"
+#include "..\Rendering\Theme.h"
+#include "..\Rendering\GearSdfRenderer.h"
+#include "..\Rendering\BoxBlurShadow.h"
+#include "..\Rendering\MaterialTexture.h"
 
 
 using namespace juce;
@@ -35,6 +44,8 @@ public:
 	void drawRotarySlider(Graphics& g, int x, int y, int width, int height,
 		float sliderPosProportional, float rotaryStartAngle, float rotaryEndAngle, Slider& slider) override
 	{
+		PaintTrace::recordSlider(ControlType::gearKnob, g, slider);
+
 		constexpr int numberOfSides = 8;
 		constexpr float numberOfRadiansPerSide = 2 * MathConstants<float>::pi / numberOfSides;
 
@@ -46,6 +57,13 @@ public:
 
 		float angle = rotaryStartAngle + (sliderPosProportional * (rotaryEndAngle - rotaryStartAngle));
 
+		/** Level of detail, based on the knob diameter. Fast path while the knob is dragged or resized. */
+		const auto renderOptions = InteractionQuality::getOptions(slider, levelOfDetail.getOptionsForSize(totalDiameter));
+		g.setImageResamplingQuality(renderOptions.resamplingQuality);
+
+		const auto theme = getTheme();
+		const auto& colours = theme->getColours();
+
 //#ifdef DEBUG
 //		/** Helper circle - max within bounds */
 //		g.setColour(Colours::darkred);
@@ -58,49 +76,105 @@ public:
 //		);
 //#endif // DEBUG
 
-		/** Knob outer circle. The outer gear shape edges should touch this circle. */
-		float knobGearOuterDiameter = 0.9f * totalDiameter;
-		float knobGearOuterRadius = knobGearOuterDiameter / 2.f;
-
-		/** Knob inner circle. The inner gear shape edges should touch this circle. */
-		float knobGearInnerDiameter = 0.75 * totalDiameter;
-
+		/**
+		 * Min-Max lines and labels, cached as an alpha mask the size of the slider.
+		 */
+		const auto minMaxMask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::gearKnob, renderOptions.drawLabels ? minMaxLayer : minMaxLinesOnlyLayer,
+				slider.getWidth(), slider.getHeight(), g, getAnglesVariant(rotaryStartAngle, rotaryEndAngle)),
+			[this, totalCenterX, totalCenterY, totalRadius, totalDiameter, rotaryStartAngle, rotaryEndAngle, renderOptions](Graphics& maskGraphics)
+			{
+				paintMinMaxLines(maskGraphics, totalCenterX, totalCenterY, totalRadius, (float)totalDiameter, rotaryStartAngle, rotaryEndAngle,
+					renderOptions.drawLabels);
+			}, &slider);
+		RenderCache::drawMask(g, minMaxMask, slider.getLocalBounds().toFloat(), colours.knobMinMax);
+
+
+		/** Disk, pointer, gear and their shadow and gradients */
+		GearSdfRenderer::Parameters knob;
+		knob.centre = { totalCenterX, totalCenterY };
+		knob.totalDiameter = (float)totalDiameter;
+		knob.angle = angle;
+		knob.diskColour = colours.knobDisk;
+		knob.pointerColour = colours.knobPointer;
+		knob.gearColour = colours.knobGear;
+		knob.shadow = gearShadow;
+		knob.drawShadow = renderOptions.drawShadows;
+		knob.useGradients = renderOptions.useGradients;
 
 		/**
-		 * Min-Max lines.
+		 * The distance field only has the full 8 sided gear, so simplified geometry is still drawn from paths,
+		 * and so are knobs too small for its shadow to match the blurred one.
 		 */
-		Path minMaxLines;
-		minMaxLines.addArc(totalCenterX - totalRadius, totalCenterY - totalRadius,
-			totalDiameter, totalDiameter,
-			rotaryStartAngle, rotaryEndAngle, true);
+		if (sdfRendering && !renderOptions.simplifiedGeometry && totalDiameter >= GearSdfRenderer::minDiameter)
+			gearSdfRenderer.draw(g, knob);
+		else
+			drawKnob(g, knob, renderOptions.simplifiedGeometry);
 
-		PathStrokeType strokeType = PathStrokeType::PathStrokeType(1.f);
-		g.setColour(Colours::beige);
-		g.strokePath(minMaxLines, strokeType);
+		/** Surface material over the gear, with the gradients it is a detail of */
+		if (surfaceMaterial && renderOptions.useGradients && !renderOptions.simplifiedGeometry)
+			drawGearMaterial(g, numberOfSides, totalDiameter, totalCenterX, totalCenterY, angle, slider);
 
-		/** Minimum line */
-		Line<float> minLine = Line<float>(totalCenterX, totalCenterY - totalRadius, totalCenterX, totalCenterY - totalRadius + totalRadius / 6.f);
-		minLine.applyTransform(AffineTransform::rotation(rotaryStartAngle, totalCenterX, totalCenterY));
-		g.drawLine(minLine, 1.f);
+		/** Value readout, when the knob has no text box */
+		if (paintedValueReadout && slider.getTextBoxPosition() == Slider::NoTextBox)
+		{
+			const auto textBoxBounds = getSliderLayout(slider).textBoxBounds;
 
-		/** Minimum line */
-		Line<float> maxLine = Line<float>(totalCenterX, totalCenterY - totalRadius, totalCenterX, totalCenterY - totalRadius + totalRadius / 6.f);
-		maxLine.applyTransform(AffineTransform::rotation(rotaryEndAngle, totalCenterX, totalCenterY));
-		g.drawLine(maxLine, 1.f);
+			digitGlyphAtlas->drawValue(g, slider, textBoxBounds,
+				jmin(15.f, textBoxBounds.getHeight() * 0.8f), colours.text);
+		}
+
+	}
+
+	/** Draws the text box of the rotary knob. */
+	Label* createSliderTextBox(Slider& slider) override
+	{
+		///** Slider text box number of decimal places to display */
+		//slider.setNumDecimalPlacesToDisplay(numberOfDecimalPlaces);
+
+		juce::Label* sliderTextBoxPtr = LookAndFeel_V4::createSliderTextBox(slider);
 
-		/** Min label */
-		g.drawFittedText("Min", totalCenterX - totalRadius, totalCenterY + totalRadius,
-			totalRadius / 2.f, totalRadius / 6.f, Justification::centred, 1);
-		/** Max label */
-		g.drawFittedText("Max", totalCenterX + totalRadius / 2.f, totalCenterY + totalRadius,
-			totalRadius / 2.f, totalRadius / 6.f, Justification::centred, 1);
+		const auto theme = getTheme();
 
+		sliderTextBoxPtr->setColour(juce::Label::textColourId, theme->getColours().text);
+		sliderTextBoxPtr->setColour(juce::Label::backgroundColourId, juce::Colours::transparentBlack);
+		sliderTextBoxPtr->setColour(juce::Label::outlineColourId, juce::Colours::transparentBlack);
+		sliderTextBoxPtr->setColour(juce::Label::textWhenEditingColourId, theme->getColours().text);
+		sliderTextBoxPtr->setColour(juce::Label::backgroundWhenEditingColourId, theme->getColours().textEditorBackground);
+		sliderTextBoxPtr->setColour(juce::Label::outlineWhenEditingColourId, theme->getColours().text);
+
+		// ToDo: Fix text box justification when editing the value
+
+		return sliderTextBoxPtr;
+	}
+
+
+	/**
+	 * Draws the disk, the pointer and the gear, with the gear's shadow and the light reflection gradients, from paths.
+	 * This is what the SDF renderer is matched against (see setSdfRendering()).
+	 */
+	void drawKnob(Graphics& g, const GearSdfRenderer::Parameters& knob, bool simplifiedGeometry)
+	{
+		constexpr int numberOfSides = 8;
+
+		const float totalDiameter = knob.totalDiameter;
+		const float totalRadius = totalDiameter / 2.f;
+		const float totalCenterX = knob.centre.x;
+		const float totalCenterY = knob.centre.y;
+		const float angle = knob.angle;
+
+		/** Knob outer circle. The outer gear shape edges should touch this circle. */
+		float knobGearOuterDiameter = 0.9f * totalDiameter;
+		float knobGearOuterRadius = knobGearOuterDiameter / 2.f;
+
+		/** Knob inner circle. The inner gear shape edges should touch this circle. */
+		float knobGearInnerDiameter = 0.75 * totalDiameter;
 
 		/****************************************************************************
 		 * Disk at the bottom of the knob.
 		 */
 		 /** Base colour */
-		g.setColour(Colours::black.brighter(0.03));
+		g.setColour(knob.diskColour);
 		g.fillEllipse
 		(
 			totalCenterX - knobGearOuterRadius,
@@ -109,18 +183,21 @@ public:
 			knobGearOuterDiameter
 		);
 		/** Light reflection. */
-		ColourGradient backDiskGradient = ColourGradient(
-			Colours::white.withAlpha(0.15f), totalCenterX + knobGearOuterRadius / 2.f, totalCenterY - knobGearOuterRadius,
-			Colours::black.withAlpha(0.1f), totalCenterX - knobGearOuterRadius / 2.f, totalCenterY + knobGearOuterRadius,
-			true);
-		g.setGradientFill(backDiskGradient);
-		g.fillEllipse
-		(
-			totalCenterX - knobGearOuterRadius,
-			totalCenterY - knobGearOuterRadius,
-			knobGearOuterDiameter,
-			knobGearOuterDiameter
-		);
+		if (knob.useGradients)
+		{
+			ColourGradient backDiskGradient = ColourGradient(
+				Colours::white.withAlpha(0.15f), totalCenterX + knobGearOuterRadius / 2.f, totalCenterY - knobGearOuterRadius,
+				Colours::black.withAlpha(0.1f), totalCenterX - knobGearOuterRadius / 2.f, totalCenterY + knobGearOuterRadius,
+				true);
+			g.setGradientFill(backDiskGradient);
+			g.fillEllipse
+			(
+				totalCenterX - knobGearOuterRadius,
+				totalCenterY - knobGearOuterRadius,
+				knobGearOuterDiameter,
+				knobGearOuterDiameter
+			);
+		}
 
 
 		/****************************************************************************
@@ -139,14 +216,16 @@ public:
 			totalCenterY)
 		);
 
-		g.setColour(Colours::beige.darker(0.8));
+		g.setColour(knob.pointerColour);
 		g.fillPath(knobPointerPath);
 
 
 		/****************************************************************************
 		 * Gear shaped knob.
 		 */
-		Path gearShapedKnobPath = Shapes::getGearShapedPath(numberOfSides, totalDiameter, totalCenterX, totalCenterY, knobGearInnerDiameter);
+		Path gearShapedKnobPath = simplifiedGeometry
+			? Shapes::getSimplifiedGearShapedPath(numberOfSides, totalDiameter, totalCenterX, totalCenterY, knobGearInnerDiameter)
+			: Shapes::getGearShapedPath(numberOfSides, totalDiameter, totalCenterX, totalCenterY, knobGearInnerDiameter);
 		
 		/** Rotate the knob depending on value (angle) */
 		gearShapedKnobPath.applyTransform(AffineTransform::rotation(
@@ -154,46 +233,259 @@ public:
 			totalCenterX,
 			totalCenterY));
 		
-		DropShadow gearShadow = DropShadow(juce::Colours::black.withAlpha(0.5f), 20, juce::Point(-20, 20));
-		gearShadow.drawForPath(g, gearShapedKnobPath);
+		if (knob.drawShadow)
+			drawGearShadow(g, numberOfSides, roundToInt(totalDiameter), knobGearInnerDiameter, totalCenterX, totalCenterY, angle);
 		
 		/** Knob base colour */
-		g.setColour(Colours::black.brighter(0.05));
+		g.setColour(knob.gearColour);
 		g.fillPath(gearShapedKnobPath);
 
 		/** Gradient for light reflection effect. */
-		ColourGradient gearTopGradient = ColourGradient(
-			Colours::white.withAlpha(0.15f), totalCenterX + knobGearOuterRadius / 2.f, totalCenterY - knobGearOuterRadius,
-			Colours::black.withAlpha(0.1f), totalCenterX - knobGearOuterRadius / 2.f, totalCenterY + knobGearOuterRadius,
-			true);
-		g.setGradientFill(gearTopGradient);
-		g.fillPath(gearShapedKnobPath);
+		if (knob.useGradients)
+		{
+			ColourGradient gearTopGradient = ColourGradient(
+				Colours::white.withAlpha(0.15f), totalCenterX + knobGearOuterRadius / 2.f, totalCenterY - knobGearOuterRadius,
+				Colours::black.withAlpha(0.1f), totalCenterX - knobGearOuterRadius / 2.f, totalCenterY + knobGearOuterRadius,
+				true);
+			g.setGradientFill(gearTopGradient);
+			g.fillPath(gearShapedKnobPath);
+		}
+	}
+
+	/**
+	 * Paints the min-max arc, the min and max lines and, optionally, their labels.
+	 */
+	void paintMinMaxLines(Graphics& g, float totalCenterX, float totalCenterY, float totalRadius, float totalDiameter,
+		float rotaryStartAngle, float rotaryEndAngle, bool drawLabels)
+	{
+		Path minMaxLines;
+		minMaxLines.addArc(totalCenterX - totalRadius, totalCenterY - totalRadius,
+			totalDiameter, totalDiameter,
+			rotaryStartAngle, rotaryEndAngle, true);
+
+		PathStrokeType strokeType = PathStrokeType::PathStrokeType(1.f);
+		g.strokePath(minMaxLines, strokeType);
+
+		/** Minimum line */
+		Line<float> minLine = Line<float>(totalCenterX, totalCenterY - totalRadius, totalCenterX, totalCenterY - totalRadius + totalRadius / 6.f);
+		minLine.applyTransform(AffineTransform::rotation(rotaryStartAngle, totalCenterX, totalCenterY));
+		g.drawLine(minLine, 1.f);
+
+		/** Minimum line */
+		Line<float> maxLine = Line<float>(totalCenterX, totalCenterY - totalRadius, totalCenterX, totalCenterY - totalRadius + totalRadius / 6.f);
+		maxLine.applyTransform(AffineTransform::rotation(rotaryEndAngle, totalCenterX, totalCenterY));
+		g.drawLine(maxLine, 1.f);
 
+		if (drawLabels)
+		{
+			/** Min label */
+			g.drawFittedText("Min", totalCenterX - totalRadius, totalCenterY + totalRadius,
+				totalRadius / 2.f, totalRadius / 6.f, Justification::centred, 1);
+			/** Max label */
+			g.drawFittedText("Max", totalCenterX + totalRadius / 2.f, totalCenterY + totalRadius,
+				totalRadius / 2.f, totalRadius / 6.f, Justification::centred, 1);
+		}
 	}
 
-	/** Draws the text box of the rotary knob. */
-	Label* createSliderTextBox(Slider& slider) override
+	/**
+	 * Draws the shadow of the gear from a cached alpha mask of the shadow of an unrotated gear.
+	 * The shadow is blurred evenly in every direction, so rotating the mask matches rotating the gear.
+	 */
+	void drawGearShadow(Graphics& g, int numberOfSides, int totalDiameter, float knobGearInnerDiameter,
+		float totalCenterX, float totalCenterY, float angle)
 	{
-		///** Slider text box number of decimal places to display */
-		//slider.setNumDecimalPlacesToDisplay(numberOfDecimalPlaces);
+		const int padding = gearShadow.radius + 1;
+		const int maskSize = totalDiameter + 2 * padding;
+		const float maskCenter = maskSize / 2.f;
+
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::gearKnob, gearShadowLayer, maskSize, maskSize, g, numberOfSides),
+			[this, numberOfSides, totalDiameter, knobGearInnerDiameter, maskCenter](Graphics& maskGraphics)
+			{
+				BoxBlurShadow(Colours::white, gearShadow.radius, {}).drawForPath(maskGraphics,
+					Shapes::getGearShapedPath(numberOfSides, totalDiameter, maskCenter, maskCenter, knobGearInnerDiameter));
+			});
+
+		RenderCache::drawMaskTransformed(g, mask, maskSize, maskSize,
+			AffineTransform::translation(-maskCenter, -maskCenter)
+				.rotated(angle)
+				.translated(totalCenterX + gearShadow.offset.x, totalCenterY + gearShadow.offset.y),
+			gearShadow.colour);
+	}
 
-		juce::Label* sliderTextBoxPtr = LookAndFeel_V4::createSliderTextBox(slider);
 
-		sliderTextBoxPtr->setColour(juce::Label::textColourId, juce::Colours::beige);
-		sliderTextBoxPtr->setColour(juce::Label::backgroundColourId, juce::Colours::transparentBlack);
-		sliderTextBoxPtr->setColour(juce::Label::outlineColourId, juce::Colours::transparentBlack);
-		sliderTextBoxPtr->setColour(juce::Label::textWhenEditingColourId, juce::Colours::beige);
-		sliderTextBoxPtr->setColour(juce::Label::backgroundWhenEditingColourId, juce::Colours::black);
-		sliderTextBoxPtr->setColour(juce::Label::outlineWhenEditingColourId, juce::Colours::beige);
+	/**
+	 * Draws the surface material over the gear from a cached layer of an unrotated gear filled with it.
+	 * The layer is rotated with the knob, so turning the knob doesn't render it again.
+	 */
+	void drawGearMaterial(Graphics& g, int numberOfSides, int totalDiameter,
+		float totalCenterX, float totalCenterY, float angle, Slider& slider)
+	{
+		const float layerCenter = totalDiameter / 2.f;
+
+		const auto layer = renderCache->getImage(
+			RenderCache::makeKey(ControlType::gearKnob, gearMaterialLayer, totalDiameter, totalDiameter, g, numberOfSides),
+			Image::ARGB,
+			[this, numberOfSides, totalDiameter, layerCenter](Graphics& layerGraphics)
+			{
+				materialTexture->fillPath(layerGraphics,
+					Shapes::getGearShapedPath(numberOfSides, (float)totalDiameter, layerCenter, layerCenter, 0.75f * totalDiameter),
+					materialOpacity);
+			}, &slider);
+
+		g.drawImageTransformed(layer,
+			AffineTransform::scale((float)totalDiameter / layer.getWidth(), (float)totalDiameter / layer.getHeight())
+				.translated(-layerCenter, -layerCenter)
+				.rotated(angle)
+				.translated(totalCenterX, totalCenterY));
+	}
 
-		// ToDo: Fix text box justification when editing the value
 
-		return sliderTextBoxPtr;
+	/**
+	 * Draws the value in the text box area when the knob has no text box (see PaintedValueReadout),
+	 * instead of using a Label component.
+	 */
+	void setPaintedValueReadout(bool shouldPaintValueReadout)
+	{
+		paintedValueReadout = shouldPaintValueReadout;
+	}
+
+	bool getPaintedValueReadout()
+	{
+		return paintedValueReadout;
+	}
+
+	/**
+	 * Draws the disk, pointer and gear from signed distance functions in one pass over the pixels
+	 * (see GearSdfRenderer) instead of filling paths. Knobs drawn with simplified geometry, or smaller than
+	 * GearSdfRenderer::minDiameter, still use paths.
+	 * Turning it off frees the image the knob was rendered into.
+	 */
+	void setSdfRendering(bool shouldUseSdfRendering)
+	{
+		sdfRendering = shouldUseSdfRendering;
+
+		if (!sdfRendering)
+			gearSdfRenderer.releaseResources();
+	}
+
+	bool getSdfRendering()
+	{
+		return sdfRendering;
+	}
+
+	/**
+	 * Overlays the rough plastic texture on the gear (see MaterialTexture).
+	 * Not drawn at the levels of detail without gradients or with simplified geometry.
+	 */
+	void setSurfaceMaterial(bool shouldUseSurfaceMaterial)
+	{
+		surfaceMaterial = shouldUseSurfaceMaterial;
+	}
+
+	bool getSurfaceMaterial()
+	{
+		return surfaceMaterial;
+	}
+
+	/**
+	 * Returns the theme the knob is drawn with: the current theme,
+	 * or this LookAndFeel's own snapshot if one was set.
+	 */
+	Theme::Ptr getTheme() const
+	{
+		return ownTheme != nullptr ? ownTheme : Theme::getCurrent();
+	}
+
+	/** Draws with a theme of its own. Pass nullptr to follow the current theme again. */
+	void setTheme(Theme::Ptr newTheme)
+	{
+		ownTheme = std::move(newTheme);
+	}
+
+	/** Sets the knob diameters where the level of detail changes */
+	void setLevelOfDetailThresholds(LevelOfDetail::Thresholds newThresholds)
+	{
+		levelOfDetail.setThresholds(newThresholds);
+	}
+
+	LevelOfDetail::Thresholds getLevelOfDetailThresholds()
+	{
+		return levelOfDetail.getThresholds();
+	}
+
+	/** Returns the level of detail the knob is drawn at */
+	LevelOfDetail::Tier getLevelOfDetailTier(Slider& slider)
+	{
+		const auto sliderBounds = getSliderLayout(slider).sliderBounds;
+		return levelOfDetail.getTier(jmin(sliderBounds.getWidth(), sliderBounds.getHeight()));
+	}
+
+
+	/**
+	 * Returns the position of the pointer tip along its arc, in physical pixels.
+	 * When this doesn't change the pointer and the gear rotate by less than a physical pixel,
+	 * so the knob doesn't need a repaint for it.
+	 *
+	 * \param physicalPixelScale Physical pixels per logical pixel of the knob.
+	 */
+	int getQuantisedPointerPosition(Slider& slider, float physicalPixelScale)
+	{
+		const auto sliderBounds = getSliderLayout(slider).sliderBounds;
+		const auto rotaryParameters = slider.getRotaryParameters();
+		const auto proportion = (float)slider.valueToProportionOfLength(slider.getValue());
+
+		const float angle = rotaryParameters.startAngleRadians
+			+ proportion * (rotaryParameters.endAngleRadians - rotaryParameters.startAngleRadians);
+		/** The pointer tip and the gear teeth are on the knob outer circle, 0.9 of the diameter. */
+		const float tipRadius = 0.45f * jmin(sliderBounds.getWidth(), sliderBounds.getHeight());
+
+		return roundToInt(angle * tipRadius * physicalPixelScale);
 	}
 
 	
 private:
 	static constexpr int numberOfDecimalPlaces = 2;
+
+	/** Packs the rotary start and end angles into a cache key variant. */
+	static int64 getAnglesVariant(float rotaryStartAngle, float rotaryEndAngle)
+	{
+		return ((int64)roundToInt(rotaryStartAngle * 10000.f) << 32) | (uint32)roundToInt(rotaryEndAngle * 10000.f);
+	}
+
+	/** Colours, when they differ from the current theme */
+	Theme::Ptr ownTheme;
+
+	/** Shadow under the gear. */
+	const BoxBlurShadow gearShadow = BoxBlurShadow(juce::Colours::black.withAlpha(0.5f), 20, juce::Point(-20, 20));
+
+	/** Cached layers. Single-colour layers are stored as alpha masks and tinted when drawn. */
+	enum CachedLayer
+	{
+		minMaxLayer,
+		minMaxLinesOnlyLayer,
+		gearShadowLayer,
+		gearMaterialLayer
+	};
+
+	/** Layers are shared with every other control in the process */
+	SharedResourcePointer<RenderCache> renderCache;
+
+	/** Level of detail, measured on the knob diameter */
+	LevelOfDetail levelOfDetail = LevelOfDetail({ 48, 256 });
+
+	/** Painted value readout */
+	bool paintedValueReadout = false;
+	SharedResourcePointer<DigitGlyphAtlas> digitGlyphAtlas;
+
+	/** SDF rendering */
+	bool sdfRendering = false;
+	GearSdfRenderer gearSdfRenderer;
+
+	/** Surface material */
+	static constexpr float materialOpacity = 0.25f;
+	bool surfaceMaterial = false;
+	SharedResourcePointer<MaterialTexture> materialTexture;
 	
 	///** Returns a gear shaped path */
 	//Path getGearShapedPath(int numberOfSides, float totalDiameter, float totalCenterX, float totalCenterY, float knobGearInnerDiameter)
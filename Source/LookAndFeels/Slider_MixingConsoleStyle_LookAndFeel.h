@@ -1,7 +1,7 @@
 /*****************************************************************//**
  * \file   LookAndFeels.h
  * \brief  A linear slider for use on level controls.
- * The orientation is set automatically based on the width/height given.
+ * The orientation follows the slider style: LinearVertical, or horizontal otherwise.
  * Currently optimised for code readability because I'm still learning.
  * 
  * \author George Georgiadis
@@ -11,38 +11,30 @@
 
 
 #include "JuceHeader.h"
+#include "../Benchmark/PaintTrace.h"
+#include "../Rendering/RenderCache.h"
+#include "../Rendering/LevelOfDetail.h"
+#include "../Rendering/InteractionQuality.h"
+#include "../Rendering/DigitGlyphAtlas.h"
+#include "../Rendering/Theme.h"
+#include "../Rendering/FaderRenderer.h"
+#include "../Rendering/RoundedRectRasteriser.h"
+#include "../Rendering/BoxBlurShadow.h"
+#include "../Rendering/MaterialTexture.h"
 /**
  * A linear slider for use on level controls.
- * The orientation is set automatically based on the width/height given.
+ * The orientation follows the slider style: LinearVertical, or horizontal otherwise.
+ * FaderOrientation::getSliderStyle() picks the style for a size, when setting the slider up.
  */
 class Slider_MixingConsoleStyle_LookAndFeel : public juce::LookAndFeel_V4
 {
 public:
-	/** Determines the layout - th part where the slider and the textbox are drawn */
+	/** Determines the layout - th part where the slider and the textbox are drawn.
+	 * The orientation is the slider's style and the range is the slider's own (0 to 1 in steps of 0.01
+	 * for a level), both set up with the slider and never changed here. */
 	juce::Slider::SliderLayout getSliderLayout(juce::Slider& slider) override
 	{
-		if (slider.getSliderStyle() == juce::Slider::SliderStyle::LinearVertical)
-		{
-			juce::Rectangle localBounds = slider.getLocalBounds();
-
-			juce::Slider::SliderLayout layout;
-
-			layout.sliderBounds = localBounds.removeFromTop(localBounds.getHeight() * 11 / 12);
-			layout.textBoxBounds = localBounds;
-
-			return layout;
-		}
-		else if (slider.getSliderStyle() == juce::Slider::SliderStyle::LinearHorizontal)
-		{
-			juce::Rectangle localBounds = slider.getLocalBounds();
-
-			juce::Slider::SliderLayout layout;
-
-			layout.sliderBounds = localBounds.removeFromTop(localBounds.getHeight() * 9 / 12);
-			layout.textBoxBounds = localBounds;
-
-			return layout;
-		}
+		return getFaderLayoutForStyle(slider);
 	}
 
 	/** Draws the slider */
@@ -50,8 +42,11 @@ public:
 		int height, float sliderPos, float minSliderPos, float maxSliderPos,
 		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
 	{
-		/** Slider value range */
-		slider.setRange(juce::Range<double>(0, 1), 0.01);
+		PaintTrace::recordSlider(ControlType::mixingConsoleFader, g, slider);
+
+		/** Level of detail, based on the length of the slider. Fast path while the slider is dragged or resized. */
+		const auto renderOptions = InteractionQuality::getOptions(slider, levelOfDetail.getOptionsForSize(juce::jmax(width, height)));
+		g.setImageResamplingQuality(renderOptions.resamplingQuality);
 
 		/** Background. */
 		drawLinearSliderBackground(g, x, y, width, height, sliderPos, minSliderPos, maxSliderPos, sliderStyle, slider);
@@ -59,8 +54,12 @@ public:
 		/** Outline. */
 		drawLinearSliderOutline(g, x, y, width, height, sliderStyle, slider);
 
-		/** Draw the rest of the slider elements that are orientation-specific */
-		drawSliderElements(g, x, y, width, height, sliderPos, minSliderPos, maxSliderPos, sliderStyle, slider);
+		/** Track, cap and grading, drawn by the renderer compiled for the slider's orientation */
+		paintFader(*this, g, x, y, width, height, sliderPos, slider, renderOptions);
+
+		/** Value readout, when the slider has no text box */
+		if (paintedValueReadout && slider.getTextBoxPosition() == juce::Slider::NoTextBox)
+			drawValueReadout(g, slider);
 	}
 
 	/** Draws the background of sliders */
@@ -68,7 +67,7 @@ public:
 		float sliderPos, float minSliderPos, float maxSliderPos,
 		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
 	{
-		g.setColour(backgroundColour);
+		g.setColour(getTheme()->getColours().sliderBackground);
 		g.fillRect(x, y, width, height);
 	}
 
@@ -76,254 +75,205 @@ public:
 	void drawLinearSliderOutline(juce::Graphics& g, int	x, int y, int width, int height,
 		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
 	{
-		g.setColour(outlineColour);
-		outlinedRectangle = juce::Rectangle(x, y, width, height);
-		g.drawRoundedRectangle(outlinedRectangle.toFloat(), outlineCornerSize, lineThickness);
+		const auto outlinedRectangle = juce::Rectangle(x, y, width, height);
+
+		/** The outline is cached as an alpha mask, padded so that the outer half of the line fits. */
+		const int padding = 1;
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::mixingConsoleFader, outlineLayer, width + 2 * padding, height + 2 * padding, g),
+			[this, width, height, padding](juce::Graphics& maskGraphics)
+			{
+				maskGraphics.drawRoundedRectangle(juce::Rectangle<float>(padding, padding, width, height),
+					outlineCornerSize, lineThickness);
+			}, &slider);
+
+		RenderCache::drawMask(g, mask, outlinedRectangle.expanded(padding).toFloat(), getTheme()->getColours().sliderOutline);
 	}
 
 #pragma region Orientation depended draw methods
-	/** Sets the slider style and calls the methods that draw the elements of the slider */
-	void drawSliderElements(juce::Graphics& g, int x, int y, int width, int height,
-		float sliderPos, float minSliderPos, float maxSliderPos,
-		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider)
+	/**
+	 * Returns the track of the slider.
+	 * The parts of the slider that depend on its orientation are written once, along the track (length)
+	 * and across it (cross), and FaderRenderer compiles them for each orientation.
+	 */
+	template <typename Orientation>
+	FaderTrack getTrack(int x, int y, int width, int height)
 	{
-		if (width > height)
-		{
-			slider.setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
-		}
-		else
-		{
-			slider.setSliderStyle(juce::Slider::SliderStyle::LinearVertical);
-		}
-
+		const juce::Rectangle<int> sliderArea(x, y, width, height);
+		const float crossSize = (float)Orientation::getCross(sliderArea);
 
-		/** Slider track */
-		drawLinearSliderTrack(g, x, y, width, height, sliderStyle, slider);
-
-		/** Slider cap (thumb) */
-		drawLinearSliderThumb(g, x, y, width, height, sliderPos, minSliderPos,
-			maxSliderPos, sliderStyle, slider);
-
-		drawLinearSliderGrading(g, x, y, width, height, sliderStyle);
+		/** 1/8 of the slider area across, 4/5 of it along, centred on a third of the way across */
+		return FaderTrack::centredOn(crossSize / 3.f, (float)Orientation::getLengthCentre(sliderArea),
+			crossSize * 0.125f, Orientation::getLength(sliderArea) * 0.8f);
 	}
 
 	/** Draws the track of the slider */
-	void drawLinearSliderTrack(juce::Graphics& g, int x, int y, int width, int height,
-		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider)
-	{
-		/** The horizontal center of the slider area (not including the taxt box if any) */
-		const float sliderAreaCenterX = outlinedRectangle.getCentreX();
-		/** The vertical center of the slider area (not including the taxt box if any) */
-		const float sliderAreaCenterY = outlinedRectangle.getCentreY();
-
-		const float sliderTrackCenterX = outlinedRectangle.getWidth() / 3.f;
-		const float sliderTrackCenterY = outlinedRectangle.getHeight() / 3.f;
-
-		if (sliderStyle == juce::Slider::SliderStyle::LinearVertical)
-		{	//Draw the slider track vertically
-			/** Slider track */
-			trackWidth = width * 0.125f;	// 1/8 of slider area width
-			trackHeight = height * 0.8f;	// 4/5 of slider are height
-			trackStartX = sliderTrackCenterX - trackWidth / 2.f;		// Slider area start x + center - half the width of the track
-			trackEndX = trackStartX + trackWidth;
-			trackStartY = sliderAreaCenterY - trackHeight / 2.f;	// Slider area start Y + center - half the heigght of the track
-			trackEndY = trackStartY + trackHeight;
-
-			/** Colour gradients */
-			juce::Colour sliderTrackSides = juce::Colours::darkgrey.darker(0.7f);
-			juce::Colour sliderTrackCenter = juce::Colours::black;
-			juce::ColourGradient vetricalSliderTrackGradient = juce::ColourGradient::horizontal(sliderTrackSides, trackStartX + trackWidth / 4, sliderTrackSides, trackEndX - trackWidth / 4);
-			vetricalSliderTrackGradient.addColour(0.5, sliderTrackCenter);
-
-			/** Fill slider track with gradient */
-			g.setGradientFill(vetricalSliderTrackGradient);
-			/** Draw the slider track */
-			g.fillRoundedRectangle(trackStartX, trackStartY, trackWidth, trackHeight, outlineCornerSize);
-		}
-		else if (sliderStyle == juce::Slider::SliderStyle::LinearHorizontal)
-		{	//Draw the slider track horizontally
-			/** Slider track */
-			trackWidth = width * 0.8f;	// 4/5 of slider area width
-			trackHeight = height * 0.125;	// 1/8 of slider are height
-			trackStartX = sliderAreaCenterX - trackWidth / 2.f;		// Slider area start x + center - half the width of the track
-			trackEndX = trackStartX + trackWidth;
-			trackStartY = sliderTrackCenterY - trackHeight / 2.f;	// Slider area start Y + center - half the heigght of the track
-			trackEndY = trackStartY + trackHeight;
-
-			/** Colour gradients */
-			juce::Colour sliderTrackSides = juce::Colours::darkgrey.darker(0.7f);
-			juce::Colour sliderTrackCenter = juce::Colours::black;
-			juce::ColourGradient horizontalSliderTrackGradient = juce::ColourGradient::vertical(sliderTrackSides, trackStartY + trackHeight / 4, sliderTrackSides, trackEndY - trackHeight / 4);
-			horizontalSliderTrackGradient.addColour(0.5, sliderTrackCenter);
-
-			/** Fill slider track with gradient */
-			g.setGradientFill(horizontalSliderTrackGradient);
-
-			/** Draw the slider track */
-			g.fillRoundedRectangle(trackStartX, trackStartY, trackWidth, trackHeight, outlineCornerSize);
-		}
+	template <typename Orientation>
+	void drawTrack(juce::Graphics& g, const FaderTrack& track, const LevelOfDetail::Options& renderOptions)
+	{
+		/** Colour gradient across the track */
+		const auto theme = getTheme();
+		const juce::Colour sliderTrackSides = theme->getColours().sliderTrackSides;
+		const juce::Colour sliderTrackCenter = theme->getColours().sliderTrackCenter;
+
+		juce::ColourGradient sliderTrackGradient = Orientation::makeCrossGradient(sliderTrackSides, track.crossStart + track.crossSize / 4,
+			sliderTrackSides, track.getCrossEnd() - track.crossSize / 4);
+		sliderTrackGradient.addColour(0.5, sliderTrackCenter);
+
+		/** Fill slider track with gradient */
+		fillTrack(g, track.getBounds<Orientation>(), sliderTrackGradient, renderOptions);
 	}
 
 	/** Draws the slider thumb (slider cap) */
-	void drawLinearSliderThumb(juce::Graphics& g, int x, int y, int width, int height,
-		float sliderPos, float minSliderPos, float maxSliderPos,
-		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
+	template <typename Orientation>
+	void drawThumb(juce::Graphics& g, const FaderTrack& track, int x, int y, int width, int height, float sliderPos, juce::Slider& slider,
+		const LevelOfDetail::Options& renderOptions)
 	{
 		const float sliderCapCornerSize = 5;
+		const auto theme = getTheme();
+		const juce::Rectangle<int> sliderArea(x, y, width, height);
+
+		/** The cap is 1/8 of the track long on vertical sliders and 1/10 on horizontal ones */
+		const float sliderCapLength = track.lengthSize * (Orientation::isVertical ? 0.125f : 0.1f);
+		const float sliderCapCross = track.crossSize * 2;
+		const float sliderCapCrossStart = Orientation::getCross(sliderArea) / 3.f - sliderCapCross / 2.f;
+
+		sliderPos = track.getCapCentre<Orientation>(sliderArea, sliderPos);
+
+		const auto sliderCapBounds = Orientation::makeRectangle(sliderCapCrossStart, sliderPos - sliderCapLength / 2.f,
+			sliderCapCross, sliderCapLength);
+
+		/** Add a drop shadow before drawing the slider cap (so the shadow is under the slider cap) */
+		if (renderOptions.drawShadows)
+			drawSliderCapShadow(g, sliderCapBounds.toNearestInt());
+
 		/** SliderCap */
-		juce::Path sliderCap;
-		if (sliderStyle == juce::Slider::SliderStyle::LinearVertical)
-		{	//Draw the slider cap vertically
-			const float sliderCapHeightToTotalHeightRatio = 0.1f;
-			const float sliderCapHeight = height * sliderCapHeightToTotalHeightRatio;
-			const float sliderCapWidth = trackWidth * 2;
-
-			sliderPos = juce::jmap<float>(
-				sliderPos,
-				height,
-				y,
-				trackEndY,
-				trackStartY
-			);
-
-			juce::Rectangle sliderCapBounds = juce::Rectangle(width / 3.f - sliderCapWidth / 2.f,	// StartX
-				sliderPos - sliderCapHeight / 2.f,
-				sliderCapWidth,
-				sliderCapHeight);
-
-			/** Add a drop shadow before drawing the slider cap (so the shadow is under the slider cap) */
-			dropShadow.drawForRectangle(g, sliderCapBounds.toNearestInt());
-
-
-			sliderCap.addRoundedRectangle(
-				sliderCapBounds,
-				sliderCapCornerSize);
-			g.setColour(sliderCapColour);
-			g.fillPath(sliderCap);
+		fillSliderCap(g, sliderCapBounds, sliderCapCornerSize, theme->getColours().sliderCap, renderOptions);
 
-			juce::Rectangle<float> sliderCapCenterLine(
-				width / 3.f - sliderCapWidth / 2.f,
-				sliderPos - 2,
-				sliderCapWidth,
-				5);
+		/** Surface material over the cap, with the gradients it is a detail of */
+		if (surfaceMaterial && renderOptions.useGradients && !renderOptions.simplifiedGeometry)
+			drawSliderCapMaterial(g, sliderCapBounds, sliderCapCornerSize);
 
-			g.setColour(sliderCapCenterLineColour);
-			g.fillRect(sliderCapCenterLine);
-		}
-		else if (sliderStyle == juce::Slider::SliderStyle::LinearHorizontal)
-		{	//Draw the slider cap horizontally
-			const float sliderCapWidthToTotalWidthRatio = 0.1f;
-			const float sliderCapHeight = trackHeight * 2;
-			const float sliderCapWidth = trackWidth * sliderCapWidthToTotalWidthRatio;
-
-			sliderPos = juce::jmap<float>(
-				sliderPos,
-				x,
-				width,
-				trackStartX,
-				trackEndX
-			);
-
-			juce::Rectangle sliderCapBounds = juce::Rectangle(sliderPos - sliderCapWidth / 2.f,
-				height / 3.f - sliderCapHeight / 2.f,
-				sliderCapWidth,
-				sliderCapHeight);
-
-			/** Add a drop shadow before drawing the slider cap (so the shadow is under the slider cap) */
-			dropShadow.drawForRectangle(g, sliderCapBounds.toNearestInt());
-
-			sliderCap.addRoundedRectangle(
-				sliderCapBounds,
-				sliderCapCornerSize);
+		const auto sliderCapCenterLine = Orientation::makeRectangle(sliderCapCrossStart, sliderPos - 2, sliderCapCross, 5.f);
+
+		g.setColour(theme->getColours().sliderCapLine);
+		g.fillRect(sliderCapCenterLine);
+	}
+
+	/** Fills the slider cap, as a plain rectangle when the level of detail asks for simplified geometry */
+	void fillSliderCap(juce::Graphics& g, juce::Rectangle<float> sliderCapBounds, float sliderCapCornerSize, juce::Colour sliderCapColour,
+		const LevelOfDetail::Options& renderOptions)
+	{
+		if (renderOptions.simplifiedGeometry)
+		{
 			g.setColour(sliderCapColour);
-			g.fillPath(sliderCap);
-
-			juce::Rectangle<float> sliderCapCenterLine(
-				sliderPos - 2,
-				height / 3.f - sliderCapHeight / 2.f,
-				5,
-				sliderCapHeight);
-			g.setColour(sliderCapCenterLineColour);
-			g.fillRect(sliderCapCenterLine);
+			g.fillRect(sliderCapBounds);
+			return;
 		}
+
+		RoundedRectRasteriser::fill(g, sliderCapBounds, sliderCapCornerSize, sliderCapColour);
 	}
 
-	void drawLinearSliderGrading(juce::Graphics& g, int x, int y, int width, int height, const juce::Slider::SliderStyle sliderStyle)
+	/** Fills the track with the gradient, or its edge colour when the level of detail skips gradients */
+	void fillTrack(juce::Graphics& g, juce::Rectangle<float> trackBounds, const juce::ColourGradient& trackGradient,
+		const LevelOfDetail::Options& renderOptions)
 	{
-		juce::Path grading;
+		if (renderOptions.useGradients)
+			RoundedRectRasteriser::fill(g, trackBounds, outlineCornerSize, trackGradient);
+		else
+			RoundedRectRasteriser::fill(g, trackBounds, outlineCornerSize, trackGradient.getColour(0));
+	}
 
-		if (sliderStyle == juce::Slider::SliderStyle::LinearVertical)
-		{
-			/** The long line that runs paraller to the slider track */
-			float longLineX = width * 5.f / 6.f;
-			juce::Line longLine = juce::Line(longLineX, trackStartY, longLineX, trackEndY);
-			grading.addLineSegment(longLine, 1);
+	/** Draws the slider cap drop shadow from a cached alpha mask of the shadow of a cap that size */
+	void drawSliderCapShadow(juce::Graphics& g, juce::Rectangle<int> sliderCapBounds)
+	{
+		const int padding = dropShadow.radius + 1;
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::mixingConsoleFader, sliderCapShadowLayer,
+				sliderCapBounds.getWidth() + 2 * padding, sliderCapBounds.getHeight() + 2 * padding, g),
+			[this, sliderCapBounds, padding](juce::Graphics& maskGraphics)
+			{
+				BoxBlurShadow(juce::Colours::white, dropShadow.radius, {})
+					.drawForRectangle(maskGraphics, sliderCapBounds.withPosition(padding, padding));
+			});
+
+		RenderCache::drawMask(g, mask, sliderCapBounds.expanded(padding).translated(dropShadow.offset.x, dropShadow.offset.y).toFloat(),
+			dropShadow.colour);
+	}
 
-			/** The smaller grading lines */
-			float smallLineSize = width / 10.f;
-			float smallLineDistance = (trackEndY - trackStartY) / 8.f;
-			int gradingNumber = 10;
+	/** Draws the surface material over the slider cap from a cached layer of a cap that size filled with it */
+	void drawSliderCapMaterial(juce::Graphics& g, juce::Rectangle<float> sliderCapBounds, float sliderCapCornerSize)
+	{
+		const int layerWidth = juce::roundToInt(sliderCapBounds.getWidth());
+		const int layerHeight = juce::roundToInt(sliderCapBounds.getHeight());
 
-			for (int i = 0; i <= 8; i++)
+		const auto layer = renderCache->getImage(
+			RenderCache::makeKey(ControlType::mixingConsoleFader, sliderCapMaterialLayer, layerWidth, layerHeight, g),
+			juce::Image::ARGB,
+			[this, layerWidth, layerHeight, sliderCapCornerSize](juce::Graphics& layerGraphics)
 			{
-				juce::Point start = juce::Point(longLineX - smallLineSize, trackStartY + i * smallLineDistance);
-				juce::Point end = juce::Point(longLineX, trackStartY + i * smallLineDistance);
+				juce::Path sliderCap;
+				sliderCap.addRoundedRectangle(0.f, 0.f, (float)layerWidth, (float)layerHeight, sliderCapCornerSize);
+				materialTexture->fillPath(layerGraphics, sliderCap, materialOpacity);
+			});
 
-				juce::Line line = juce::Line(start, end);
+		g.drawImage(layer, sliderCapBounds);
+	}
 
-				grading.addLineSegment(line, 1);
+	/** Draws the grading lines and numbers from a cached alpha mask the size of the slider */
+	template <typename Orientation>
+	void drawGrading(juce::Graphics& g, const FaderTrack& track, int width, int height, juce::Slider& slider,
+		const LevelOfDetail::Options& renderOptions)
+	{
+		const bool drawLabels = renderOptions.drawLabels;
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::mixingConsoleFader, gradingLayer, slider.getWidth(), slider.getHeight(), g,
+				Orientation::sliderStyle | (drawLabels ? 0x100 : 0)),
+			[this, track, width, height, drawLabels](juce::Graphics& maskGraphics)
+			{
+				paintGrading<Orientation>(maskGraphics, track, width, height, drawLabels);
+			}, &slider);
 
-				g.setColour(juce::Colours::beige.darker(0.5));
-				g.setFont(juce::Font(10));
+		RenderCache::drawMask(g, mask, slider.getLocalBounds().toFloat(), getTheme()->getColours().sliderGrading);
+	}
 
-				g.drawText(juce::String(gradingNumber),
-					longLineX - 2 * smallLineSize - 15,
-					trackStartY + i * smallLineDistance - 15,
-					30.f,
-					30.f,
-					juce::Justification::centred,
-					true
-				);
-				gradingNumber -= 10;
-			}
-		}
-		else if (sliderStyle == juce::Slider::SliderStyle::LinearHorizontal)
-		{
-			/** The long line that runs paraller to the slider track */
-			float longLineY = height * 5.f / 6.f;
-			juce::Line longLine = juce::Line(trackStartX, longLineY, trackEndX, longLineY);
-			grading.addLineSegment(longLine, 1);
+	/** Paints the grading lines and, if drawLabels is true, the numbers, from 10 at the top of the range down */
+	template <typename Orientation>
+	void paintGrading(juce::Graphics& g, const FaderTrack& track, int width, int height, bool drawLabels)
+	{
+		const float crossSize = Orientation::getCross(juce::Rectangle<float>((float)width, (float)height));
+		juce::Path grading;
 
-			/** The smaller grading lines */
-			float smallLineSize = height / 10.f;
-			float smallLineDistance = (trackEndX - trackStartX) / 8.f;
-			int gradingNumber = 10;
+		/** The long line that runs paraller to the slider track */
+		const float longLineCross = crossSize * 5.f / 6.f;
+		grading.addLineSegment(juce::Line(Orientation::makePoint(longLineCross, track.lengthStart),
+			Orientation::makePoint(longLineCross, track.getLengthEnd())), 1);
 
-			for (int i = 0; i <= 8; i++)
-			{
-				juce::Point start = juce::Point(trackEndX - i * smallLineDistance, longLineY);
-				juce::Point end = juce::Point(trackEndX - i * smallLineDistance, longLineY - smallLineSize);
+		/** The smaller grading lines */
+		const float smallLineSize = crossSize / 10.f;
+		const float smallLineDistance = track.lengthSize / 8.f;
+		int gradingNumber = 10;
 
-				juce::Line line = juce::Line(start, end);
-				grading.addLineSegment(line, 1);
+		g.setFont(juce::Font(10));
 
+		for (int i = 0; i <= 8; i++)
+		{
+			const float lineLength = Orientation::fromMaximum(track.lengthStart, track.getLengthEnd(), i * smallLineDistance);
 
-				g.setColour(juce::Colours::beige.darker(0.5));
-				g.setFont(juce::Font(10));
+			grading.addLineSegment(juce::Line(Orientation::makePoint(longLineCross - smallLineSize, lineLength),
+				Orientation::makePoint(longLineCross, lineLength)), 1);
 
+			if (drawLabels)
+			{
 				g.drawText(juce::String(gradingNumber),
-					trackEndX - (i * smallLineDistance) - 15,
-					longLineY - 2 * smallLineSize - 15,
-					30.f,
-					30.f,
+					Orientation::makeRectangle(longLineCross - 2 * smallLineSize - 15, lineLength - 15, 30.f, 30.f),
 					juce::Justification::centred,
 					true
 				);
-				gradingNumber -= 10;
 			}
+			gradingNumber -= 10;
 		}
 
-		g.setColour(juce::Colours::beige.darker(0.5));
 		g.fillPath(grading);
 	}
 
@@ -337,13 +287,14 @@ public:
 		slider.setNumDecimalPlacesToDisplay(numberOfDecimalPlaces);
 
 		juce::Label* sliderTextBoxPtr = LookAndFeel_V4::createSliderTextBox(slider);
+		const auto theme = getTheme();
 
-		sliderTextBoxPtr->setColour(juce::Label::textColourId, juce::Colours::beige);
+		sliderTextBoxPtr->setColour(juce::Label::textColourId, theme->getColours().text);
 		sliderTextBoxPtr->setColour(juce::Label::backgroundColourId, juce::Colours::transparentBlack);
 		sliderTextBoxPtr->setColour(juce::Label::outlineColourId, juce::Colours::transparentBlack);
-		sliderTextBoxPtr->setColour(juce::Label::textWhenEditingColourId, juce::Colours::beige);
-		sliderTextBoxPtr->setColour(juce::Label::backgroundWhenEditingColourId, juce::Colours::black);
-		sliderTextBoxPtr->setColour(juce::Label::outlineWhenEditingColourId, juce::Colours::beige);
+		sliderTextBoxPtr->setColour(juce::Label::textWhenEditingColourId, theme->getColours().text);
+		sliderTextBoxPtr->setColour(juce::Label::backgroundWhenEditingColourId, theme->getColours().textEditorBackground);
+		sliderTextBoxPtr->setColour(juce::Label::outlineWhenEditingColourId, theme->getColours().text);
 
 		// ToDo: Fix text box justification when editing the value
 
@@ -352,73 +303,161 @@ public:
 
 #pragma endregion
 
+	/** Painted value readout */
+#pragma region Painted value readout
+	/**
+	 * Draws the value in the text box area when the slider has no text box (see PaintedValueReadout),
+	 * instead of using a Label component.
+	 */
+	void setPaintedValueReadout(bool shouldPaintValueReadout)
+	{
+		paintedValueReadout = shouldPaintValueReadout;
+	}
+
+	bool getPaintedValueReadout()
+	{
+		return paintedValueReadout;
+	}
+
+	/** Draws the value from the digit glyph atlas, in the same colour as the text box */
+	void drawValueReadout(juce::Graphics& g, juce::Slider& slider)
+	{
+		const auto textBoxBounds = getSliderLayout(slider).textBoxBounds;
+
+		digitGlyphAtlas->drawValue(g, slider, textBoxBounds,
+			juce::jmin(15.f, textBoxBounds.getHeight() * 0.8f), getTheme()->getColours().text);
+	}
+#pragma endregion
+
+
+#pragma region Surface material
+	/**
+	 * Overlays the rough plastic texture on the slider cap (see MaterialTexture).
+	 * Not drawn at the levels of detail without gradients or with simplified geometry.
+	 */
+	void setSurfaceMaterial(bool shouldUseSurfaceMaterial)
+	{
+		surfaceMaterial = shouldUseSurfaceMaterial;
+	}
+
+	bool getSurfaceMaterial()
+	{
+		return surfaceMaterial;
+	}
+#pragma endregion
+
+
+#pragma region Level of detail
+	/** Sets the slider lengths where the level of detail changes */
+	void setLevelOfDetailThresholds(LevelOfDetail::Thresholds newThresholds)
+	{
+		levelOfDetail.setThresholds(newThresholds);
+	}
+
+	LevelOfDetail::Thresholds getLevelOfDetailThresholds()
+	{
+		return levelOfDetail.getThresholds();
+	}
+
+	/** Returns the level of detail the slider is drawn at */
+	LevelOfDetail::Tier getLevelOfDetailTier(juce::Slider& slider)
+	{
+		const auto sliderBounds = getSliderLayout(slider).sliderBounds;
+		return levelOfDetail.getTier(juce::jmax(sliderBounds.getWidth(), sliderBounds.getHeight()));
+	}
+
+#pragma endregion
+
+	/** Repaint suppression */
+#pragma region Repaint suppression
+	/**
+	 * Returns the position of the slider cap, in physical pixels, on the track it is drawn on.
+	 * When this doesn't change the cap moves by less than a physical pixel and the slider doesn't need a repaint for it.
+	 *
+	 * \param physicalPixelScale Physical pixels per logical pixel of the slider.
+	 */
+	int getQuantisedThumbPosition(juce::Slider& slider, float physicalPixelScale)
+	{
+		return getQuantisedFaderCapPosition(*this, slider, physicalPixelScale);
+	}
+#pragma endregion
+
+
 	/** Colour getters and setters */
 #pragma region Colour getters and setters
+	/**
+	 * Returns the theme the slider is drawn with: the current theme (or the one set with setTheme()),
+	 * with the colours changed through the setters below applied on top.
+	 */
+	Theme::Ptr getTheme() const
+	{
+		return colourOverrides.applyTo(baseTheme != nullptr ? baseTheme : Theme::getCurrent());
+	}
+
+	/** Follows a theme of its own instead of the current theme. Pass nullptr to follow the current theme again. */
+	void setTheme(Theme::Ptr newTheme)
+	{
+		baseTheme = std::move(newTheme);
+	}
+
+	/** Draws with the colours of the theme again, forgetting the ones changed through the setters. */
+	void resetColours()
+	{
+		colourOverrides.clear();
+	}
+
 	/** Background colour */
 	void setBackgroundColour(juce::Colour newColour)
 	{
-		backgroundColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderBackground, newColour);
 	}
 
 	juce::Colour getBackgroundColour()
 	{
-		return backgroundColour;
+		return getTheme()->getColours().sliderBackground;
 	}
 
 	/** Outline colour */
 	void setOutlineColour(juce::Colour newColour)
 	{
-		outlineColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderOutline, newColour);
 	}
 
 	juce::Colour getOutlineColour()
 	{
-		return outlineColour;
+		return getTheme()->getColours().sliderOutline;
 	}
 
 	/** Slider cap colour */
 	void setSliderCapColour(juce::Colour newColour)
 	{
-		sliderCapColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderCap, newColour);
 	}
 
 	juce::Colour getSliderCapColour()
 	{
-		return sliderCapColour;
+		return getTheme()->getColours().sliderCap;
 	}
 
 	/** Slider cap line colour */
 	void setSliderCapLineColour(juce::Colour newColour)
 	{
-		sliderCapCenterLineColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderCapLine, newColour);
 	}
 
 	juce::Colour getSliderCapLineColour()
 	{
-		return sliderCapCenterLineColour;
+		return getTheme()->getColours().sliderCapLine;
 	}
 
 #pragma endregion
 
 
 private:
-	/** Colours */
-	juce::Colour backgroundColour = juce::Colours::transparentWhite;
-	juce::Colour outlineColour = juce::Colours::beige;
-	juce::Colour sliderCapColour = juce::Colours::darkgrey;
-	juce::Colour sliderCapCenterLineColour = juce::Colours::black;	
-		
-
-	/** Outline */
-	juce::Rectangle<int> outlinedRectangle;
-
-	/** Slider Track */
-	float trackWidth;
-	float trackHeight;
-	float trackStartX;
-	float trackEndX;
-	float trackStartY;
-	float trackEndY;
+	/** Theme followed instead of the current one, if any */
+	Theme::Ptr baseTheme;
+	/** Colours changed through the setters */
+	Theme::Overrides colourOverrides;
 
 	/** Generic */
 	const float border = 2;
@@ -426,5 +465,29 @@ private:
 	const float lineThickness = 1.f;
 	static constexpr int numberOfDecimalPlaces = 2;
 
-	juce::DropShadow dropShadow = juce::DropShadow(juce::Colours::black.withAlpha(0.8f), 20, juce::Point(-5, 5));
+	BoxBlurShadow dropShadow = BoxBlurShadow(juce::Colours::black.withAlpha(0.8f), 20, juce::Point(-5, 5));
+
+	/** Cached layers. Single-colour layers are stored as alpha masks and tinted when drawn. */
+	enum CachedLayer
+	{
+		outlineLayer,
+		gradingLayer,
+		sliderCapShadowLayer,
+		sliderCapMaterialLayer
+	};
+
+	/** Layers are shared with every other control in the process */
+	juce::SharedResourcePointer<RenderCache> renderCache;
+
+	/** Level of detail, measured on the slider length */
+	LevelOfDetail levelOfDetail = LevelOfDetail({ 120, 480 });
+
+	/** Painted value readout */
+	bool paintedValueReadout = false;
+	juce::SharedResourcePointer<DigitGlyphAtlas> digitGlyphAtlas;
+
+	/** Surface material */
+	static constexpr float materialOpacity = 0.25f;
+	bool surfaceMaterial = false;
+	juce::SharedResourcePointer<MaterialTexture> materialTexture;
 };
@@ -9,76 +9,59 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "../Benchmark/PaintTrace.h"
+#include "../Rendering/RenderCache.h"
+#include "../Rendering/LevelOfDetail.h"
+#include "../Rendering/InteractionQuality.h"
+#include "../Rendering/DigitGlyphAtlas.h"
+#include "../Rendering/Theme.h"
+#include "../Rendering/FaderRenderer.h"
+#include "../Rendering/RoundedRectRasteriser.h"
+#include "../Rendering/BoxBlurShadow.h"
+#include "../Rendering/MaterialTexture.h"
 
 class Slider_SynthBipolar_LookAndFeel : public juce::LookAndFeel_V4
 {
 public:
-	/** Determines the layout - the part where the slider and the textbox are drawn */
+	/** Determines the layout - the part where the slider and the textbox are drawn.
+	 * The orientation is the slider's style (LinearVertical, or horizontal otherwise), which is never changed here. */
 	juce::Slider::SliderLayout getSliderLayout(juce::Slider& slider) override
 	{
-		if (slider.getSliderStyle() == juce::Slider::SliderStyle::LinearVertical)
-		{
-			juce::Rectangle localBounds = slider.getLocalBounds();
-
-			juce::Slider::SliderLayout layout;
-
-			layout.sliderBounds = localBounds.removeFromTop(localBounds.getHeight() * 11 / 12);
-			layout.textBoxBounds = localBounds;
-
-			return layout;
-		}
-		else
-		{
-			juce::Rectangle localBounds = slider.getLocalBounds();
-
-			juce::Slider::SliderLayout layout;
-
-			layout.sliderBounds = localBounds.removeFromTop(localBounds.getHeight() * 9 / 12);
-			layout.textBoxBounds = localBounds;
-
-			return layout;
-		}
+		return getFaderLayoutForStyle(slider);
 	}
 
 	void drawLinearSlider(juce::Graphics& g, int x, int y, int width,
 		int height, float sliderPos, float minSliderPos, float maxSliderPos,
 		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
 	{
-		/** Slider orientation */
-		setSliderOrientation(width, height, slider);
-		
+		PaintTrace::recordSlider(ControlType::synthBipolarFader, g, slider);
+
+		/** Level of detail, based on the length of the slider. Fast path while the slider is dragged or resized. */
+		const auto renderOptions = InteractionQuality::getOptions(slider, levelOfDetail.getOptionsForSize(juce::jmax(width, height)));
+		g.setImageResamplingQuality(renderOptions.resamplingQuality);
+
 		/** Background. */
 		drawLinearSliderBackground(g, x, y, width, height, sliderPos, minSliderPos, maxSliderPos, sliderStyle, slider);
 
 		/** Outline. */
 		drawLinearSliderOutline(g, x, y, width, height, sliderStyle, slider);
 
-		/** Slider track */
-		drawSliderTrack(g, x, y, width, height, sliderStyle, slider);
-
-		/** Slider cap (thumb) */
-		drawLinearSliderThumb(g, x, y, width, height, sliderPos, minSliderPos, maxSliderPos, sliderStyle, slider);
+		/** Slider track, cap (thumb) and grading lines, drawn by the renderer compiled for the slider's orientation */
+		paintFader(*this, g, x, y, width, height, sliderPos, slider, renderOptions);
 
-		/** Grading lines */
-		drawGradingLines(g, x, y, width, height, sliderStyle);
+		/** Value readout, when the slider has no text box */
+		if (paintedValueReadout && slider.getTextBoxPosition() == juce::Slider::NoTextBox)
+			drawValueReadout(g, slider);
 	}
 
 
 #pragma region Slider drawing methods
-	/** Sets the slider orientation based on the given width/height */
-	void setSliderOrientation(int width,
-		int height, juce::Slider& slider)
-	{
-		if (height >= width) slider.setSliderStyle(juce::Slider::SliderStyle::LinearVertical);
-		else slider.setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
-	}
-
 	/** Draws the background of sliders */
 	void drawLinearSliderBackground(juce::Graphics& g, int x, int y, int width, int height,
 		float sliderPos, float minSliderPos, float maxSliderPos,
 		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
 	{
-		g.setColour(backgroundColour);
+		g.setColour(getTheme()->getColours().sliderBackground);
 		g.fillRect(x, y, width, height);
 	}
 
@@ -86,170 +69,207 @@ public:
 	void drawLinearSliderOutline(juce::Graphics& g, int	x, int y, int width, int height,
 		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
 	{
-		g.setColour(outlineColour);
-		outlinedRectangle = juce::Rectangle(x, y, width, height);
-		g.drawRoundedRectangle(outlinedRectangle.toFloat(), outlineCornerSize, lineThickness);
+		const auto outlinedRectangle = juce::Rectangle(x, y, width, height);
+
+		/** The outline is cached as an alpha mask, padded so that the outer half of the line fits. */
+		const int padding = 1;
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::synthBipolarFader, outlineLayer, width + 2 * padding, height + 2 * padding, g),
+			[this, width, height, padding](juce::Graphics& maskGraphics)
+			{
+				maskGraphics.drawRoundedRectangle(juce::Rectangle<float>(padding, padding, width, height),
+					outlineCornerSize, lineThickness);
+			}, &slider);
+
+		RenderCache::drawMask(g, mask, outlinedRectangle.expanded(padding).toFloat(), getTheme()->getColours().sliderOutline);
+	}
+
+	/**
+	 * Returns the track that the slider runs along.
+	 * The parts of the slider that depend on its orientation are written once, along the track (length)
+	 * and across it (cross), and FaderRenderer compiles them for each orientation.
+	 */
+	template <typename Orientation>
+	FaderTrack getTrack(int x, int y, int width, int height)
+	{
+		const juce::Rectangle<float> sliderArea((float)width, (float)height);
+		const float crossSize = Orientation::getCross(sliderArea);
+		const float lengthSize = Orientation::getLength(sliderArea);
+
+		/** 1/5 of the slider area across and 4/5 of it along, centred on a third of the way across */
+		return FaderTrack::centredOn(crossSize / 3.f, lengthSize / 2.f, crossSize * 0.2f, lengthSize * 0.8f);
 	}
 
 	/** Draws the track that the slider runs along */
-	void drawSliderTrack(juce::Graphics& g, int	x, int y, int width, int height,
-		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider)
+	template <typename Orientation>
+	void drawTrack(juce::Graphics& g, const FaderTrack& track, const LevelOfDetail::Options& renderOptions)
 	{
 		/** Gradients colours */
-		juce::Colour sliderTrackSides = juce::Colours::darkgrey.darker(0.7f);
-		juce::Colour sliderTrackCenter = juce::Colours::black;
+		const auto theme = getTheme();
+		const juce::Colour sliderTrackSides = theme->getColours().sliderTrackSides;
+		const juce::Colour sliderTrackCenter = theme->getColours().sliderTrackCenter;
 
-		if (sliderStyle == juce::Slider::LinearVertical)
-		{
-			/** Slider track */
-			trackWidth = width * 0.2f;
-			trackHeight = height * 0.8f;
-			trackStartX = width / 3.f - trackWidth / 2.f;
-			trackEndX = width / 3.f + trackWidth / 2.f;
-			trackStartY = height / 2.f - trackHeight / 2.f;
-			trackEndY = height / 2.f + trackHeight / 2.f;
-
-			/** Vertical gradient */
-			juce::ColourGradient vetricalSliderTrackGradient = juce::ColourGradient::horizontal(sliderTrackSides, trackStartX + trackWidth / 4, sliderTrackSides, trackEndX - trackWidth / 4);
-			vetricalSliderTrackGradient.addColour(0.5, sliderTrackCenter);
-
-			/** Fill slider track with gradient */
-			g.setGradientFill(vetricalSliderTrackGradient);
-			/** Draw the slider track */
-			g.fillRoundedRectangle(trackStartX, trackStartY, trackWidth, trackHeight, outlineCornerSize);
-		}
-		else if (sliderStyle == juce::Slider::LinearHorizontal)
-		{
-			const float centerX = width / 2.f;
-			const float centerY = height / 3.f;
-
-			trackWidth = width * 0.8f;
-			trackHeight = height * 0.2f;
-			trackStartX = centerX - trackWidth / 2.f;
-			trackEndX = centerX + trackWidth / 2.f;
-			trackStartY = centerY - trackHeight / 2.f;
-			trackEndY = centerY + trackHeight / 2.f;
-
-			/** Horizontal gradient */
-			juce::ColourGradient horizontalSliderTrackGradient = juce::ColourGradient::vertical(sliderTrackSides, trackStartY + trackHeight / 4, sliderTrackSides, trackEndY - trackHeight / 4);
-			horizontalSliderTrackGradient.addColour(0.5, sliderTrackCenter);
-
-			/** Fill slider track with gradient */
-			g.setGradientFill(horizontalSliderTrackGradient);
-			/** Draw the slider track */
-			g.fillRoundedRectangle(trackStartX, trackStartY, trackWidth, trackHeight, outlineCornerSize);
-		}
+		/** Gradient across the track */
+		juce::ColourGradient sliderTrackGradient = Orientation::makeCrossGradient(sliderTrackSides, track.crossStart + track.crossSize / 4,
+			sliderTrackSides, track.getCrossEnd() - track.crossSize / 4);
+		sliderTrackGradient.addColour(0.5, sliderTrackCenter);
+
+		/** Fill slider track with gradient */
+		fillTrack(g, track.getBounds<Orientation>(), sliderTrackGradient, renderOptions);
 	}
 
 	/** Draws the slider cap (thumb) */
-	void drawLinearSliderThumb(juce::Graphics& g, int x, int y, int width, int height,
-		float sliderPos, float minSliderPos, float maxSliderPos,
-		const juce::Slider::SliderStyle sliderStyle, juce::Slider& slider) override
+	template <typename Orientation>
+	void drawThumb(juce::Graphics& g, const FaderTrack& track, int x, int y, int width, int height, float sliderPos, juce::Slider& slider,
+		const LevelOfDetail::Options& renderOptions)
 	{
-		int sliderCapWidth;
-		int sliderCapHeight;
-		int sliderCapStartX;
-		int sliderCapStartY;
-		if (sliderStyle == juce::Slider::SliderStyle::LinearVertical)
-		{
-			/** Slider cap position scalling */
-			sliderPos = juce::jmap(sliderPos, (float)y, (float)height, trackStartY, trackEndY);
+		const juce::Rectangle<int> sliderArea(x, y, width, height);
 
-			/** Slider cap dimensions */
-			sliderCapWidth = 2.f * trackWidth;
-			sliderCapHeight = 0.8f * sliderCapWidth;
-			sliderCapStartX = trackStartX - sliderCapWidth * 0.25;
-			sliderCapStartY = sliderPos - sliderCapHeight / 2.f;
+		/** Slider cap position scalling */
+		sliderPos = track.getCapCentre<Orientation>(sliderArea, sliderPos);
+
+		/** Slider cap dimensions */
+		const int sliderCapCross = 2.f * track.crossSize;
+		const int sliderCapLength = 0.8f * sliderCapCross;
+		const int sliderCapCrossStart = track.crossStart - sliderCapCross * 0.25;
+		const int sliderCapLengthStart = sliderPos - sliderCapLength / 2.f;
 
-		}
-		else if (sliderStyle == juce::Slider::SliderStyle::LinearHorizontal)
-		{
-			/** Slider cap position scalling */
-			sliderPos = juce::jmap(sliderPos, (float)x, (float)width, trackStartX, trackEndX);
-
-			/** Slider cap dimensions */
-			sliderCapHeight = 2.f * trackHeight;
-			sliderCapWidth = 0.8f * sliderCapHeight;
-			sliderCapStartX = sliderPos - sliderCapWidth / 2.f;
-			sliderCapStartY = trackStartY - sliderCapHeight * 0.25;
-		}
 		/** Slider cap path */
-		drawSliderCapPath(g, sliderCapStartX, sliderCapStartY, sliderCapWidth,
-			sliderCapHeight, sliderStyle);
+		drawSliderCapPath<Orientation>(g, sliderCapCrossStart, sliderCapLengthStart, sliderCapCross, sliderCapLength, renderOptions);
 	}
 
 	/** Draws the path (shape) of the slider cap */
-	void drawSliderCapPath(juce::Graphics& g, int sliderCapStartX, int sliderCapStartY,
-		int sliderCapWidth, int sliderCapHeight, juce::Slider::SliderStyle sliderStyle)
+	template <typename Orientation>
+	void drawSliderCapPath(juce::Graphics& g, int sliderCapCrossStart, int sliderCapLengthStart,
+		int sliderCapCross, int sliderCapLength, const LevelOfDetail::Options& renderOptions)
 	{
-		juce::Path sliderCapShape;
-		const int sliderCapCornerSize = 2;
-		if (sliderStyle == juce::Slider::SliderStyle::LinearVertical)
-		{
-			sliderCapShape.startNewSubPath(sliderCapStartX, sliderCapStartY);	//Top left corner
-			sliderCapShape.lineTo(sliderCapStartX, sliderCapStartY + sliderCapHeight);	//Bottom left corner
-			sliderCapShape.lineTo(sliderCapStartX + sliderCapWidth * 0.666f, sliderCapStartY + sliderCapHeight);	//Bottom right corner
-			sliderCapShape.lineTo(sliderCapStartX + sliderCapWidth, sliderCapStartY + sliderCapHeight / 2.f);	//Middle right pointer (points to value)
-			sliderCapShape.lineTo(sliderCapStartX + sliderCapWidth * 0.666f, sliderCapStartY);	//Top right corner
-			sliderCapShape.closeSubPath();
-		}
-		else if (sliderStyle == juce::Slider::SliderStyle::LinearHorizontal)
-		{
-			sliderCapShape.startNewSubPath(sliderCapStartX, sliderCapStartY);	//Top left corner
-			sliderCapShape.lineTo(sliderCapStartX, sliderCapStartY + sliderCapHeight * 0.666f);	//Middle left corner
-			sliderCapShape.lineTo(sliderCapStartX + sliderCapWidth / 2.f, sliderCapStartY + sliderCapHeight);	//Bottom center pointer (points to value)
-			sliderCapShape.lineTo(sliderCapStartX + sliderCapWidth, sliderCapStartY + sliderCapHeight * 0.666f);	//Middle right corner
-			sliderCapShape.lineTo(sliderCapStartX + sliderCapWidth, sliderCapStartY);	//Top right corner
-			sliderCapShape.closeSubPath();
-		}
-		sliderCapShape = sliderCapShape.createPathWithRoundedCorners(sliderCapCornerSize);
-		
 		/** Add a drop shadow before drawing the slider cap (so the shadow is under the slider cap). */
-		dropShadow.drawForPath(g, sliderCapShape);
+		if (renderOptions.drawShadows)
+			drawSliderCapShadow<Orientation>(g, sliderCapCrossStart, sliderCapLengthStart, sliderCapCross, sliderCapLength);
 
-		g.setColour(sliderCapColour);
-		/** Draw the slider cap. */
-		g.fillPath(sliderCapShape);
+		g.setColour(getTheme()->getColours().sliderCap);
+		/** Draw the slider cap. Small sliders skip the rounded corners. */
+		g.fillPath(createSliderCapPath<Orientation>(sliderCapCrossStart, sliderCapLengthStart, sliderCapCross, sliderCapLength,
+			!renderOptions.simplifiedGeometry));
+
+		/** Surface material over the cap, with the gradients it is a detail of */
+		if (surfaceMaterial && renderOptions.useGradients && !renderOptions.simplifiedGeometry)
+			drawSliderCapMaterial<Orientation>(g, sliderCapCrossStart, sliderCapLengthStart, sliderCapCross, sliderCapLength);
 	}
 
-	/** Draws the grading lines */
-	void drawGradingLines(juce::Graphics& g, int x, int y, int width, int height, juce::Slider::SliderStyle sliderStyle)
+	/** Fills the track with the gradient, or its edge colour when the level of detail skips gradients */
+	void fillTrack(juce::Graphics& g, juce::Rectangle<float> trackBounds, const juce::ColourGradient& trackGradient,
+		const LevelOfDetail::Options& renderOptions)
 	{
-		g.setColour(outlineColour.darker(0.5));
-		if (sliderStyle == juce::Slider::SliderStyle::LinearVertical)
-		{
-			/** Long line */
-			g.drawLine(width * 0.75f, trackStartY, width * 0.75f, trackEndY);
+		if (renderOptions.useGradients)
+			RoundedRectRasteriser::fill(g, trackBounds, outlineCornerSize, trackGradient);
+		else
+			RoundedRectRasteriser::fill(g, trackBounds, outlineCornerSize, trackGradient.getColour(0));
+	}
 
-			/** Shorter lines */
-			for (int i = 0; i < 5; i++)
+	/** Draws the slider cap drop shadow from a cached alpha mask of the shadow of a cap that size */
+	template <typename Orientation>
+	void drawSliderCapShadow(juce::Graphics& g, int sliderCapCrossStart, int sliderCapLengthStart,
+		int sliderCapCross, int sliderCapLength)
+	{
+		const int padding = dropShadow.radius + 1;
+		const auto sliderCapBounds = Orientation::makeRectangle(sliderCapCrossStart, sliderCapLengthStart, sliderCapCross, sliderCapLength);
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::synthBipolarFader, sliderCapShadowLayer,
+				sliderCapBounds.getWidth() + 2 * padding, sliderCapBounds.getHeight() + 2 * padding, g, Orientation::sliderStyle),
+			[this, sliderCapCross, sliderCapLength, padding](juce::Graphics& maskGraphics)
 			{
-				g.drawLine(width * 0.75f, trackStartY + i * trackHeight / 4, width * 0.55f, trackStartY + i * trackHeight / 4);
-			}
-			for (int i = 0; i < 21; i++)
+				BoxBlurShadow(juce::Colours::white, dropShadow.radius, {})
+					.drawForPath(maskGraphics, createSliderCapPath<Orientation>(padding, padding, sliderCapCross, sliderCapLength));
+			});
+
+		RenderCache::drawMask(g, mask,
+			sliderCapBounds.expanded(padding).translated(dropShadow.offset.x, dropShadow.offset.y).toFloat(),
+			dropShadow.colour);
+	}
+
+	/** Draws the surface material over the slider cap from a cached layer of a cap that size filled with it */
+	template <typename Orientation>
+	void drawSliderCapMaterial(juce::Graphics& g, int sliderCapCrossStart, int sliderCapLengthStart,
+		int sliderCapCross, int sliderCapLength)
+	{
+		const auto sliderCapBounds = Orientation::makeRectangle(sliderCapCrossStart, sliderCapLengthStart, sliderCapCross, sliderCapLength);
+		const auto layer = renderCache->getImage(
+			RenderCache::makeKey(ControlType::synthBipolarFader, sliderCapMaterialLayer,
+				sliderCapBounds.getWidth(), sliderCapBounds.getHeight(), g, Orientation::sliderStyle),
+			juce::Image::ARGB,
+			[this, sliderCapCross, sliderCapLength](juce::Graphics& layerGraphics)
 			{
-				if (i%5 != 0)
-				{
-					g.drawLine(width * 0.75f, trackStartY + i * trackHeight / 20, width * 0.6f, trackStartY + i * trackHeight / 20);
-				}
-			}
-		}
-		else if (sliderStyle == juce::Slider::SliderStyle::LinearHorizontal)
-		{
-			/** Long line */
-			g.drawLine(trackStartX, height * 0.75f, trackEndX, height * 0.75f);
+				materialTexture->fillPath(layerGraphics, createSliderCapPath<Orientation>(0, 0, sliderCapCross, sliderCapLength),
+					materialOpacity);
+			});
+
+		g.drawImage(layer, sliderCapBounds.toFloat());
+	}
+
+	/** Returns the path (shape) of the slider cap: a pentagon that points at the grading lines */
+	template <typename Orientation>
+	juce::Path createSliderCapPath(int sliderCapCrossStart, int sliderCapLengthStart,
+		int sliderCapCross, int sliderCapLength, bool roundedCorners = true)
+	{
+		const float crossStart = (float)sliderCapCrossStart;
+		const float lengthStart = (float)sliderCapLengthStart;
+		const float crossEnd = crossStart + sliderCapCross;
+		const float lengthEnd = lengthStart + sliderCapLength;
+
+		juce::Path sliderCapShape;
+		const int sliderCapCornerSize = 2;
+		sliderCapShape.startNewSubPath(Orientation::makePoint(crossStart, lengthStart));
+		sliderCapShape.lineTo(Orientation::makePoint(crossStart, lengthEnd));
+		sliderCapShape.lineTo(Orientation::makePoint(crossStart + sliderCapCross * 0.666f, lengthEnd));
+		sliderCapShape.lineTo(Orientation::makePoint(crossEnd, lengthStart + sliderCapLength / 2.f));	//Pointer (points to value)
+		sliderCapShape.lineTo(Orientation::makePoint(crossStart + sliderCapCross * 0.666f, lengthStart));
+		sliderCapShape.closeSubPath();
+
+		return roundedCorners ? sliderCapShape.createPathWithRoundedCorners(sliderCapCornerSize) : sliderCapShape;
+	}
 
-			/** Shorter lines */
-			for (int i = 0; i < 5; i++)
+	/** Draws the grading lines from a cached alpha mask the size of the slider */
+	template <typename Orientation>
+	void drawGrading(juce::Graphics& g, const FaderTrack& track, int width, int height, juce::Slider& slider,
+		const LevelOfDetail::Options& renderOptions)
+	{
+		const auto mask = renderCache->getMask(
+			RenderCache::makeKey(ControlType::synthBipolarFader, gradingLayer, slider.getWidth(), slider.getHeight(), g, Orientation::sliderStyle),
+			[this, track, width, height](juce::Graphics& maskGraphics)
 			{
-				g.drawLine(trackStartX + i * trackWidth / 4, height * 0.75f, trackStartX + i * trackWidth / 4, height * 0.55f);
-			}
-			for (int i = 0; i < 21; i++)
+				paintGradingLines<Orientation>(maskGraphics, track, width, height);
+			}, &slider);
+
+		/** The bipolar grading follows the outline colour, a shade darker. */
+		RenderCache::drawMask(g, mask, slider.getLocalBounds().toFloat(), getTheme()->getColours().sliderOutline.darker(0.5));
+	}
+
+	/** Paints the grading lines */
+	template <typename Orientation>
+	void paintGradingLines(juce::Graphics& g, const FaderTrack& track, int width, int height)
+	{
+		const float crossSize = Orientation::getCross(juce::Rectangle<float>((float)width, (float)height));
+
+		auto drawCrossLine = [&g](float length, float crossFrom, float crossTo)
+		{
+			g.drawLine(juce::Line(Orientation::makePoint(crossFrom, length), Orientation::makePoint(crossTo, length)));
+		};
+
+		/** Long line */
+		g.drawLine(juce::Line(Orientation::makePoint(crossSize * 0.75f, track.lengthStart),
+			Orientation::makePoint(crossSize * 0.75f, track.getLengthEnd())));
+
+		/** Shorter lines */
+		for (int i = 0; i < 5; i++)
+		{
+			drawCrossLine(track.lengthStart + i * track.lengthSize / 4, crossSize * 0.75f, crossSize * 0.55f);
+		}
+		for (int i = 0; i < 21; i++)
+		{
+			if (i % 5 != 0)
 			{
-				if (i % 5 != 0)
-				{
-					g.drawLine(trackStartX + i * trackWidth / 20, height * 0.75f, trackStartX + i * trackWidth / 20, height * 0.6f);
-				}
+				drawCrossLine(track.lengthStart + i * track.lengthSize / 20, crossSize * 0.75f, crossSize * 0.6f);
 			}
 		}
 	}
@@ -265,12 +285,14 @@ public:
 
 		juce::Label* sliderTextBoxPtr = LookAndFeel_V4::createSliderTextBox(slider);
 
-		sliderTextBoxPtr->setColour(juce::Label::textColourId, juce::Colours::beige);
+		const auto theme = getTheme();
+
+		sliderTextBoxPtr->setColour(juce::Label::textColourId, theme->getColours().text);
 		sliderTextBoxPtr->setColour(juce::Label::backgroundColourId, juce::Colours::transparentBlack);
 		sliderTextBoxPtr->setColour(juce::Label::outlineColourId, juce::Colours::transparentBlack);
-		sliderTextBoxPtr->setColour(juce::Label::textWhenEditingColourId, juce::Colours::beige);
-		sliderTextBoxPtr->setColour(juce::Label::backgroundWhenEditingColourId, juce::Colours::black);
-		sliderTextBoxPtr->setColour(juce::Label::outlineWhenEditingColourId, juce::Colours::beige);
+		sliderTextBoxPtr->setColour(juce::Label::textWhenEditingColourId, theme->getColours().text);
+		sliderTextBoxPtr->setColour(juce::Label::backgroundWhenEditingColourId, theme->getColours().textEditorBackground);
+		sliderTextBoxPtr->setColour(juce::Label::outlineWhenEditingColourId, theme->getColours().text);
 
 		// ToDo: Fix text box justification when editing the value
 
@@ -280,71 +302,159 @@ public:
 #pragma endregion
 
 
+#pragma region Painted value readout
+	/**
+	 * Draws the value in the text box area when the slider has no text box (see PaintedValueReadout),
+	 * instead of using a Label component.
+	 */
+	void setPaintedValueReadout(bool shouldPaintValueReadout)
+	{
+		paintedValueReadout = shouldPaintValueReadout;
+	}
+
+	bool getPaintedValueReadout()
+	{
+		return paintedValueReadout;
+	}
+
+	/** Draws the value from the digit glyph atlas, in the same colour as the text box */
+	void drawValueReadout(juce::Graphics& g, juce::Slider& slider)
+	{
+		const auto textBoxBounds = getSliderLayout(slider).textBoxBounds;
+
+		digitGlyphAtlas->drawValue(g, slider, textBoxBounds,
+			juce::jmin(15.f, textBoxBounds.getHeight() * 0.8f), getTheme()->getColours().text);
+	}
+#pragma endregion
+
+
+#pragma region Surface material
+	/**
+	 * Overlays the rough plastic texture on the slider cap (see MaterialTexture).
+	 * Not drawn at the levels of detail without gradients or with simplified geometry.
+	 */
+	void setSurfaceMaterial(bool shouldUseSurfaceMaterial)
+	{
+		surfaceMaterial = shouldUseSurfaceMaterial;
+	}
+
+	bool getSurfaceMaterial()
+	{
+		return surfaceMaterial;
+	}
+#pragma endregion
+
+
+#pragma region Level of detail
+	/** Sets the slider lengths where the level of detail changes */
+	void setLevelOfDetailThresholds(LevelOfDetail::Thresholds newThresholds)
+	{
+		levelOfDetail.setThresholds(newThresholds);
+	}
+
+	LevelOfDetail::Thresholds getLevelOfDetailThresholds()
+	{
+		return levelOfDetail.getThresholds();
+	}
+
+	/** Returns the level of detail the slider is drawn at */
+	LevelOfDetail::Tier getLevelOfDetailTier(juce::Slider& slider)
+	{
+		const auto sliderBounds = getSliderLayout(slider).sliderBounds;
+		return levelOfDetail.getTier(juce::jmax(sliderBounds.getWidth(), sliderBounds.getHeight()));
+	}
+#pragma endregion
+
+
+#pragma region Repaint suppression
+	/**
+	 * Returns the position of the slider cap, in physical pixels, on the track it is drawn on.
+	 * When this doesn't change the cap moves by less than a physical pixel and the slider doesn't need a repaint for it.
+	 *
+	 * \param physicalPixelScale Physical pixels per logical pixel of the slider.
+	 */
+	int getQuantisedThumbPosition(juce::Slider& slider, float physicalPixelScale)
+	{
+		return getQuantisedFaderCapPosition(*this, slider, physicalPixelScale);
+	}
+#pragma endregion
+
+
 #pragma region Colour getters and setters
+	/**
+	 * Returns the theme the slider is drawn with: the current theme (or the one set with setTheme()),
+	 * with the colours changed through the setters below applied on top.
+	 */
+	Theme::Ptr getTheme() const
+	{
+		return colourOverrides.applyTo(baseTheme != nullptr ? baseTheme : Theme::getCurrent());
+	}
+
+	/** Follows a theme of its own instead of the current theme. Pass nullptr to follow the current theme again. */
+	void setTheme(Theme::Ptr newTheme)
+	{
+		baseTheme = std::move(newTheme);
+	}
+
+	/** Draws with the colours of the theme again, forgetting the ones changed through the setters. */
+	void resetColours()
+	{
+		colourOverrides.clear();
+	}
+
 	/** Background colour */
 	void setBackgroundColour(juce::Colour newColour)
 	{
-		backgroundColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderBackground, newColour);
 	}
 
 	juce::Colour getBackgroundColour()
 	{
-		return backgroundColour;
+		return getTheme()->getColours().sliderBackground;
 	}
 
 	/** Outline colour */
 	void setOutlineColour(juce::Colour newColour)
 	{
-		outlineColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderOutline, newColour);
 	}
 
 	juce::Colour getOutlineColour()
 	{
-		return outlineColour;
+		return getTheme()->getColours().sliderOutline;
 	}
 
 	/** Slider cap colour */
 	void setSliderCapColour(juce::Colour newColour)
 	{
-		sliderCapColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderCap, newColour);
 	}
 
 	juce::Colour getSliderCapColour()
 	{
-		return sliderCapColour;
+		return getTheme()->getColours().sliderCap;
 	}
 
 	/** Slider cap line colour */
 	void setSliderCapLineColour(juce::Colour newColour)
 	{
-		sliderCapCenterLineColour = newColour;
+		colourOverrides.set(&Theme::Colours::sliderCapLine, newColour);
 	}
 
 	juce::Colour getSliderCapLineColour()
 	{
-		return sliderCapCenterLineColour;
+		return getTheme()->getColours().sliderCapLine;
 	}
+
 #pragma endregion
 
 
 private:
-	/** Colours */
-	juce::Colour backgroundColour = juce::Colours::transparentWhite;
-	juce::Colour outlineColour = juce::Colours::beige;
-	juce::Colour sliderCapColour = juce::Colours::darkgrey;
-	juce::Colour sliderCapCenterLineColour = juce::Colours::black;
-
+	/** Theme followed instead of the current one, if any */
+	Theme::Ptr baseTheme;
+	/** Colours changed through the setters */
+	Theme::Overrides colourOverrides;
 
-	/** Outline */
-	juce::Rectangle<int> outlinedRectangle;
-
-	/** Slider Track */
-	float trackWidth;
-	float trackHeight;
-	float trackStartX;
-	float trackEndX;
-	float trackStartY;
-	float trackEndY;
 
 	/** Generic */
 	const float border = 2;
@@ -352,6 +462,30 @@ private:
 	const float lineThickness = 1.f;
 	static const int numberOfDecimalPlaces = 2;
 
-	juce::DropShadow dropShadow = juce::DropShadow(juce::Colours::black.withAlpha(0.8f), 20, juce::Point(-5, 5));
+	BoxBlurShadow dropShadow = BoxBlurShadow(juce::Colours::black.withAlpha(0.8f), 20, juce::Point(-5, 5));
+
+	/** Cached layers. Single-colour layers are stored as alpha masks and tinted when drawn. */
+	enum CachedLayer
+	{
+		outlineLayer,
+		gradingLayer,
+		sliderCapShadowLayer,
+		sliderCapMaterialLayer
+	};
+
+	/** Layers are shared with every other control in the process */
+	juce::SharedResourcePointer<RenderCache> renderCache;
+
+	/** Level of detail, measured on the slider length */
+	LevelOfDetail levelOfDetail = LevelOfDetail({ 120, 480 });
+
+	/** Painted value readout */
+	bool paintedValueReadout = false;
+	juce::SharedResourcePointer<DigitGlyphAtlas> digitGlyphAtlas;
+
+	/** Surface material */
+	static constexpr float materialOpacity = 0.25f;
+	bool surfaceMaterial = false;
+	juce::SharedResourcePointer<MaterialTexture> materialTexture;
 };
 
@@ -2,6 +2,9 @@
 
 #include "JuceHeader.h"
 #include "..\Shapes\Shapes.h"
+#include "..\Rendering\LevelOfDetail.h"
+#include "..\Rendering\Theme.h"
+#include "..\Rendering\RoundedRectRasteriser.h"
 
 using namespace juce;
 /**
@@ -22,6 +25,18 @@ public:
 		Noise
 	};
 
+	/**
+	 * Button states that look different.
+	 */
+	enum ButtonState
+	{
+		normalState,
+		overState,
+		downState
+	};
+
+	static constexpr int numButtonStates = 3;
+
 
 #pragma region Draw methods
 	/**
@@ -50,7 +65,20 @@ public:
 	void drawButtonBody(Graphics& g, Button& button,
 		bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown)
 	{
-		auto localBounds = button.getLocalBounds();
+		drawButtonBody(g, button.getLocalBounds(), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
+	}
+
+	/**
+	 * Draws a button body in the given area (e.g. a segment of a WaveformSelector).
+	 *
+	 * \param Graphics& g: Reference to a graphics context used for drawing a component or image.
+	 * \param Rectangle<int> localBounds: The area to draw the body in.
+	 * \param Bool shouldDrawButtonAsHighlighted:True if the button should be draw.
+	 * \param Bool shouldDrawButtonAsDown:True if the button should appeat pressed.
+	 */
+	void drawButtonBody(Graphics& g, Rectangle<int> localBounds,
+		bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown)
+	{
 		auto localX = localBounds.getX();
 		auto localY = localBounds.getY();
 		auto localWidth = localBounds.getWidth();
@@ -60,21 +88,27 @@ public:
 
 		auto darkPoint = Point<float>(localX + localWidth * 0.5f, localY + localHeight * 0.5f);
 
-		if (!shouldDrawButtonAsDown)
-		{//Normal state
-			auto buttonBodyColourGradient = ColourGradient(normalButtonColour.brighter(0.2), lightCenter,
-				normalButtonColour, darkPoint, true);
+		/** The over colour is only used if it's different to the normal colour. */
+		auto bodyColour = getButtonStateColour(getButtonState(false, shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown));
 
-			g.setGradientFill(buttonBodyColourGradient);
-			g.fillRoundedRectangle(localBounds.toFloat(), 5);
+		/** Small buttons are filled flat, the light reflection can't be seen at their size. */
+		if (!levelOfDetail.getOptionsForSize(jmin(localWidth, localHeight)).useGradients)
+		{
+			RoundedRectRasteriser::fill(g, localBounds.toFloat(), 5, bodyColour);
+		}
+		else if (!shouldDrawButtonAsDown)
+		{//Normal and over states
+			auto buttonBodyColourGradient = ColourGradient(bodyColour.brighter(0.2), lightCenter,
+				bodyColour, darkPoint, true);
+
+			RoundedRectRasteriser::fill(g, localBounds.toFloat(), 5, buttonBodyColourGradient);
 		}
 		else
 		{
-			auto buttonBodyColourGradient = ColourGradient(downButonColour.brighter(0.3), lightCenter,
-				downButonColour, darkPoint, true);
+			auto buttonBodyColourGradient = ColourGradient(bodyColour.brighter(0.3), lightCenter,
+				bodyColour, darkPoint, true);
 
-			g.setGradientFill(buttonBodyColourGradient);
-			g.fillRoundedRectangle(localBounds.toFloat(), 5);
+			RoundedRectRasteriser::fill(g, localBounds.toFloat(), 5, buttonBodyColourGradient);
 		}
 	}
 
@@ -93,9 +127,9 @@ public:
 		PathStrokeType::JointStyle jointStyle = PathStrokeType::JointStyle();
 		PathStrokeType strokeType(strokeLineThickness, jointStyle);
 
-		g.setColour(Colours::darkorange);
+		g.setColour(getWaveformColour());
 
-		switch (this->waveform)
+		switch (waveform)
 		{
 		case Sawtooth:
 		{
@@ -161,35 +195,138 @@ public:
 #pragma endregion
 
 
+#pragma region Button states
+public:
+	/**
+	 * Returns the state the button is drawn in. States that would be drawn the same return the same value,
+	 * so e.g. hovering doesn't need a repaint while the over colour is the same as the normal colour.
+	 *
+	 * \param Bool isToggled: True if the button is toggled on. Toggled buttons are drawn down.
+	 * \param Bool shouldDrawButtonAsHighlighted:True if the button should be drawn highlighted.
+	 * \param Bool shouldDrawButtonAsDown:True if the button should appeat pressed.
+	 * \return The state to draw the button in.
+	 */
+	ButtonState getButtonState(bool isToggled, bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown)
+	{
+		if (shouldDrawButtonAsDown || isToggled)
+			return downState;
+
+		if (shouldDrawButtonAsHighlighted && getOverButtonColour() != getNormalButtonColour())
+			return overState;
+
+		return normalState;
+	}
+
+	/**
+	 * Returns the body colour of a button state.
+	 *
+	 * \param ButtonState buttonState: The state.
+	 * \return The body colour.
+	 */
+	Colour getButtonStateColour(ButtonState buttonState)
+	{
+		const auto theme = getTheme();
+
+		switch (buttonState)
+		{
+		case overState:		return theme->getColours().buttonOver;
+		case downState:		return theme->getColours().buttonDown;
+		case normalState:
+		default:			return theme->getColours().buttonNormal;
+		}
+	}
+
+	/**
+	 * Returns a value that changes whenever the colours change.
+	 *
+	 * \return The version of the theme the button is drawn with.
+	 */
+	uint32 getThemeVersion() { return getTheme()->getVersion(); }
+#pragma endregion
+
+
+#pragma region Level of detail
+public:
+	/**
+	 * Sets the button sizes (smallest side) where the level of detail changes.
+	 *
+	 * \param LevelOfDetail::Thresholds newThresholds: The new thresholds.
+	 */
+	void setLevelOfDetailThresholds(LevelOfDetail::Thresholds newThresholds) { levelOfDetail.setThresholds(newThresholds); }
+
+	/**
+	 * Returns the button sizes where the level of detail changes.
+	 *
+	 * \return The level of detail thresholds.
+	 */
+	LevelOfDetail::Thresholds getLevelOfDetailThresholds() { return levelOfDetail.getThresholds(); }
+
+	/**
+	 * Returns the level of detail the button is drawn at.
+	 *
+	 * \param Button& button: The button.
+	 * \return The level of detail tier.
+	 */
+	LevelOfDetail::Tier getLevelOfDetailTier(Button& button) { return levelOfDetail.getTier(jmin(button.getWidth(), button.getHeight())); }
+#pragma endregion
+
+
 #pragma region Colour getters & setters
 public:
+	/**
+	 * Returns the theme the button is drawn with: the current theme (or the one set with setTheme()),
+	 * with the colours changed through the setters below applied on top.
+	 *
+	 * \return The theme.
+	 */
+	Theme::Ptr getTheme() const { return colourOverrides.applyTo(baseTheme != nullptr ? baseTheme : Theme::getCurrent()); }
+
+	/**
+	 * Follows a theme of its own instead of the current theme.
+	 *
+	 * \param Theme::Ptr newTheme: The theme, or nullptr to follow the current theme again.
+	 */
+	void setTheme(Theme::Ptr newTheme) { baseTheme = std::move(newTheme); }
+
+	/**
+	 * Draws with the colours of the theme again, forgetting the ones changed through the setters.
+	 */
+	void resetColours() { colourOverrides.clear(); }
+
 	/**
 	 * Returns the background colour of this waveform button.
 	 * 
 	 * \return The background colour of this waveform button.
 	 */
-	Colour getButtonBackgroundColour() { return buttonBackgroundColour;	}
+	Colour getButtonBackgroundColour() { return getTheme()->getColours().buttonBackground; }
 
 	/**
 	 * Returns the normal colour (when not pressed or mouse-overed) of this waveform button.
 	 *
 	 * \return The normal  colour of this waveform button.
 	 */
-	Colour getNormalButtonColour() { return normalButtonColour; }
+	Colour getNormalButtonColour() { return getTheme()->getColours().buttonNormal; }
 
 	/**
 	 * Returns the over colour (when mouse-overed) of this waveform button.
 	 *
 	 * \return The over colour of this waveform button.
 	 */
-	Colour getOverButtonColour() { return overbuttonColour; }
+	Colour getOverButtonColour() { return getTheme()->getColours().buttonOver; }
 
 	/**
 	 * Returns the down colour (when pressed) of this waveform button.
 	 *
 	 * \return The down  colour of this waveform button.
 	 */
-	Colour getDownButtonColour() { return downButonColour; }
+	Colour getDownButtonColour() { return getTheme()->getColours().buttonDown; }
+
+	/**
+	 * Returns the colour of the waveform shape.
+	 *
+	 * \return The colour of the waveform shape.
+	 */
+	Colour getWaveformColour() { return getTheme()->getColours().waveform; }
 
 
 	/**
@@ -197,46 +334,51 @@ public:
 	 * 
 	 * \param Colour& newColour: The colour to change the background to
 	 */
-	void setButtonBackgroundColour(Colour& newColour) { buttonBackgroundColour = newColour; }
+	void setButtonBackgroundColour(Colour& newColour) { colourOverrides.set(&Theme::Colours::buttonBackground, newColour); }
 
 	/**
 	 * Sets the normal colour (when not pressed or mouse-overed) for this waveform button.
 	 *
 	 * \param Colour& newColour: The colour to change the normal colour  to
 	 */
-	void setNormalButtonColour(Colour& newColour) { normalButtonColour = newColour; }
+	void setNormalButtonColour(Colour& newColour) { colourOverrides.set(&Theme::Colours::buttonNormal, newColour); }
 
 	/**
 	 * Sets the over colour (when mouse-overed) for this waveform button.
 	 *
 	 * \param Colour& newColour: The colour to change the over colour to
 	 */
-	void setOverButtonColour(Colour& newColour) { overbuttonColour = newColour; }
+	void setOverButtonColour(Colour& newColour) { colourOverrides.set(&Theme::Colours::buttonOver, newColour); }
 
 	/**
 	 * Sets the down colour (when pressed) for this waveform button.
 	 *
 	 * \param Colour& newColour: The colour to change the down colour to
 	 */
-	void setDownButtonColour(Colour& newColour) { downButonColour = newColour; }
+	void setDownButtonColour(Colour& newColour) { colourOverrides.set(&Theme::Colours::buttonDown, newColour); }
+
+	/**
+	 * Sets the colour of the waveform shape.
+	 *
+	 * \param Colour& newColour: The colour to change the waveform shape to
+	 */
+	void setWaveformColour(Colour& newColour) { colourOverrides.set(&Theme::Colours::waveform, newColour); }
+
 #pragma endregion
 
 
 private:
-	/** Background colour */
-	Colour buttonBackgroundColour = Colours::transparentBlack;
-	
-	/** Button colours */
-	/** Normal button colour */
-	Colour normalButtonColour = Colours::black.brighter(0.2);
-	/** Over (when mouse-overring) button colour */
-	Colour overbuttonColour = Colours::black.brighter(0.2);
-	/** Down (when pressed) button colour */
-	Colour downButonColour = Colours::black.brighter(0.6);
+	/** Theme followed instead of the current one, if any */
+	Theme::Ptr baseTheme;
+	/** Colours changed through the setters */
+	Theme::Overrides colourOverrides;
 
 	
 	/** The path of the shape for noise button. */
 	Path noisePath;
 
+	/** Level of detail, measured on the smallest side of the button. */
+	LevelOfDetail levelOfDetail = LevelOfDetail({ 16, 64 });
+
 	
 };
@@ -8,6 +8,9 @@
 
 #include <JuceHeader.h>
 #include "MainComponent.h"
+#include "Benchmark/BenchmarkRunner.h"
+#include "Rendering/CacheWarmUp.h"
+#include "Rendering/RoundedRectRasteriser.h"
 
 //==============================================================================
 class Custom_GUI_ElementsApplication  : public juce::JUCEApplication
@@ -25,14 +28,92 @@ public:
     {
         // This method is where you should put your application's initialisation code..
 
+        /** Benchmarks run headlessly and quit without opening a window. */
+        if (BenchmarkRunner::runFromCommandLine (commandLine))
+        {
+            quit();
+            return;
+        }
+
+        BenchmarkRunner::startRecording (commandLine);
+
+        const auto launchMilliseconds = juce::Time::getMillisecondCounterHiRes();
+
+        /** Layers saved by the last run are mapped back in, so the warm-up and the first frame don't render them again. */
+        const juce::SharedResourcePointer<RenderCache> renderCache;
+        useDiskCache = ! commandLine.contains ("--no-disk-cache");
+
+        if (useDiskCache)
+        {
+            const int numLoaded = renderCache->loadFromFile (RenderCache::getDefaultFile());
+            juce::Logger::writeToLog ("Render cache: " + juce::String (numLoaded) + " layers mapped from "
+                                        + RenderCache::getDefaultFile().getFullPathName());
+        }
+
+        /** Records the layers the controls are missing, and renders them on the render threads while the window is created. */
+        if (! commandLine.contains ("--no-warm-up"))
+        {
+            cacheWarmUp.reset (new CacheWarmUp (CacheWarmUp::getPrimaryDisplayScale()));
+            cacheWarmUp->start();
+        }
+
         mainWindow.reset (new MainWindow (getApplicationName()));
+
+        if (auto* mainComponent = dynamic_cast<MainComponent*> (mainWindow->getContentComponent()))
+        {
+            mainComponent->onFirstFrame = [this, launchMilliseconds] (double paintMilliseconds)
+            {
+                juce::String message;
+                message << "First frame " << juce::String (juce::Time::getMillisecondCounterHiRes() - launchMilliseconds, 1)
+                        << " ms after launch, painted in " << juce::String (paintMilliseconds, 2) << " ms";
+
+                if (cacheWarmUp != nullptr)
+                    message << " (cache warm-up of the first frame " << (cacheWarmUp->isFirstFrameReady() ? juce::String (cacheWarmUp->getFirstFrameSeconds() * 1.0e3, 1) + " ms"
+                                                                                                           : juce::String ("unfinished"))
+                            << ", of everything " << (cacheWarmUp->isDone() ? juce::String (cacheWarmUp->getSeconds() * 1.0e3, 1) + " ms"
+                                                                             : juce::String ("unfinished")) << ")";
+
+                juce::Logger::writeToLog (message);
+            };
+        }
+
+        /** Fills the faders' and buttons' rounded rectangles with the SIMD rasteriser rather than Graphics. */
+        if (commandLine.contains ("--rasterise-rounded-rects"))
+            RoundedRectRasteriser::setEnabled (true);
+
+        /** Renders the controls' missing layers across worker threads. */
+        if (commandLine.contains ("--parallel-layers"))
+            if (auto* mainComponent = dynamic_cast<MainComponent*> (mainWindow->getContentComponent()))
+                mainComponent->setParallelLayerRendering (true);
+
+        /**
+            The first frame is painted once this returns: wait for its layers, up to a limit.
+            The layers of the other controls go on rendering in the background.
+        */
+        if (cacheWarmUp != nullptr)
+            cacheWarmUp->waitUntilFirstFrameReady (maxWarmUpWaitMilliseconds);
     }
 
     void shutdown() override
     {
         // Add your application's shutdown code here..
 
+        /**
+            Saved before the window and its controls are deleted: they hold the shared cache, which would go with them.
+            Only if this run rendered anything new.
+        */
+        if (useDiskCache)
+        {
+            const juce::SharedResourcePointer<RenderCache> renderCache;
+
+            if (renderCache->hasUnsavedLayers())
+                renderCache->saveToFile (RenderCache::getDefaultFile());
+        }
+
         mainWindow = nullptr; // (deletes our window)
+        cacheWarmUp = nullptr;
+
+        BenchmarkRunner::finishRecording();
     }
 
     //==============================================================================
@@ -95,6 +176,14 @@ public:
     };
 
 private:
+    /** The longest the first frame is held back for the cache warm-up. */
+    static constexpr int maxWarmUpWaitMilliseconds = 500;
+
+    /** Set unless --no-disk-cache is given. */
+    bool useDiskCache = false;
+
+    /** Holds the shared caches it filled, so it's deleted after the window. */
+    std::unique_ptr<CacheWarmUp> cacheWarmUp;
     std::unique_ptr<MainWindow> mainWindow;
 };
 
@@ -19,6 +19,8 @@ MainComponent::MainComponent()
 	elementSelectorComboBox.addItem(juce::String("Synth bipolar slider"), 1002);
 	elementSelectorComboBox.addItem(juce::String("Rotary gear-shaped knob"), 1003);
 	elementSelectorComboBox.addItem(juce::String("Waveform buttons"), 1004);
+	elementSelectorComboBox.addItem(juce::String("Waveform selector"), 1005);
+	elementSelectorComboBox.addItem(juce::String("Parameter panel (10,000 parameters)"), 1006);
 	
 
 	elementSelectorComboBox.setColour(juce::ComboBox::ColourIds::backgroundColourId, slider_MixingConsoleStyle_LookAndFeel.getBackgroundColour());
@@ -35,6 +37,12 @@ MainComponent::MainComponent()
 	addChildComponent(slider02Vertical);
 	addChildComponent(slider02Horizontal);
 
+	/** Orientations, picked once here: the LookAndFeels draw the sliders in the orientation of their style. */
+	slider01Vertical.setSliderStyle(juce::Slider::LinearVertical);
+	slider01Horizontal.setSliderStyle(juce::Slider::LinearHorizontal);
+	slider02Vertical.setSliderStyle(juce::Slider::LinearVertical);
+	slider02Horizontal.setSliderStyle(juce::Slider::LinearHorizontal);
+
 	/** Set slider text box button positions and dimensions. */
 	slider01Vertical.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
 	slider01Horizontal.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
@@ -47,13 +55,40 @@ MainComponent::MainComponent()
 	slider02Vertical.setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
 	slider02Horizontal.setLookAndFeel(&slider_SynthBipolar_LookAndFeel);
 
-	/** Set bipolar sliders range. */
+	/** Paint the slider values instead of creating a Label for each. Double-click a value to type one. */
+	slider_MixingConsoleStyle_LookAndFeel.setPaintedValueReadout(true);
+	slider_SynthBipolar_LookAndFeel.setPaintedValueReadout(true);
+	sliderValueReadouts[0].attachTo(&slider01Vertical);
+	sliderValueReadouts[1].attachTo(&slider01Horizontal);
+	sliderValueReadouts[2].attachTo(&slider02Vertical);
+	sliderValueReadouts[3].attachTo(&slider02Horizontal);
+
+	/** Rough plastic slider caps. */
+	slider_MixingConsoleStyle_LookAndFeel.setSurfaceMaterial(true);
+	slider_SynthBipolar_LookAndFeel.setSurfaceMaterial(true);
+
+	/** Set the level sliders' and the bipolar sliders' ranges. */
+	slider01Vertical.setRange(0, 1, 0.01);
+	slider01Horizontal.setRange(0, 1, 0.01);
 	slider02Vertical.setRange(-1, 1, 0.01);
 	slider02Horizontal.setRange(-1, 1, 0.01);
 
+	/** Draw the sliders on the fast path while they are dragged. */
+	sliderInteractionQualities[0].attachTo(&slider01Vertical);
+	sliderInteractionQualities[1].attachTo(&slider01Horizontal);
+	sliderInteractionQualities[2].attachTo(&slider02Vertical);
+	sliderInteractionQualities[3].attachTo(&slider02Horizontal);
+
+	/** Apply at most one drag per frame: high rate mice send several. */
+	for (auto* slider : { &slider01Vertical, &slider01Horizontal, &slider02Vertical, &slider02Horizontal })
+		slider->setDragCoalescing(true);
+
 
 	/** Gear shaped rotary slider */
 	addChildComponent(rotaryKnob_GearShaped);
+	rotaryKnob_GearShaped.setPaintedValueReadout(true);
+	rotaryKnob_GearShaped.setSurfaceMaterial(true);
+	rotaryKnob_GearShaped.setDragCoalescing(true);
 
 
 	/** Sawtooth button */
@@ -76,6 +111,56 @@ MainComponent::MainComponent()
 	noiseButton.setWaveform(WaveformButton_LookAndFeel::Noise);
 	addChildComponent(noiseButton);
 
+	/** Waveform selector */
+	addChildComponent(waveformSelector);
+
+	/** Parameter panel. Its controls are only created for the parameters in view, once it's shown. */
+	parameterPanel.setParameters(ParameterPanel::createTestParameters(10000));
+	addChildComponent(parameterPanel);
+
+	resizeInteractionQuality.attachTo(this);
+
+	/**
+	 * Repaint the custom controls once per vblank, skipping repaints that wouldn't change anything.
+	 * Knob and fader value changes only repaint when the pointer or cap moves by a whole physical pixel.
+	 * The faders' LookAndFeels can override colours of the theme, so their theme versions are part of the state too.
+	 */
+	for (auto* slider : { &slider01Vertical, &slider01Horizontal })
+	{
+		repaintScheduler.addControl(*slider, [this, slider]
+			{
+				const auto state = RepaintScheduler::getSliderVisualState(*slider, slider_MixingConsoleStyle_LookAndFeel
+					.getQuantisedThumbPosition(*slider, RepaintScheduler::getPhysicalPixelScale(*slider)));
+
+				return RepaintScheduler::combineVisualState(state, (juce::int64)slider_MixingConsoleStyle_LookAndFeel.getTheme()->getVersion());
+			});
+	}
+
+	for (auto* slider : { &slider02Vertical, &slider02Horizontal })
+	{
+		repaintScheduler.addControl(*slider, [this, slider]
+			{
+				const auto state = RepaintScheduler::getSliderVisualState(*slider, slider_SynthBipolar_LookAndFeel
+					.getQuantisedThumbPosition(*slider, RepaintScheduler::getPhysicalPixelScale(*slider)));
+
+				return RepaintScheduler::combineVisualState(state, (juce::int64)slider_SynthBipolar_LookAndFeel.getTheme()->getVersion());
+			});
+	}
+
+	repaintScheduler.addControl(rotaryKnob_GearShaped, [this]
+		{
+			return RepaintScheduler::getSliderVisualState(rotaryKnob_GearShaped, rotaryKnob_GearShaped
+				.getQuantisedPointerPosition(RepaintScheduler::getPhysicalPixelScale(rotaryKnob_GearShaped)));
+		});
+
+	for (auto* button : { &sawtoothButton, &pulseButton, &triangleButton, &sinewaveButton, &noiseButton })
+	{
+		repaintScheduler.addControl(*button, [button] { return RepaintScheduler::getButtonVisualState(*button, (int)button->getRenderedState()); });
+	}
+
+	/** The selector only repaints the segments that change, so its repaints are just coalesced. */
+	repaintScheduler.addControl(waveformSelector);
+
 	setSize(600, 400);
 }
 
@@ -88,16 +173,47 @@ MainComponent::~MainComponent()
 //==============================================================================
 void MainComponent::paint(juce::Graphics& g)
 {
+	/** The children are painted between paint() and paintOverChildren(), so the two bracket the whole frame. */
+	if (!firstFramePainted)
+		firstFrameStartMilliseconds = juce::Time::getMillisecondCounterHiRes();
+}
 
+void MainComponent::paintOverChildren(juce::Graphics& g)
+{
+	if (firstFramePainted)
+		return;
+
+	firstFramePainted = true;
+
+	if (onFirstFrame != nullptr)
+		onFirstFrame(juce::Time::getMillisecondCounterHiRes() - firstFrameStartMilliseconds);
+}
+
+void MainComponent::setParallelLayerRendering(bool shouldRenderLayersInParallel)
+{
+	if (shouldRenderLayersInParallel == getParallelLayerRendering())
+		return;
+
+	setCachedComponentImage(shouldRenderLayersInParallel ? new ParallelLayerRenderer(*this) : nullptr);
+	repaint();
+}
+
+bool MainComponent::getParallelLayerRendering()
+{
+	return dynamic_cast<ParallelLayerRenderer*>(getCachedComponentImage()) != nullptr;
 }
 
 void MainComponent::resized()
 {
+	/** Everything is drawn on the fast path until the resize settles, then repainted once at full quality. */
+	resizeInteractionQuality.resizeStarted();
+
 	juce::Rectangle localBounds = getLocalBounds();
 	elementSelectorComboBox.setBounds(localBounds.removeFromTop(30));
 	localBounds.removeFromTop(10);
 
 	rotaryKnob_GearShaped.setBounds(localBounds);
+	parameterPanel.setBounds(localBounds);
 
 	/** Waveform buttons */
 	for (int i = 0; i < 5; i++)
@@ -131,6 +247,9 @@ void MainComponent::resized()
 	}
 
 
+	/** Waveform selector, where the waveform buttons are */
+	waveformSelector.setBounds(localBounds.getX(), localBounds.getY(), 30, 5 * (20 + 5) - 5);
+
 	auto verticalSliderBounds = localBounds.removeFromLeft(100);
 	localBounds.removeFromLeft(10);
 	auto horizontalSliderBounds = localBounds.removeFromBottom(140);
@@ -180,6 +299,16 @@ void MainComponent::comboBoxChanged(juce::ComboBox* comboBoxThatHasChanged)
 			noiseButton.setVisible(true);
 			break;
 		}
+		case 4:	 //Waveform selector
+		{
+			waveformSelector.setVisible(true);
+			break;
+		}
+		case 5:	 //Parameter panel
+		{
+			parameterPanel.setVisible(true);
+			break;
+		}
 		default:
 		{
 			slider01Vertical.setVisible(true);
@@ -204,4 +333,8 @@ void MainComponent::makeAllControlsInvisible()
 	triangleButton.setVisible(false);
 	sinewaveButton.setVisible(false);
 	noiseButton.setVisible(false);
+
+	waveformSelector.setVisible(false);
+
+	parameterPanel.setVisible(false);
 }
@@ -3,8 +3,15 @@
 #include <JuceHeader.h>
 #include "LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
 #include "LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+#include "Components/CoalescingSlider.h"
 #include "Components/RotaryKnob_GearShaped.h"
 #include "Components/WaveformButton.h"
+#include "Components/WaveformSelector.h"
+#include "Components/PaintedValueReadout.h"
+#include "Components/ParameterPanel.h"
+#include "Rendering/InteractionQuality.h"
+#include "Rendering/RepaintScheduler.h"
+#include "Rendering/ParallelLayerRenderer.h"
 
 //==============================================================================
 /*
@@ -20,8 +27,19 @@ public:
 
     //==============================================================================
     void paint (juce::Graphics&) override;
+    void paintOverChildren (juce::Graphics&) override;
     void resized() override;
 
+    /** Called once the first frame has been painted, with the time painting it took, in milliseconds. */
+    std::function<void (double paintMilliseconds)> onFirstFrame;
+
+    /**
+     * Renders the controls' missing layers on worker threads (see ParallelLayerRenderer) instead of on the
+     * message thread only. Off by default.
+     */
+    void setParallelLayerRendering (bool shouldRenderLayersInParallel);
+    bool getParallelLayerRendering();
+
 private:
     /** The combo box for GUI element selection */
     juce::ComboBox elementSelectorComboBox;
@@ -29,20 +47,28 @@ private:
     /** LookAndFeel for the mixing console style slider */
     Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
     /** Vertical mixing console style slider */
-    juce::Slider slider01Vertical;
+    CoalescingSlider slider01Vertical;
     /** Horizontal mixing console style slider */
-    juce::Slider slider01Horizontal;
+    CoalescingSlider slider01Horizontal;
     
     /** LookAndFeel for the synth bipolar slider */
     Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
     /** Vertical bipolar slider */
-    juce::Slider slider02Vertical;
+    CoalescingSlider slider02Vertical;
     /** Horizontal bipolar slider */
-    juce::Slider slider02Horizontal;
+    CoalescingSlider slider02Horizontal;
 
 
     RotaryKnob_GearShaped rotaryKnob_GearShaped;
 
+    /** Value readouts painted by the slider LookAndFeels instead of Label text boxes */
+    std::array<PaintedValueReadout, 4> sliderValueReadouts;
+
+    /** Fast path rendering while the faders are dragged */
+    std::array<InteractionQuality, 4> sliderInteractionQualities;
+    /** Fast path rendering while the window is resized */
+    InteractionQuality resizeInteractionQuality;
+
 
     // Waveform selection buttons
     
@@ -52,7 +78,20 @@ private:
     WaveformButton sinewaveButton = WaveformButton(String("sinewaveButton"));
     WaveformButton noiseButton = WaveformButton(String("noiseButton"));
 
+    /** The same waveforms as the buttons above, as one radio group component */
+    WaveformSelector waveformSelector;
+
+    /** Every control type at once, for a parameter set too large to give each parameter a control */
+    ParameterPanel parameterPanel;
+
+    /** Coalesces the repaints of the controls above to one per vblank. Declared after them so it's destroyed first. */
+    RepaintScheduler repaintScheduler { *this };
+
     
+    /** When the first frame started painting. */
+    double firstFrameStartMilliseconds = 0.0;
+    bool firstFramePainted = false;
+
     void makeAllControlsInvisible();
 
     // Inherited via Listener
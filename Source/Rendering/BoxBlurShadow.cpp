@@ -0,0 +1,197 @@
+/*
+  ==============================================================================
+
+    BoxBlurShadow.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "BoxBlurShadow.h"
+#include "FloatLanes.h"
+
+namespace
+{
+	/**
+	 * Adds one row to the running sums and takes another away, writing the average of what's left
+	 * in between: for each pixel, destination = (sums + entering) * scale, then sums += entering - leaving.
+	 * Returns the first pixel left undone.
+	 */
+	template <typename Floats>
+	int slideRow(float* sums, float* destination, const float* entering, const float* leaving, int firstPixel, int numPixels, float scale)
+	{
+		int pixel = firstPixel;
+
+		for (; pixel + Floats::numLanes <= numPixels; pixel += Floats::numLanes)
+		{
+			const auto sum = Floats::load(sums + pixel) + Floats::load(entering + pixel);
+
+			(sum * Floats(scale)).store(destination + pixel);
+			(sum - Floats::load(leaving + pixel)).store(sums + pixel);
+		}
+
+		return pixel;
+	}
+
+	/**
+	 * Box blurs every column of a width by height float image at once, a row at a time, treating
+	 * everything past the top and bottom as zero. The source and destination must not overlap.
+	 * sums and zeros are scratch rows of width floats.
+	 */
+	void boxBlurColumns(const float* source, float* destination, int width, int height, int radius, float* sums, const float* zeros)
+	{
+		const float scale = 1.f / (2 * radius + 1);
+
+		std::fill(sums, sums + width, 0.f);
+
+		/** Prime the sums with the rows above the first one's window centre. */
+		for (int y = 0; y < juce::jmin(radius, height); y++)
+		{
+			const auto* row = source + (size_t)y * (size_t)width;
+
+			for (int x = 0; x < width; x++)
+				sums[x] += row[x];
+		}
+
+		for (int y = 0; y < height; y++)
+		{
+			const auto* entering = y + radius < height ? source + (size_t)(y + radius) * (size_t)width : zeros;
+			const auto* leaving = y - radius >= 0 ? source + (size_t)(y - radius) * (size_t)width : zeros;
+			auto* row = destination + (size_t)y * (size_t)width;
+
+			int pixel = slideRow<FloatLanes::Native>(sums, row, entering, leaving, 0, width, scale);
+			slideRow<FloatLanes::Scalar>(sums, row, entering, leaving, pixel, width, scale);
+		}
+	}
+
+	/** Writes the transpose of a width by height float image, a block at a time. */
+	void transpose(const float* source, float* destination, int width, int height)
+	{
+		constexpr int blockSize = 16;
+
+		for (int top = 0; top < height; top += blockSize)
+			for (int left = 0; left < width; left += blockSize)
+				for (int y = top; y < juce::jmin(top + blockSize, height); y++)
+					for (int x = left; x < juce::jmin(left + blockSize, width); x++)
+						destination[(size_t)x * (size_t)height + (size_t)y] = source[(size_t)y * (size_t)width + (size_t)x];
+	}
+}
+
+BoxBlurShadow::BoxBlurShadow(juce::Colour shadowColour, int shadowRadius, juce::Point<int> shadowOffset)
+	: colour(shadowColour), radius(shadowRadius), offset(shadowOffset)
+{
+	jassert(radius > 0);
+}
+
+void BoxBlurShadow::drawForPath(juce::Graphics& g, const juce::Path& path) const
+{
+	jassert(radius > 0);
+
+	/** The same area juce::DropShadow covers, in logical pixels. */
+	const auto area = (path.getBounds().getSmallestIntegerContainer() + offset).expanded(radius + 1)
+		.getIntersection(g.getClipBounds().expanded(radius + 1));
+
+	if (area.getWidth() <= 2 || area.getHeight() <= 2)
+		return;
+
+	const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+	const auto physicalArea = (area.toFloat() * scale).getSmallestIntegerContainer();
+
+	juce::Image mask(juce::Image::SingleChannel, physicalArea.getWidth(), physicalArea.getHeight(), true, juce::SoftwareImageType());
+
+	{
+		juce::Graphics maskGraphics(mask);
+		maskGraphics.setColour(juce::Colours::white);
+		maskGraphics.fillPath(path, juce::AffineTransform::translation(offset.toFloat())
+			.scaled(scale)
+			.translated(-physicalArea.getPosition().toFloat()));
+	}
+
+	blurSingleChannel(mask, getSigmaForRadius((float)radius) * scale);
+
+	g.setColour(colour);
+	g.drawImageTransformed(mask, juce::AffineTransform::scale(1.f / scale)
+		.translated(physicalArea.getX() / scale, physicalArea.getY() / scale), true);
+}
+
+void BoxBlurShadow::drawForRectangle(juce::Graphics& g, const juce::Rectangle<int>& area) const
+{
+	toDropShadow().drawForRectangle(g, area);
+}
+
+void BoxBlurShadow::blurSingleChannel(juce::Image& image, float sigma)
+{
+	jassert(image.getFormat() == juce::Image::SingleChannel);
+
+	const juce::Image::BitmapData bitmap(image, juce::Image::BitmapData::readWrite);
+	const int width = bitmap.width;
+	const int height = bitmap.height;
+
+	if (width <= 0 || height <= 0 || sigma <= 0.f)
+		return;
+
+	const auto radii = getBoxRadii(sigma);
+	const auto numPixels = (size_t)width * (size_t)height;
+	const int longestRow = juce::jmax(width, height);
+
+	juce::HeapBlock<float> front(numPixels), back(numPixels), sums(longestRow), zeros(longestRow, true);
+
+	for (int y = 0; y < height; y++)
+	{
+		const auto* line = bitmap.getLinePointer(y);
+		auto* row = front.get() + (size_t)y * (size_t)width;
+
+		for (int x = 0; x < width; x++)
+			row[x] = line[x * bitmap.pixelStride];
+	}
+
+	/** Three passes down the columns end in back, transposed into front; the same across the rows ends in back again. */
+	boxBlurColumns(front, back, width, height, radii[0], sums, zeros);
+	boxBlurColumns(back, front, width, height, radii[1], sums, zeros);
+	boxBlurColumns(front, back, width, height, radii[2], sums, zeros);
+	transpose(back, front, width, height);
+
+	boxBlurColumns(front, back, height, width, radii[0], sums, zeros);
+	boxBlurColumns(back, front, height, width, radii[1], sums, zeros);
+	boxBlurColumns(front, back, height, width, radii[2], sums, zeros);
+	transpose(back, front, height, width);
+
+	for (int y = 0; y < height; y++)
+	{
+		auto* line = bitmap.getLinePointer(y);
+		const auto* row = front.get() + (size_t)y * (size_t)width;
+
+		for (int x = 0; x < width; x++)
+			line[x * bitmap.pixelStride] = (juce::uint8)juce::jlimit(0, 255, juce::roundToInt(row[x]));
+	}
+}
+
+std::array<int, 3> BoxBlurShadow::getBoxRadii(float sigma)
+{
+	/**
+	 * Boxes of width w have a variance of (w * w - 1) / 12, so three of the ideal width add up to the
+	 * Gaussian's. Widths have to be odd: the first few boxes take the odd width below it and the rest
+	 * the one above, as many of each as brings the total variance closest.
+	 */
+	constexpr int numBoxes = 3;
+	const float variance = sigma * sigma;
+
+	const float idealWidth = std::sqrt(12.f * variance / numBoxes + 1.f);
+	int lowerWidth = (int)std::floor(idealWidth);
+
+	if (lowerWidth % 2 == 0)
+		lowerWidth--;
+
+	const int upperWidth = lowerWidth + 2;
+	const float idealNumLower = (12.f * variance - numBoxes * lowerWidth * lowerWidth - 4.f * numBoxes * lowerWidth - 3.f * numBoxes)
+		/ (-4.f * lowerWidth - 4.f);
+	const int numLower = juce::roundToInt(idealNumLower);
+
+	std::array<int, 3> radii {};
+
+	for (int box = 0; box < numBoxes; box++)
+		radii[(size_t)box] = ((box < numLower ? lowerWidth : upperWidth) - 1) / 2;
+
+	return radii;
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    BoxBlurShadow.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * A drop shadow with the members and drawing functions of juce::DropShadow, blurred faster.
+ *
+ * juce::DropShadow blurs a path's mask with 2 * radius passes of a three pixel box each way, so
+ * the work per pixel grows with the radius. This blurs the same mask with three box passes each way
+ * sized to the same Gaussian, kept as running sums, so the work per pixel is the same at any radius.
+ * The vertical passes add whole rows FloatLanes::Native::numLanes pixels at a time; the horizontal
+ * ones run the same code on the transposed mask.
+ *
+ * The mask is rendered at the context's physical pixel scale rather than at its logical size.
+ */
+struct BoxBlurShadow
+{
+	BoxBlurShadow() = default;
+	BoxBlurShadow(juce::Colour shadowColour, int shadowRadius, juce::Point<int> shadowOffset);
+
+	/** Same as juce::DropShadow::drawForPath(). */
+	void drawForPath(juce::Graphics& g, const juce::Path& path) const;
+
+	/**
+	 * Same as juce::DropShadow::drawForRectangle(), which draws the shadow with gradients rather
+	 * than a blur, so it's drawn the same way.
+	 */
+	void drawForRectangle(juce::Graphics& g, const juce::Rectangle<int>& area) const;
+
+	/** The juce::DropShadow this replaces. */
+	juce::DropShadow toDropShadow() const { return { colour, radius, offset }; }
+
+	/** Blurs a single channel image in place with three box blurs each way approximating a Gaussian. */
+	static void blurSingleChannel(juce::Image& image, float sigma);
+
+	/** The standard deviation of the blur juce::DropShadow applies for a radius: 2 * radius three pixel boxes. */
+	static float getSigmaForRadius(float radius) { return std::sqrt(4.f * radius / 3.f); }
+
+	/** The half widths of three boxes whose successive blurs approximate a Gaussian of this standard deviation. */
+	static std::array<int, 3> getBoxRadii(float sigma);
+
+	juce::Colour colour { 0x90000000 };
+	int radius = 4;
+	juce::Point<int> offset;
+};
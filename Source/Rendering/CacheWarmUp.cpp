@@ -0,0 +1,175 @@
+/*
+  ==============================================================================
+
+    CacheWarmUp.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "CacheWarmUp.h"
+
+CacheWarmUp::CacheWarmUp(float physicalPixelScale, int maxThreadsToUse)
+	: juce::Thread("Cache warm-up"),
+	scale(physicalPixelScale),
+	maxThreads(maxThreadsToUse)
+{
+	slider_MixingConsoleStyle_LookAndFeel.setPaintedValueReadout(true);
+	slider_SynthBipolar_LookAndFeel.setPaintedValueReadout(true);
+	slider_MixingConsoleStyle_LookAndFeel.setSurfaceMaterial(true);
+	slider_SynthBipolar_LookAndFeel.setSurfaceMaterial(true);
+
+	/** The sizes MainComponent lays its controls out at in its initial 600x400 window, which shows the knob. */
+	auto* knob = new RotaryKnob_GearShaped();
+	knob->setPaintedValueReadout(true);
+	knob->setSurfaceMaterial(true);
+	addControl(knob, 600, 360);
+
+	numFirstFrameControls = controls.size();
+
+	addFader(slider_MixingConsoleStyle_LookAndFeel, 490, 140, false);
+	addFader(slider_SynthBipolar_LookAndFeel, 490, 140, true);
+	addFader(slider_MixingConsoleStyle_LookAndFeel, 100, 360, false);
+	addFader(slider_SynthBipolar_LookAndFeel, 100, 360, true);
+
+	for (int i = (int)std::size(commonKnobSizes); --i >= 0;)
+	{
+		auto* commonKnob = new RotaryKnob_GearShaped();
+		commonKnob->setPaintedValueReadout(true);
+		commonKnob->setSurfaceMaterial(true);
+		addControl(commonKnob, commonKnobSizes[i], commonKnobSizes[i]);
+	}
+
+	addControl(new WaveformSelector(), 30, 5 * (20 + 5) - 5);
+
+	/** Every state of every waveform: each one is a layer of its own. */
+	for (int waveform = WaveformButton_LookAndFeel::Sawtooth; waveform <= WaveformButton_LookAndFeel::Noise; waveform++)
+	{
+		for (const auto state : { juce::Button::buttonNormal, juce::Button::buttonOver, juce::Button::buttonDown })
+		{
+			auto* button = new WaveformButton("warmUpButton");
+			button->setWaveform((WaveformButton_LookAndFeel::Waveform)waveform);
+			button->setState(state);
+			addControl(button, 30, 20);
+		}
+	}
+}
+
+CacheWarmUp::~CacheWarmUp()
+{
+	stopThread(-1);
+
+	valueReadouts.clear();
+
+	for (auto* control : controls)
+		control->setLookAndFeel(nullptr);
+}
+
+void CacheWarmUp::start()
+{
+	JUCE_ASSERT_MESSAGE_THREAD
+	jassert(!isThreadRunning() && !isDone());
+
+	startMilliseconds = juce::Time::getMillisecondCounterHiRes();
+
+	{
+		/** One recording for both sets, so that the layers they share are only rendered with the first frame's. */
+		RenderCache::ScopedLayerRecording recording;
+		firstFrameLayerJobs = recordLayerJobs(recording, 0, numFirstFrameControls);
+		otherLayerJobs = recordLayerJobs(recording, numFirstFrameControls, controls.size());
+	}
+
+	startThread();
+}
+
+bool CacheWarmUp::waitUntilFirstFrameReady(int timeoutMilliseconds)
+{
+	return firstFrameReady.wait(timeoutMilliseconds);
+}
+
+bool CacheWarmUp::waitUntilDone(int timeoutMilliseconds)
+{
+	return done.wait(timeoutMilliseconds);
+}
+
+float CacheWarmUp::getPrimaryDisplayScale()
+{
+	auto& desktop = juce::Desktop::getInstance();
+
+	if (auto* display = desktop.getDisplays().getPrimaryDisplay())
+		return (float)display->scale * desktop.getGlobalScaleFactor();
+
+	return 1.f;
+}
+
+void CacheWarmUp::run()
+{
+	renderLayers(firstFrameLayerJobs);
+
+	firstFrameSeconds = (juce::Time::getMillisecondCounterHiRes() - startMilliseconds) / 1000.0;
+	firstFrameReady.signal();
+
+	renderLayers(otherLayerJobs);
+
+	seconds = (juce::Time::getMillisecondCounterHiRes() - startMilliseconds) / 1000.0;
+	done.signal();
+}
+
+std::vector<std::function<void()>> CacheWarmUp::recordLayerJobs(RenderCache::ScopedLayerRecording& recording, int first, int end)
+{
+	/** The pixels painted are thrown away, so one scratch image, as big as the biggest stand-in, does for all of them. */
+	int scratchWidth = 1, scratchHeight = 1;
+
+	for (int i = first; i < end; i++)
+	{
+		scratchWidth = juce::jmax(scratchWidth, juce::roundToInt(controls.getUnchecked(i)->getWidth() * scale));
+		scratchHeight = juce::jmax(scratchHeight, juce::roundToInt(controls.getUnchecked(i)->getHeight() * scale));
+	}
+
+	juce::Image scratch(juce::Image::ARGB, scratchWidth, scratchHeight, false, juce::SoftwareImageType());
+
+	for (int i = first; i < end; i++)
+	{
+		auto* control = controls.getUnchecked(i);
+
+		juce::Graphics g(scratch);
+		g.addTransform(juce::AffineTransform::scale(scale));
+
+		if (g.reduceClipRegion(control->getLocalBounds()))
+			control->paintEntireComponent(g, true);
+	}
+
+	return recording.takeLayerJobs();
+}
+
+void CacheWarmUp::renderLayers(const std::vector<std::function<void()>>& layerJobs)
+{
+	/** The jobs only run the layers' paint functions, which don't touch the stand-ins' state. */
+	threadPool->parallelFor((int)layerJobs.size(), [&layerJobs](int index)
+		{
+			layerJobs[(size_t)index]();
+		}, maxThreads);
+}
+
+void CacheWarmUp::addFader(juce::LookAndFeel& lookAndFeel, int width, int height, bool isBipolar)
+{
+	auto* fader = new juce::Slider("warmUpFader");
+
+	/** The same setup as the sliders of MainComponent: their layout depends on the orientation and the text box size. */
+	fader->setSliderStyle(FaderOrientation::getSliderStyle(width, height));
+	fader->setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 30);
+	fader->setLookAndFeel(&lookAndFeel);
+
+	fader->setRange(isBipolar ? -1 : 0, 1, 0.01);
+
+	valueReadouts.add(new PaintedValueReadout())->attachTo(fader);
+
+	addControl(fader, width, height);
+}
+
+void CacheWarmUp::addControl(juce::Component* control, int width, int height)
+{
+	controls.add(control);
+	control->setSize(width, height);
+}
@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    CacheWarmUp.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../LookAndFeels/Slider_MixingConsoleStyle_LookAndFeel.h"
+#include "../LookAndFeels/Slider_SynthBipolar_LookAndFeel.h"
+#include "../Components/RotaryKnob_GearShaped.h"
+#include "../Components/WaveformButton.h"
+#include "../Components/WaveformSelector.h"
+#include "../Components/PaintedValueReadout.h"
+#include "RenderCache.h"
+#include "RenderThreadPool.h"
+#include "DigitGlyphAtlas.h"
+
+/**
+ * Renders the cached layers of the controls before they are first painted.
+ *
+ * Right after launch nothing is cached, so the first paint of every control pays for its gradients,
+ * shadow blurs, digit glyphs and paths, and the first one with a surface material for decoding it. The warm-up has offscreen stand-ins of the controls, set up
+ * as MainComponent sets up its own and at the sizes it lays them out at, plus knobs at common sizes
+ * and waveform buttons in every state. start() paints them once on the message thread, recording the
+ * layers they miss rather than rendering them (see RenderCache::ScopedLayerRecording), and only those
+ * layers are then rendered, across the RenderThreadPool, driven from a thread of its own so that the
+ * window can be created meanwhile. No component is painted off the message thread. Layers are keyed by
+ * content, so the real controls then find theirs in the RenderCache and the DigitGlyphAtlas.
+ *
+ * The layers of the controls in the main window's first frame (the knob) are rendered first, and
+ * signalled on their own (waitUntilFirstFrameReady()), so that the first frame needn't wait for the rest.
+ *
+ * It holds on to the shared cache, atlas and threads, so keep it until the controls are deleted:
+ * otherwise the layers could be deleted between the warm-up and the first paint.
+ */
+class CacheWarmUp : private juce::Thread
+{
+public:
+	/** Knob sizes warmed up besides the one in MainComponent. */
+	static constexpr int commonKnobSizes[] = { 48, 64, 96, 128 };
+
+	/**
+	 * Creates the stand-in controls. Call it on the message thread.
+	 *
+	 * \param physicalPixelScale Scale of the display the controls will be painted on.
+	 * \param maxThreads The most threads to render on, or 0 for every thread of the pool.
+	 */
+	explicit CacheWarmUp(float physicalPixelScale, int maxThreads = 0);
+	~CacheWarmUp() override;
+
+	/**
+	 * Paints the stand-ins to record the layers they miss, then starts rendering those on a thread of its own
+	 * and returns. Call it on the message thread.
+	 */
+	void start();
+
+	/**
+	 * Waits for the layers of the main window's first frame.
+	 *
+	 * \param timeoutMilliseconds How long to wait at most, or -1 to wait until they're rendered.
+	 * \return True if they have been rendered.
+	 */
+	bool waitUntilFirstFrameReady(int timeoutMilliseconds = -1);
+
+	bool isFirstFrameReady() const { return firstFrameReady.wait(0); }
+
+	/**
+	 * Waits for the warm-up to finish.
+	 *
+	 * \param timeoutMilliseconds How long to wait at most, or -1 to wait until it's done.
+	 * \return True if it has finished.
+	 */
+	bool waitUntilDone(int timeoutMilliseconds = -1);
+
+	bool isDone() const { return done.wait(0); }
+
+	/** Number of stand-in controls painted. */
+	int getNumControls() const { return controls.size(); }
+
+	/** Time from start() until the layers of the first frame were rendered, in seconds. 0 until then. */
+	double getFirstFrameSeconds() const { return firstFrameSeconds.load(); }
+
+	/** Time from start() until every layer was rendered, in seconds. 0 until then. */
+	double getSeconds() const { return seconds.load(); }
+
+	/** Returns the physical pixel scale of the main display, or 1 if there is no display. */
+	static float getPrimaryDisplayScale();
+
+private:
+	/** Renders the layers of the first frame, then the others. */
+	void run() override;
+
+	/** Paints the stand-ins from first to end on this thread, and returns the jobs rendering the layers they missed. */
+	std::vector<std::function<void()>> recordLayerJobs(RenderCache::ScopedLayerRecording& recording, int first, int end);
+
+	/** Runs the jobs across the threads. */
+	void renderLayers(const std::vector<std::function<void()>>& layerJobs);
+
+	/** Adds a fader stand-in, set up like the faders of MainComponent. */
+	void addFader(juce::LookAndFeel& lookAndFeel, int width, int height, bool isBipolar);
+
+	/** Adds a stand-in control of the given size. */
+	void addControl(juce::Component* control, int width, int height);
+
+	const float scale;
+	const int maxThreads;
+
+	/** LookAndFeels of the stand-in faders (the knobs and buttons own theirs). */
+	Slider_MixingConsoleStyle_LookAndFeel slider_MixingConsoleStyle_LookAndFeel;
+	Slider_SynthBipolar_LookAndFeel slider_SynthBipolar_LookAndFeel;
+
+	/** Stand-ins, those of the first frame first. Declared before the readouts, which detach from them. */
+	juce::OwnedArray<juce::Component> controls;
+	int numFirstFrameControls = 0;
+
+	/** Recorded by start(), rendered by run(). */
+	std::vector<std::function<void()>> firstFrameLayerJobs;
+	std::vector<std::function<void()>> otherLayerJobs;
+	juce::OwnedArray<PaintedValueReadout> valueReadouts;
+
+	juce::SharedResourcePointer<RenderCache> renderCache;
+	juce::SharedResourcePointer<DigitGlyphAtlas> digitGlyphAtlas;
+	juce::SharedResourcePointer<RenderThreadPool> threadPool;
+
+	juce::WaitableEvent firstFrameReady { true };
+	juce::WaitableEvent done { true };
+	std::atomic<double> firstFrameSeconds { 0.0 };
+	std::atomic<double> seconds { 0.0 };
+	double startMilliseconds = 0.0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CacheWarmUp)
+};
@@ -0,0 +1,176 @@
+/*
+  ==============================================================================
+
+    DigitGlyphAtlas.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "DigitGlyphAtlas.h"
+#include "RenderCache.h"
+
+int DigitGlyphAtlas::formatValue(double value, int numDecimalPlaces, char* buffer, int bufferSize)
+{
+	numDecimalPlaces = juce::jlimit(0, 9, numDecimalPlaces);
+
+	juce::int64 scaleFactor = 1;
+	for (int i = 0; i < numDecimalPlaces; i++)
+		scaleFactor *= 10;
+
+	/** Everything is formatted from one rounded integer, so 0.999 with 2 decimals becomes "1.00". */
+	const bool isNegative = value < 0.0;
+	const auto scaled = (juce::uint64)juce::jmin(std::round(std::abs(value) * (double)scaleFactor), 9.0e18);
+
+	/** Digits are produced backwards into a scratch buffer. */
+	char digits[32];
+	int numDigits = 0;
+	auto remaining = scaled;
+
+	do
+	{
+		digits[numDigits++] = (char)('0' + (int)(remaining % 10));
+		remaining /= 10;
+	} while (remaining > 0 || numDigits <= numDecimalPlaces);
+
+	int length = 0;
+	auto append = [&](char character)
+	{
+		if (length < bufferSize)
+			buffer[length++] = character;
+	};
+
+	/** No sign for values that round to zero. */
+	if (isNegative && scaled > 0)
+		append('-');
+
+	for (int i = numDigits - 1; i >= 0; i--)
+	{
+		append(digits[i]);
+
+		if (i == numDecimalPlaces && numDecimalPlaces > 0)
+			append('.');
+	}
+
+	return length;
+}
+
+void DigitGlyphAtlas::drawText(juce::Graphics& g, const char* text, int length, juce::Rectangle<int> area,
+	float fontHeight, juce::Colour colour)
+{
+	const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+	/** A paint recording the layers it misses (see RenderCache::ScopedLayerRecording) leaves a missing atlas to a job. */
+	if (RenderCache::isRecordingLayers() && !hasAtlas(fontHeight, scale)
+		&& RenderCache::recordLayerJob([this, fontHeight, scale] { getAtlas(fontHeight, scale); }))
+		return;
+
+	const auto& atlas = getAtlas(fontHeight, scale);
+
+	float textWidth = 0.f;
+	for (int i = 0; i < length; i++)
+	{
+		if (const int index = getGlyphIndex(text[i]); index >= 0)
+			textWidth += atlas.advances[(size_t)index];
+	}
+
+	float x = area.getCentreX() - textWidth / 2.f;
+	const int y = area.getCentreY() - atlas.cellHeight / 2;
+
+	g.setColour(colour);
+
+	for (int i = 0; i < length; i++)
+	{
+		const int index = getGlyphIndex(text[i]);
+
+		if (index < 0)
+			continue;
+
+		/** Whole logical pixels, so every cell maps exactly onto its physical pixels. */
+		g.drawImage(atlas.image,
+			juce::roundToInt(x), y, atlas.cellWidth, atlas.cellHeight,
+			index * atlas.physicalCellWidth, 0, atlas.physicalCellWidth, atlas.physicalCellHeight,
+			true);
+
+		x += atlas.advances[(size_t)index];
+	}
+}
+
+void DigitGlyphAtlas::drawValue(juce::Graphics& g, const juce::Slider& slider, juce::Rectangle<int> area,
+	float fontHeight, juce::Colour colour)
+{
+	char text[32];
+	const int length = formatValue(slider.getValue(), slider.getNumDecimalPlacesToDisplay(), text, (int)sizeof(text));
+
+	drawText(g, text, length, area, fontHeight, colour);
+}
+
+int DigitGlyphAtlas::getGlyphIndex(char character)
+{
+	if (character >= '0' && character <= '9')
+		return character - '0';
+
+	switch (character)
+	{
+	case '.':	return 10;
+	case '-':	return 11;
+	case '+':	return 12;
+	default:	return -1;
+	}
+}
+
+std::pair<int, int> DigitGlyphAtlas::getAtlasKey(float fontHeight, float scale)
+{
+	return std::make_pair(juce::roundToInt(fontHeight * 100.f), juce::roundToInt(scale * 100.f));
+}
+
+bool DigitGlyphAtlas::hasAtlas(float fontHeight, float scale) const
+{
+	const juce::ScopedLock sl(lock);
+	return atlases.find(getAtlasKey(fontHeight, scale)) != atlases.end();
+}
+
+const DigitGlyphAtlas::Atlas& DigitGlyphAtlas::getAtlas(float fontHeight, float scale)
+{
+	const auto key = getAtlasKey(fontHeight, scale);
+
+	/** Only clear() removes atlases and map entries don't move, so the reference stays valid after the lock is released. */
+	const juce::ScopedLock sl(lock);
+
+	if (auto found = atlases.find(key); found != atlases.end())
+		return found->second;
+
+	Atlas atlas;
+	const juce::Font font(fontHeight);
+
+	/** Cells as wide as the widest glyph, so that every glyph fits in its own cell. */
+	float maxAdvance = 0.f;
+	for (int i = 0; i < numGlyphs; i++)
+	{
+		atlas.advances[(size_t)i] = font.getStringWidthFloat(juce::String::charToString((juce::juce_wchar)glyphCharacters[i]));
+		maxAdvance = juce::jmax(maxAdvance, atlas.advances[(size_t)i]);
+	}
+
+	atlas.cellWidth = (int)std::ceil(maxAdvance) + 1;
+	atlas.cellHeight = (int)std::ceil(font.getHeight()) + 1;
+	atlas.physicalCellWidth = juce::jmax(1, juce::roundToInt(atlas.cellWidth * scale));
+	atlas.physicalCellHeight = juce::jmax(1, juce::roundToInt(atlas.cellHeight * scale));
+
+	atlas.image = juce::Image(juce::Image::SingleChannel, numGlyphs * atlas.physicalCellWidth, atlas.physicalCellHeight, true);
+
+	{
+		juce::Graphics g(atlas.image);
+		g.setColour(juce::Colours::white);
+		g.setFont(font.withHeight(fontHeight * scale));
+
+		for (int i = 0; i < numGlyphs; i++)
+		{
+			g.drawText(juce::String::charToString((juce::juce_wchar)glyphCharacters[i]),
+				i * atlas.physicalCellWidth, 0, juce::roundToInt(atlas.advances[(size_t)i] * scale), atlas.physicalCellHeight,
+				juce::Justification::centredLeft, false);
+		}
+	}
+
+	return atlases.emplace(key, std::move(atlas)).first->second;
+}
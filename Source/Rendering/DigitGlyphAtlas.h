@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    DigitGlyphAtlas.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Pre-rendered glyphs for drawing numbers without text layout.
+ *
+ * The digits, sign and decimal point are rendered once per font height and
+ * physical pixel scale into a SingleChannel atlas, and numbers are drawn by
+ * tinting cells of it. Together with formatValue(), which formats into a
+ * caller provided buffer, a value readout can be painted without allocating.
+ * Share one between LookAndFeels with juce::SharedResourcePointer. Numbers may be
+ * drawn from any thread.
+ */
+class DigitGlyphAtlas
+{
+public:
+	/** The characters in the atlas. */
+	static constexpr const char* glyphCharacters = "0123456789.-+";
+	static constexpr int numGlyphs = 13;
+
+	/**
+	 * Formats a value with a fixed number of decimal places, e.g. "-0.25".
+	 *
+	 * \param buffer Where to write the characters. Not null terminated.
+	 * \return The number of characters written (at most bufferSize).
+	 */
+	static int formatValue(double value, int numDecimalPlaces, char* buffer, int bufferSize);
+
+	/**
+	 * Draws text made of glyphCharacters, centred in an area, in the given colour.
+	 * Other characters are skipped.
+	 */
+	void drawText(juce::Graphics& g, const char* text, int length, juce::Rectangle<int> area,
+		float fontHeight, juce::Colour colour);
+
+	/** Formats a slider's value with its number of decimal places and draws it centred in an area. */
+	void drawValue(juce::Graphics& g, const juce::Slider& slider, juce::Rectangle<int> area,
+		float fontHeight, juce::Colour colour);
+
+	/** Number of atlases rendered (one per font height and scale). */
+	int getNumAtlases() const
+	{
+		const juce::ScopedLock sl(lock);
+		return (int)atlases.size();
+	}
+
+	/** Removes every atlas, for measuring cold starts. Not while numbers may be drawn on other threads. */
+	void clear()
+	{
+		const juce::ScopedLock sl(lock);
+		atlases.clear();
+	}
+
+private:
+	/** Glyphs rendered at one font height and scale. */
+	struct Atlas
+	{
+		juce::Image image;
+		/** Size of a cell, in logical pixels. The physical size is cellWidth/Height times the scale. */
+		int cellWidth = 0;
+		int cellHeight = 0;
+		/** Physical size of a cell. */
+		int physicalCellWidth = 0;
+		int physicalCellHeight = 0;
+		/** Logical advance of each glyph. */
+		std::array<float, numGlyphs> advances {};
+	};
+
+	/** Returns the index of a character in the atlas, or -1. */
+	static int getGlyphIndex(char character);
+
+	/** Returns the key of the atlas for a font height and scale. */
+	static std::pair<int, int> getAtlasKey(float fontHeight, float scale);
+
+	/** True if the atlas for a font height and scale has been rendered. */
+	bool hasAtlas(float fontHeight, float scale) const;
+
+	/** Returns the atlas for a font height and scale, rendering it first if needed. */
+	const Atlas& getAtlas(float fontHeight, float scale);
+
+	/** Atlases by font height and scale, both in hundredths. */
+	std::map<std::pair<int, int>, Atlas> atlases;
+	mutable juce::CriticalSection lock;
+};
@@ -0,0 +1,249 @@
+/*
+  ==============================================================================
+
+    FaderRenderer.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "LevelOfDetail.h"
+
+/**
+ * Axis-swap policies for the linear faders.
+ *
+ * Fader geometry is written once, along the length axis (the one the cap travels along)
+ * and across it on the cross axis. Each policy maps those axes to x and y at compile time,
+ * so every orientation gets its own branch-free code.
+ */
+namespace FaderOrientation
+{
+	/** Taller than wide: the cap travels along y, with the highest value at the top. */
+	struct Vertical
+	{
+		static constexpr juce::Slider::SliderStyle sliderStyle = juce::Slider::LinearVertical;
+		static constexpr bool isVertical = true;
+
+		/** Twelfths of the slider's height used by the fader. The rest is left to the text box. */
+		static constexpr int faderTwelfths = 11;
+
+		template <typename ValueType> static ValueType getLength(juce::Rectangle<ValueType> bounds) { return bounds.getHeight(); }
+		template <typename ValueType> static ValueType getCross(juce::Rectangle<ValueType> bounds) { return bounds.getWidth(); }
+		template <typename ValueType> static ValueType getLengthStart(juce::Rectangle<ValueType> bounds) { return bounds.getY(); }
+		template <typename ValueType> static ValueType getLengthCentre(juce::Rectangle<ValueType> bounds) { return bounds.getCentreY(); }
+
+		template <typename ValueType>
+		static juce::Rectangle<ValueType> makeRectangle(ValueType crossStart, ValueType lengthStart, ValueType crossSize, ValueType lengthSize)
+		{
+			return { crossStart, lengthStart, crossSize, lengthSize };
+		}
+
+		template <typename ValueType>
+		static juce::Point<ValueType> makePoint(ValueType cross, ValueType length)
+		{
+			return { cross, length };
+		}
+
+		/** A gradient that runs across the track. */
+		static juce::ColourGradient makeCrossGradient(juce::Colour colour1, float cross1, juce::Colour colour2, float cross2)
+		{
+			return juce::ColourGradient::horizontal(colour1, cross1, colour2, cross2);
+		}
+
+		/** The position on the track that is offset in from the end where the highest value is. */
+		static float fromMaximum(float lengthStart, float lengthEnd, float offset) { return lengthStart + offset; }
+	};
+
+	/** Wider than tall: the cap travels along x, with the highest value on the right. */
+	struct Horizontal
+	{
+		static constexpr juce::Slider::SliderStyle sliderStyle = juce::Slider::LinearHorizontal;
+		static constexpr bool isVertical = false;
+
+		/** Twelfths of the slider's height used by the fader. The rest is left to the text box. */
+		static constexpr int faderTwelfths = 9;
+
+		template <typename ValueType> static ValueType getLength(juce::Rectangle<ValueType> bounds) { return bounds.getWidth(); }
+		template <typename ValueType> static ValueType getCross(juce::Rectangle<ValueType> bounds) { return bounds.getHeight(); }
+		template <typename ValueType> static ValueType getLengthStart(juce::Rectangle<ValueType> bounds) { return bounds.getX(); }
+		template <typename ValueType> static ValueType getLengthCentre(juce::Rectangle<ValueType> bounds) { return bounds.getCentreX(); }
+
+		template <typename ValueType>
+		static juce::Rectangle<ValueType> makeRectangle(ValueType crossStart, ValueType lengthStart, ValueType crossSize, ValueType lengthSize)
+		{
+			return { lengthStart, crossStart, lengthSize, crossSize };
+		}
+
+		template <typename ValueType>
+		static juce::Point<ValueType> makePoint(ValueType cross, ValueType length)
+		{
+			return { length, cross };
+		}
+
+		/** A gradient that runs across the track. */
+		static juce::ColourGradient makeCrossGradient(juce::Colour colour1, float cross1, juce::Colour colour2, float cross2)
+		{
+			return juce::ColourGradient::vertical(colour1, cross1, colour2, cross2);
+		}
+
+		/** The position on the track that is offset in from the end where the highest value is. */
+		static float fromMaximum(float lengthStart, float lengthEnd, float offset) { return lengthEnd - offset; }
+	};
+
+	/**
+	 * The slider style for a fader of the given size. Square faders are vertical.
+	 * For setting a fader up: the LookAndFeels never change the style of a slider themselves.
+	 */
+	inline juce::Slider::SliderStyle getSliderStyle(int width, int height)
+	{
+		return width > height ? Horizontal::sliderStyle : Vertical::sliderStyle;
+	}
+}
+
+/** The track of a fader, in length and cross axis coordinates. */
+struct FaderTrack
+{
+	float crossStart = 0.f;
+	float crossSize = 0.f;
+	float lengthStart = 0.f;
+	float lengthSize = 0.f;
+
+	float getCrossEnd() const { return crossStart + crossSize; }
+	float getLengthEnd() const { return lengthStart + lengthSize; }
+
+	/** Returns a track of the given size, centred on the given position. */
+	static FaderTrack centredOn(float crossCentre, float lengthCentre, float crossSize, float lengthSize)
+	{
+		return { crossCentre - crossSize / 2.f, crossSize, lengthCentre - lengthSize / 2.f, lengthSize };
+	}
+
+	template <typename Orientation>
+	juce::Rectangle<float> getBounds() const
+	{
+		return Orientation::makeRectangle(crossStart, lengthStart, crossSize, lengthSize);
+	}
+
+	/**
+	 * Returns where along the track the cap is centred, for the slider position JUCE passes to drawLinearSlider().
+	 * That position runs along the whole slider area, and the cap along the track inside it.
+	 */
+	template <typename Orientation>
+	float getCapCentre(juce::Rectangle<int> sliderArea, float sliderPos) const
+	{
+		return juce::jmap(sliderPos, (float)Orientation::getLengthStart(sliderArea), (float)Orientation::getLength(sliderArea),
+			lengthStart, getLengthEnd());
+	}
+};
+
+/**
+ * Paints the orientation dependent parts of a fader: its track, cap and grading.
+ *
+ * The LookAndFeel of each fader style provides them as member templates over the orientation:
+ *   FaderTrack getTrack<Orientation>(x, y, width, height)
+ *   void drawTrack<Orientation>(g, track, renderOptions)
+ *   void drawThumb<Orientation>(g, track, x, y, width, height, sliderPos, slider, renderOptions)
+ *   void drawGrading<Orientation>(g, track, width, height, slider, renderOptions)
+ * so every combination of style and orientation compiles into a renderer of its own.
+ * The options of the paint are passed along rather than kept in the LookAndFeel, which is shared
+ * by every slider using it, so that sliders can be painted on several threads at once.
+ * The orientation is the slider's style, chosen once by whoever sets the slider up, and
+ * paintFader() calls the renderer for it directly, so that it's inlined into the paint.
+ */
+template <typename Orientation, typename Style>
+struct FaderRenderer
+{
+	static void paint(Style& style, juce::Graphics& g, int x, int y, int width, int height, float sliderPos, juce::Slider& slider,
+		const LevelOfDetail::Options& renderOptions)
+	{
+		const auto track = style.template getTrack<Orientation>(x, y, width, height);
+
+		style.template drawTrack<Orientation>(g, track, renderOptions);
+		style.template drawThumb<Orientation>(g, track, x, y, width, height, sliderPos, slider, renderOptions);
+		style.template drawGrading<Orientation>(g, track, width, height, slider, renderOptions);
+	}
+
+	/**
+	 * Returns the centre of the cap for the slider's value, in physical pixels along the track,
+	 * from the same track and mapping paint() draws the cap with.
+	 */
+	static int getQuantisedCapPosition(Style& style, juce::Slider& slider, float physicalPixelScale)
+	{
+		const auto sliderArea = style.getSliderLayout(slider).sliderBounds;
+		const auto track = style.template getTrack<Orientation>(sliderArea.getX(), sliderArea.getY(), sliderArea.getWidth(), sliderArea.getHeight());
+
+		/** The position JUCE would pass to drawLinearSlider(): the maximum is at the top, or on the right */
+		const float length = (float)Orientation::getLength(sliderArea);
+		const float proportion = (float)slider.valueToProportionOfLength(slider.getValue());
+		const float sliderPos = Orientation::fromMaximum((float)Orientation::getLengthStart(sliderArea),
+			(float)Orientation::getLengthStart(sliderArea) + length, (1.f - proportion) * length);
+
+		return juce::roundToInt(track.template getCapCentre<Orientation>(sliderArea, sliderPos) * physicalPixelScale);
+	}
+};
+
+/**
+ * Calls a function with the orientation policy of a slider style: FaderOrientation::Vertical for LinearVertical,
+ * FaderOrientation::Horizontal for anything else. Both calls are direct, so what the function does for each
+ * orientation is compiled, and inlined, on its own.
+ */
+template <typename Function>
+decltype(auto) withFaderOrientation(juce::Slider::SliderStyle sliderStyle, Function&& function)
+{
+	if (sliderStyle == FaderOrientation::Vertical::sliderStyle)
+		return function(FaderOrientation::Vertical());
+
+	return function(FaderOrientation::Horizontal());
+}
+
+/** Paints the track, cap and grading of a fader with the renderer of its style for the slider's orientation. */
+template <typename Style>
+void paintFader(Style& style, juce::Graphics& g, int x, int y, int width, int height, float sliderPos, juce::Slider& slider,
+	const LevelOfDetail::Options& renderOptions)
+{
+	withFaderOrientation(slider.getSliderStyle(), [&](auto orientation)
+		{
+			FaderRenderer<decltype(orientation), Style>::paint(style, g, x, y, width, height, sliderPos, slider, renderOptions);
+		});
+}
+
+/**
+ * Returns the position of a fader's cap, in physical pixels, as the renderer of its style draws it.
+ * When this doesn't change the cap moves by less than a physical pixel and the slider doesn't need a repaint for it.
+ */
+template <typename Style>
+int getQuantisedFaderCapPosition(Style& style, juce::Slider& slider, float physicalPixelScale)
+{
+	return withFaderOrientation(slider.getSliderStyle(), [&](auto orientation)
+		{
+			return FaderRenderer<decltype(orientation), Style>::getQuantisedCapPosition(style, slider, physicalPixelScale);
+		});
+}
+
+/** Splits the slider into the fader and the text box below it. */
+template <typename Orientation>
+juce::Slider::SliderLayout getFaderLayout(const juce::Slider& slider)
+{
+	auto localBounds = slider.getLocalBounds();
+
+	juce::Slider::SliderLayout layout;
+	layout.sliderBounds = localBounds.removeFromTop(localBounds.getHeight() * Orientation::faderTwelfths / 12);
+	layout.textBoxBounds = localBounds;
+
+	return layout;
+}
+
+/**
+ * Returns the layout of a fader in the orientation of its slider style, like paintFader():
+ * LinearVertical is vertical, anything else horizontal. The style is left as the caller set it.
+ */
+inline juce::Slider::SliderLayout getFaderLayoutForStyle(const juce::Slider& slider)
+{
+	return withFaderOrientation(slider.getSliderStyle(), [&slider](auto orientation)
+		{
+			return getFaderLayout<decltype(orientation)>(slider);
+		});
+}
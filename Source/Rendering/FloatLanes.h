@@ -0,0 +1,235 @@
+/*
+  ==============================================================================
+
+    FloatLanes.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if JUCE_INTEL && ! JUCE_ANDROID && (defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2))
+ #define FLOAT_LANES_USE_SSE2 1
+ #define FLOAT_LANES_USE_NEON 0
+ #include <emmintrin.h>
+#elif JUCE_ARM && ! JUCE_ANDROID && (defined (__aarch64__) || defined (_M_ARM64))
+ #define FLOAT_LANES_USE_SSE2 0
+ #define FLOAT_LANES_USE_NEON 1
+ #include <arm_neon.h>
+#else
+ #define FLOAT_LANES_USE_SSE2 0
+ #define FLOAT_LANES_USE_NEON 0
+#endif
+
+/**
+ * Minimal float vectors for per-pixel rendering kernels.
+ *
+ * A kernel is written once as a template over the lane type and shades FloatLanes::X::numLanes
+ * pixels at a time: Scalar does one, Sse2 (on x86, where SSE2 is always there on 64 bit) and
+ * Neon (on 64 bit ARM, where NEON is always there) do four. Only the operations the renderers need are provided.
+ *
+ * Pixels are loaded and stored as packed PixelARGB, which is not their layout on Android, so the
+ * SIMD lanes are not used there.
+ */
+namespace FloatLanes
+{
+	/** One pixel at a time. Used where there's no SIMD, and for the pixels left over at the end of a row. */
+	struct Scalar
+	{
+		static constexpr int numLanes = 1;
+
+		float value = 0.f;
+
+		Scalar() = default;
+		Scalar(float initialValue) : value(initialValue) {}
+
+		/** Returns start, start + step, start + 2 * step... */
+		static Scalar ramp(float start, float) { return start; }
+
+		/** Reads and writes numLanes floats. */
+		static Scalar load(const float* source) { return *source; }
+		void store(float* destination) const { *destination = value; }
+
+		friend Scalar operator+(Scalar a, Scalar b) { return a.value + b.value; }
+		friend Scalar operator-(Scalar a, Scalar b) { return a.value - b.value; }
+		friend Scalar operator*(Scalar a, Scalar b) { return a.value * b.value; }
+		friend Scalar operator/(Scalar a, Scalar b) { return a.value / b.value; }
+		Scalar operator-() const { return -value; }
+
+		friend Scalar min(Scalar a, Scalar b) { return juce::jmin(a.value, b.value); }
+		friend Scalar max(Scalar a, Scalar b) { return juce::jmax(a.value, b.value); }
+		friend Scalar abs(Scalar a) { return std::abs(a.value); }
+		friend Scalar sqrt(Scalar a) { return std::sqrt(a.value); }
+
+		/** Writes premultiplied colours, each 0 to 1, as PixelARGB. */
+		static void storePixels(juce::PixelARGB* pixels, Scalar alpha, Scalar red, Scalar green, Scalar blue)
+		{
+			pixels->setARGB((juce::uint8)juce::roundToInt(alpha.value * 255.f), (juce::uint8)juce::roundToInt(red.value * 255.f),
+				(juce::uint8)juce::roundToInt(green.value * 255.f), (juce::uint8)juce::roundToInt(blue.value * 255.f));
+		}
+
+		/** Reads premultiplied PixelARGB as colours from 0 to 1. */
+		static void loadPixels(const juce::PixelARGB* pixels, Scalar& alpha, Scalar& red, Scalar& green, Scalar& blue)
+		{
+			alpha = pixels->getAlpha() / 255.f;
+			red = pixels->getRed() / 255.f;
+			green = pixels->getGreen() / 255.f;
+			blue = pixels->getBlue() / 255.f;
+		}
+	};
+
+#if FLOAT_LANES_USE_SSE2
+	/** Four pixels at a time. */
+	struct Sse2
+	{
+		static constexpr int numLanes = 4;
+
+		__m128 value;
+
+		Sse2() : value(_mm_setzero_ps()) {}
+		Sse2(float initialValue) : value(_mm_set1_ps(initialValue)) {}
+		Sse2(__m128 initialValue) : value(initialValue) {}
+
+		/** Returns start, start + step, start + 2 * step, start + 3 * step. */
+		static Sse2 ramp(float start, float step)
+		{
+			return _mm_add_ps(_mm_set1_ps(start), _mm_mul_ps(_mm_set1_ps(step), _mm_set_ps(3.f, 2.f, 1.f, 0.f)));
+		}
+
+		/** Reads and writes four floats. */
+		static Sse2 load(const float* source) { return _mm_loadu_ps(source); }
+		void store(float* destination) const { _mm_storeu_ps(destination, value); }
+
+		friend Sse2 operator+(Sse2 a, Sse2 b) { return _mm_add_ps(a.value, b.value); }
+		friend Sse2 operator-(Sse2 a, Sse2 b) { return _mm_sub_ps(a.value, b.value); }
+		friend Sse2 operator*(Sse2 a, Sse2 b) { return _mm_mul_ps(a.value, b.value); }
+		friend Sse2 operator/(Sse2 a, Sse2 b) { return _mm_div_ps(a.value, b.value); }
+		Sse2 operator-() const { return _mm_sub_ps(_mm_setzero_ps(), value); }
+
+		friend Sse2 min(Sse2 a, Sse2 b) { return _mm_min_ps(a.value, b.value); }
+		friend Sse2 max(Sse2 a, Sse2 b) { return _mm_max_ps(a.value, b.value); }
+		friend Sse2 abs(Sse2 a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a.value); }
+		friend Sse2 sqrt(Sse2 a) { return _mm_sqrt_ps(a.value); }
+
+		/** Writes premultiplied colours, each 0 to 1, as four PixelARGB. */
+		static void storePixels(juce::PixelARGB* pixels, Sse2 alpha, Sse2 red, Sse2 green, Sse2 blue)
+		{
+			static_assert(sizeof(juce::PixelARGB) == 4, "PixelARGB is expected to be a packed 32 bit pixel");
+
+			const auto scale = _mm_set1_ps(255.f);
+			const auto a = _mm_cvtps_epi32(_mm_mul_ps(alpha.value, scale));
+			const auto r = _mm_cvtps_epi32(_mm_mul_ps(red.value, scale));
+			const auto g = _mm_cvtps_epi32(_mm_mul_ps(green.value, scale));
+			const auto b = _mm_cvtps_epi32(_mm_mul_ps(blue.value, scale));
+
+			/** PixelARGB keeps its components as A, R, G, B from the most to the least significant byte. */
+			const auto argb = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(a, 24), _mm_slli_epi32(r, 16)),
+				_mm_or_si128(_mm_slli_epi32(g, 8), b));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), argb);
+		}
+
+		/** Reads four premultiplied PixelARGB as colours from 0 to 1. */
+		static void loadPixels(const juce::PixelARGB* pixels, Sse2& alpha, Sse2& red, Sse2& green, Sse2& blue)
+		{
+			const auto argb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+			const auto mask = _mm_set1_epi32(0xff);
+			const auto scale = _mm_set1_ps(1.f / 255.f);
+
+			alpha = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(argb, 24)), scale);
+			red = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(argb, 16), mask)), scale);
+			green = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(argb, 8), mask)), scale);
+			blue = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(argb, mask)), scale);
+		}
+	};
+
+	/** The widest lanes available. */
+	using Native = Sse2;
+#elif FLOAT_LANES_USE_NEON
+	/** Four pixels at a time. */
+	struct Neon
+	{
+		static constexpr int numLanes = 4;
+
+		float32x4_t value;
+
+		Neon() : value(vdupq_n_f32(0.f)) {}
+		Neon(float initialValue) : value(vdupq_n_f32(initialValue)) {}
+		Neon(float32x4_t initialValue) : value(initialValue) {}
+
+		/** Returns start, start + step, start + 2 * step, start + 3 * step. */
+		static Neon ramp(float start, float step)
+		{
+			const float offsets[] = { 0.f, 1.f, 2.f, 3.f };
+			return vaddq_f32(vdupq_n_f32(start), vmulq_n_f32(vld1q_f32(offsets), step));
+		}
+
+		/** Reads and writes four floats. */
+		static Neon load(const float* source) { return vld1q_f32(source); }
+		void store(float* destination) const { vst1q_f32(destination, value); }
+
+		friend Neon operator+(Neon a, Neon b) { return vaddq_f32(a.value, b.value); }
+		friend Neon operator-(Neon a, Neon b) { return vsubq_f32(a.value, b.value); }
+		friend Neon operator*(Neon a, Neon b) { return vmulq_f32(a.value, b.value); }
+		friend Neon operator/(Neon a, Neon b) { return vdivq_f32(a.value, b.value); }
+		Neon operator-() const { return vnegq_f32(value); }
+
+		friend Neon min(Neon a, Neon b) { return vminq_f32(a.value, b.value); }
+		friend Neon max(Neon a, Neon b) { return vmaxq_f32(a.value, b.value); }
+		friend Neon abs(Neon a) { return vabsq_f32(a.value); }
+		friend Neon sqrt(Neon a) { return vsqrtq_f32(a.value); }
+
+		/** Writes premultiplied colours, each 0 to 1, as four PixelARGB. */
+		static void storePixels(juce::PixelARGB* pixels, Neon alpha, Neon red, Neon green, Neon blue)
+		{
+			static_assert(sizeof(juce::PixelARGB) == 4, "PixelARGB is expected to be a packed 32 bit pixel");
+
+			const auto a = vcvtnq_u32_f32(vmulq_n_f32(alpha.value, 255.f));
+			const auto r = vcvtnq_u32_f32(vmulq_n_f32(red.value, 255.f));
+			const auto g = vcvtnq_u32_f32(vmulq_n_f32(green.value, 255.f));
+			const auto b = vcvtnq_u32_f32(vmulq_n_f32(blue.value, 255.f));
+
+			const auto argb = vorrq_u32(vorrq_u32(vshlq_n_u32(a, 24), vshlq_n_u32(r, 16)), vorrq_u32(vshlq_n_u32(g, 8), b));
+
+			vst1q_u32(reinterpret_cast<uint32_t*>(pixels), argb);
+		}
+
+		/** Reads four premultiplied PixelARGB as colours from 0 to 1. */
+		static void loadPixels(const juce::PixelARGB* pixels, Neon& alpha, Neon& red, Neon& green, Neon& blue)
+		{
+			const auto argb = vld1q_u32(reinterpret_cast<const uint32_t*>(pixels));
+			const auto mask = vdupq_n_u32(0xff);
+			constexpr float scale = 1.f / 255.f;
+
+			alpha = vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(argb, 24)), scale);
+			red = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(argb, 16), mask)), scale);
+			green = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(argb, 8), mask)), scale);
+			blue = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(argb, mask)), scale);
+		}
+	};
+
+	/** The widest lanes available. */
+	using Native = Neon;
+#else
+	using Native = Scalar;
+#endif
+
+	/** Limits each lane to the range low to high. */
+	template <typename Floats>
+	Floats clamp(Floats value, float low, float high)
+	{
+		return min(max(value, Floats(low)), Floats(high));
+	}
+
+	/** Smooth Hermite step from 0 at edge0 to 1 at edge1, like GLSL's smoothstep(). */
+	template <typename Floats>
+	Floats smoothStep(float edge0, float edge1, Floats value)
+	{
+		const auto t = clamp((value - Floats(edge0)) * Floats(1.f / (edge1 - edge0)), 0.f, 1.f);
+		return t * t * (Floats(3.f) - Floats(2.f) * t);
+	}
+}
@@ -0,0 +1,370 @@
+/*
+  ==============================================================================
+
+    GearSdfRenderer.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "GearSdfRenderer.h"
+#include "FloatLanes.h"
+
+GearSdfRenderer::~GearSdfRenderer()
+{
+	renderCache->setAssetBytes(this, 0);
+}
+
+namespace
+{
+	/** A colour as premultiplied floats from 0 to 1. */
+	struct PremultipliedColour
+	{
+		float alpha = 0.f;
+		float red = 0.f;
+		float green = 0.f;
+		float blue = 0.f;
+
+		static PremultipliedColour from(juce::Colour colour)
+		{
+			const auto alpha = colour.getFloatAlpha();
+			return { alpha, colour.getFloatRed() * alpha, colour.getFloatGreen() * alpha, colour.getFloatBlue() * alpha };
+		}
+	};
+
+	/** Premultiplied pixels being composited, one per lane. */
+	template <typename Floats>
+	struct Pixels
+	{
+		Floats alpha, red, green, blue;
+
+		/** Composites premultiplied colours over the pixels. */
+		void over(Floats srcAlpha, Floats srcRed, Floats srcGreen, Floats srcBlue)
+		{
+			const auto remaining = Floats(1.f) - srcAlpha;
+
+			alpha = srcAlpha + alpha * remaining;
+			red = srcRed + red * remaining;
+			green = srcGreen + green * remaining;
+			blue = srcBlue + blue * remaining;
+		}
+
+		void over(const PremultipliedColour& colour, Floats coverage)
+		{
+			over(coverage * Floats(colour.alpha), coverage * Floats(colour.red), coverage * Floats(colour.green), coverage * Floats(colour.blue));
+		}
+	};
+
+	/** The flat sides of the gear are centred between two bites, an eighth of a turn apart. */
+	constexpr float halfSideAngle = juce::MathConstants<float>::pi / 8.f;
+}
+
+/**
+ * The knob's geometry relative to its centre, its colours and the gradient, for one render.
+ *
+ * Distances are in logical pixels, negative inside a shape. The gear and the pointer are
+ * evaluated in the frame of the unrotated knob, with y pointing down as on screen.
+ */
+struct GearSdfRenderer::Shading
+{
+	explicit Shading(const Parameters& parameters)
+		: centreX(parameters.centre.x),
+		centreY(parameters.centre.y),
+		cosAngle(std::cos(parameters.angle)),
+		sinAngle(std::sin(parameters.angle)),
+		drawShadow(parameters.drawShadow),
+		useGradients(parameters.useGradients)
+	{
+		const float totalDiameter = parameters.totalDiameter;
+
+		/** Same proportions as the path based LookAndFeel. */
+		const float knobGearOuterDiameter = 0.9f * totalDiameter;
+		const float knobGearInnerDiameter = 0.75f * totalDiameter;
+
+		diskRadius = knobGearOuterDiameter / 2.f;
+
+		/**
+		 * Each bite is a circle Shapes::getGearShapedPath() takes an arc from: centred an inner diameter out
+		 * from the knob centre, with half of that as its radius. The arc ends where it meets the flat sides.
+		 */
+		biteCentre = knobGearInnerDiameter;
+		biteRadius = knobGearInnerDiameter / 2.f;
+
+		const float arcEndAngle = 3.5f * juce::MathConstants<float>::pi / 4.f;
+		const float arcEndAcross = biteRadius * std::sin(arcEndAngle);
+		const float arcEndRadial = biteCentre + biteRadius * std::cos(arcEndAngle);
+
+		/** The chord across the bite, and the flat side joining the ends of two neighbouring arcs. */
+		chordDistance = arcEndRadial;
+		sideDistance = std::hypot(arcEndAcross, arcEndRadial) * std::cos(halfSideAngle - std::atan2(arcEndAcross, arcEndRadial));
+		cosHalfSide = std::cos(halfSideAngle);
+		sinHalfSide = std::sin(halfSideAngle);
+
+		/** Pointer triangle, pointing up from its base. */
+		pointerTip = -knobGearOuterDiameter / 2.f;
+		pointerBase = -totalDiameter / 2.f + (knobGearOuterDiameter - knobGearInnerDiameter);
+		pointerHalfWidth = 0.15f * (knobGearOuterDiameter - knobGearInnerDiameter) / 2.f;
+
+		const float pointerHeight = pointerBase - pointerTip;
+		const float pointerSideLength = std::hypot(pointerHalfWidth, pointerHeight);
+
+		/** Sine and cosine of the angle between a side and the pointer's axis. */
+		pointerSin = pointerHalfWidth / pointerSideLength;
+		pointerCos = pointerHeight / pointerSideLength;
+
+		/**
+		 * The path's corners are rounded by 5 pixels: a quadratic curve from 5 pixels down one side to 5 pixels
+		 * down the other, with the tip as its control point, which reaches halfway from the tip to the line
+		 * between its ends. The tip is rounded here by the circle touching both sides that reaches as far.
+		 */
+		const float cornerCut = juce::jmin(5.f, pointerSideLength / 2.f);
+		const float roundedTipDown = cornerCut * pointerCos / 2.f;
+		pointerTipRadius = roundedTipDown * pointerSin / (1.f - pointerSin);
+		pointerTipCentre = pointerTipRadius / pointerSin;
+		pointerTouchAlongSide = pointerTipRadius * pointerCos / pointerSin;
+
+		/** Shadow, offset on screen after the gear is rotated. */
+		shadowOffsetX = (float)parameters.shadow.offset.x;
+		shadowOffsetY = (float)parameters.shadow.offset.y;
+		shadowHalfWidth = getShadowHalfWidth(parameters.shadow);
+		shadowColour = PremultipliedColour::from(parameters.shadow.colour);
+
+		/** The light reflection gradient of the disk and the gear: radial, from the top right, and not rotated. */
+		gradientCentreX = diskRadius / 2.f;
+		gradientCentreY = -diskRadius;
+		gradientInverseRadius = 1.f / std::hypot(diskRadius, 2.f * diskRadius);
+
+		diskColour = PremultipliedColour::from(parameters.diskColour);
+		pointerColour = PremultipliedColour::from(parameters.pointerColour);
+		gearColour = PremultipliedColour::from(parameters.gearColour);
+	}
+
+	/** Distance to the gear from a point relative to the knob centre. */
+	template <typename Floats>
+	Floats getGearDistance(Floats x, Floats y) const
+	{
+		/** Folds the point into the sixteenth of the gear between a bite (along t) and the middle of a flat side. */
+		auto s = abs(x * Floats(cosAngle) + y * Floats(sinAngle));
+		auto t = abs(y * Floats(cosAngle) - x * Floats(sinAngle));
+
+		const auto across = min(s, t);
+		t = max(s, t);
+		s = across;
+
+		const auto reflection = max(s * Floats(cosHalfSide) - t * Floats(sinHalfSide), Floats(0.f));
+		s = s - Floats(2.f) * reflection * Floats(cosHalfSide);
+		t = t + Floats(2.f) * reflection * Floats(sinHalfSide);
+
+		/** The 16 sided polygon through the ends of the arcs, less the bite. */
+		const auto polygon = max(t - Floats(chordDistance), s * Floats(sinHalfSide) + t * Floats(cosHalfSide) - Floats(sideDistance));
+		const auto bite = sqrt(s * s + (t - Floats(biteCentre)) * (t - Floats(biteCentre))) - Floats(biteRadius);
+
+		return max(polygon, -bite);
+	}
+
+	/**
+	 * Distance to the pointer from a point relative to the knob centre.
+	 *
+	 * Points that fall before the rounded tip touches the side, measured along the side, are as far as
+	 * they are from the tip's circle, the rest as far as they are from the side. The two agree where they
+	 * meet, so the lanes are switched between them with a steep clamped step instead of a branch.
+	 */
+	template <typename Floats>
+	Floats getPointerDistance(Floats x, Floats y) const
+	{
+		const auto across = abs(x * Floats(cosAngle) + y * Floats(sinAngle));
+		const auto along = y * Floats(cosAngle) - x * Floats(sinAngle);
+		const auto down = along - Floats(pointerTip);
+
+		const auto alongSide = across * Floats(pointerSin) + down * Floats(pointerCos);
+		const auto side = across * Floats(pointerCos) - down * Floats(pointerSin);
+		const auto tipDown = down - Floats(pointerTipCentre);
+		const auto tip = sqrt(across * across + tipDown * tipDown) - Floats(pointerTipRadius);
+
+		const auto onTip = FloatLanes::clamp((Floats(pointerTouchAlongSide) - alongSide) * Floats(1.0e6f), 0.f, 1.f);
+
+		return max(side + onTip * (tip - side), along - Floats(pointerBase));
+	}
+
+	/** Shades pixels at points relative to the knob centre. */
+	template <typename Floats>
+	Pixels<Floats> shade(Floats x, Floats y, float inversePixelSize) const
+	{
+		auto coverage = [inversePixelSize](Floats distance)
+		{
+			return FloatLanes::clamp(Floats(0.5f) - distance * Floats(inversePixelSize), 0.f, 1.f);
+		};
+
+		Pixels<Floats> pixels;
+
+		/** Disk */
+		const auto diskCoverage = coverage(sqrt(x * x + y * y) - Floats(diskRadius));
+		pixels.over(diskColour, diskCoverage);
+
+		/** White at 15% fading to black at 10%, interpolated unpremultiplied like ColourGradient. */
+		Floats gradientAlpha, gradientLevel;
+
+		if (useGradients)
+		{
+			const auto dx = x - Floats(gradientCentreX);
+			const auto dy = y - Floats(gradientCentreY);
+			const auto position = FloatLanes::clamp(sqrt(dx * dx + dy * dy) * Floats(gradientInverseRadius), 0.f, 1.f);
+
+			gradientAlpha = Floats(0.15f) - Floats(0.05f) * position;
+			gradientLevel = (Floats(1.f) - position) * gradientAlpha;
+
+			pixels.over(diskCoverage * gradientAlpha, diskCoverage * gradientLevel, diskCoverage * gradientLevel, diskCoverage * gradientLevel);
+		}
+
+		/** Pointer */
+		pixels.over(pointerColour, coverage(getPointerDistance(x, y)));
+
+		/** Shadow: the Gaussian blur of its edge is approximated by a smooth step as steep at the edge (see getShadowHalfWidth()). */
+		if (drawShadow)
+		{
+			const auto shadowDistance = getGearDistance(x - Floats(shadowOffsetX), y - Floats(shadowOffsetY));
+			pixels.over(shadowColour, Floats(1.f) - FloatLanes::smoothStep(-shadowHalfWidth, shadowHalfWidth, shadowDistance));
+		}
+
+		/** Gear */
+		const auto gearCoverage = coverage(getGearDistance(x, y));
+		pixels.over(gearColour, gearCoverage);
+
+		if (useGradients)
+			pixels.over(gearCoverage * gradientAlpha, gearCoverage * gradientLevel, gearCoverage * gradientLevel, gearCoverage * gradientLevel);
+
+		return pixels;
+	}
+
+	float centreX, centreY;
+	float cosAngle, sinAngle;
+
+	float diskRadius = 0.f;
+
+	float biteCentre = 0.f, biteRadius = 0.f;
+	float chordDistance = 0.f, sideDistance = 0.f;
+	float cosHalfSide = 0.f, sinHalfSide = 0.f;
+
+	float pointerTip = 0.f, pointerBase = 0.f, pointerHalfWidth = 0.f;
+	float pointerSin = 0.f, pointerCos = 1.f;
+	float pointerTipRadius = 0.f, pointerTipCentre = 0.f, pointerTouchAlongSide = 0.f;
+
+	float shadowOffsetX = 0.f, shadowOffsetY = 0.f, shadowHalfWidth = 1.f;
+
+	float gradientCentreX = 0.f, gradientCentreY = 0.f, gradientInverseRadius = 0.f;
+
+	PremultipliedColour diskColour, pointerColour, gearColour, shadowColour;
+
+	bool drawShadow, useGradients;
+};
+
+template <typename Floats>
+int GearSdfRenderer::shadeRow(juce::PixelARGB* row, int firstPixel, int numPixels, float left, float y, float pixelSize, const Shading& shading)
+{
+	const float inversePixelSize = 1.f / pixelSize;
+	const Floats pixelY = y - shading.centreY;
+
+	int pixel = firstPixel;
+
+	for (; pixel + Floats::numLanes <= numPixels; pixel += Floats::numLanes)
+	{
+		const auto pixelX = Floats::ramp(left + (pixel + 0.5f) * pixelSize - shading.centreX, pixelSize);
+		const auto pixels = shading.shade(pixelX, pixelY, inversePixelSize);
+
+		Floats::storePixels(row + pixel,
+			FloatLanes::clamp(pixels.alpha, 0.f, 1.f), FloatLanes::clamp(pixels.red, 0.f, 1.f),
+			FloatLanes::clamp(pixels.green, 0.f, 1.f), FloatLanes::clamp(pixels.blue, 0.f, 1.f));
+	}
+
+	return pixel;
+}
+
+void GearSdfRenderer::draw(juce::Graphics& g, const Parameters& parameters)
+{
+	const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+	/** Whole physical pixels, so the image is drawn without resampling. */
+	const auto physicalArea = (getDrawnArea(parameters) * scale).getSmallestIntegerContainer();
+
+	if (physicalArea.isEmpty())
+		return;
+
+	const juce::ScopedLock sl(lock);
+
+	/** Reused while the knob's size stays the same. */
+	if (canvas.getWidth() != physicalArea.getWidth() || canvas.getHeight() != physicalArea.getHeight())
+	{
+		canvas = juce::Image(juce::Image::ARGB, physicalArea.getWidth(), physicalArea.getHeight(), false, juce::SoftwareImageType());
+		renderCache->setAssetBytes(this, (size_t)canvas.getWidth() * (size_t)canvas.getHeight() * 4);
+	}
+
+	render(canvas, physicalArea.toFloat() / scale, scale, parameters);
+
+	g.drawImageTransformed(canvas, juce::AffineTransform::scale(1.f / scale)
+		.translated(physicalArea.getX() / scale, physicalArea.getY() / scale));
+}
+
+void GearSdfRenderer::releaseResources()
+{
+	const juce::ScopedLock sl(lock);
+
+	canvas = {};
+	renderCache->setAssetBytes(this, 0);
+}
+
+void GearSdfRenderer::render(juce::Image& image, juce::Rectangle<float> area, float scale, const Parameters& parameters)
+{
+	jassert(image.getFormat() == juce::Image::ARGB);
+
+	const Shading shading(parameters);
+	const float pixelSize = 1.f / scale;
+	const int width = image.getWidth();
+	const int height = image.getHeight();
+
+	const juce::Image::BitmapData bitmap(image, juce::Image::BitmapData::writeOnly);
+
+	auto shadeRows = [&](int firstRow, int endRow)
+	{
+		for (int rowIndex = firstRow; rowIndex < endRow; rowIndex++)
+		{
+			auto* row = reinterpret_cast<juce::PixelARGB*>(bitmap.getLinePointer(rowIndex));
+			const float y = area.getY() + (rowIndex + 0.5f) * pixelSize;
+
+			/** The pixels that don't fill a whole set of lanes are shaded one at a time. */
+			const int shaded = shadeRow<FloatLanes::Native>(row, 0, width, area.getX(), y, pixelSize, shading);
+			shadeRow<FloatLanes::Scalar>(row, shaded, width, area.getX(), y, pixelSize, shading);
+		}
+	};
+
+	if (width * height < minPixelsForThreads)
+	{
+		shadeRows(0, height);
+		return;
+	}
+
+	const int numBands = (height + rowsPerBand - 1) / rowsPerBand;
+
+	threadPool->parallelFor(numBands, [&](int band)
+		{
+			shadeRows(band * rowsPerBand, juce::jmin(height, (band + 1) * rowsPerBand));
+		});
+}
+
+juce::Rectangle<float> GearSdfRenderer::getDrawnArea(const Parameters& parameters)
+{
+	const auto knob = juce::Rectangle<float>(parameters.totalDiameter, parameters.totalDiameter).withCentre(parameters.centre);
+
+	if (!parameters.drawShadow)
+		return knob;
+
+	return knob.getUnion(knob.translated((float)parameters.shadow.offset.x, (float)parameters.shadow.offset.y)
+		.expanded(juce::jmax((float)parameters.shadow.radius, getShadowHalfWidth(parameters.shadow))));
+}
+
+float GearSdfRenderer::getShadowHalfWidth(const BoxBlurShadow& shadow)
+{
+	/** A smooth step across twice this is 0.75 / halfWidth steep at its middle, as the Gaussian's edge is 1 / (sigma * sqrt(2 pi)). */
+	const float sigma = BoxBlurShadow::getSigmaForRadius(juce::jmax(1.f, (float)shadow.radius));
+	return 0.75f * std::sqrt(juce::MathConstants<float>::twoPi) * sigma;
+}
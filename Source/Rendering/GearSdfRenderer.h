@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    GearSdfRenderer.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RenderThreadPool.h"
+#include "BoxBlurShadow.h"
+#include "RenderCache.h"
+
+/**
+ * Draws the gear shaped knob from signed distance functions instead of paths.
+ *
+ * The gear is a 16 sided polygon with circular bites taken out of it (the same shape
+ * Shapes::getGearShapedPath() traces with arcs), the pointer a triangle with its tip rounded as
+ * far as the path's rounded corner, and the disk a circle. Every pixel evaluates their distances
+ * once and composites, in the order the path based LookAndFeel draws them, the disk, its light
+ * reflection gradient, the pointer, the gear's soft shadow, the gear and its gradient. Coverage
+ * comes from the distance, so edges are antialiased without an edge table, and the shadow from a
+ * smooth step of the distance as steep as the BoxBlurShadow's Gaussian edge, so it needs no blur.
+ * BenchmarkRunner's --bench-sdf checks the result against the paths with ImageDifference.
+ *
+ * Pixels are shaded FloatLanes::Native::numLanes at a time, and large knobs are split into bands
+ * of rows across the RenderThreadPool. The result is drawn as one image.
+ */
+class GearSdfRenderer
+{
+public:
+	/** What to draw. Positions and sizes are in the logical coordinates of the graphics context. */
+	struct Parameters
+	{
+		/** Centre and diameter of the circle the knob fits in, as in the path based LookAndFeel. */
+		juce::Point<float> centre;
+		float totalDiameter = 0.f;
+		/** Rotation of the gear and pointer, in radians clockwise from 12 o'clock. */
+		float angle = 0.f;
+
+		juce::Colour diskColour;
+		juce::Colour pointerColour;
+		juce::Colour gearColour;
+		BoxBlurShadow shadow;
+
+		bool drawShadow = true;
+		bool useGradients = true;
+	};
+
+	/**
+	 * Smallest knob diameter, in logical pixels, drawn from the distance field; smaller knobs are drawn from paths.
+	 * The shadow is a smooth step of the gear's distance rather than a blur of its mask, which differs from the
+	 * blurred shadow in the gear's concave bites; below this diameter the bites are narrow enough, next to the
+	 * shadow's size, that the difference isn't expected to stay within the tolerance of ImageDifference.
+	 * --bench-sdf checks the sizes from here up.
+	 */
+	static constexpr float minDiameter = 96.f;
+
+	/** Knobs with fewer physical pixels than this are rendered on the calling thread only. */
+	static constexpr int minPixelsForThreads = 256 * 256;
+
+	/** Rows per band when a knob is split across threads. */
+	static constexpr int rowsPerBand = 32;
+
+	GearSdfRenderer() = default;
+	~GearSdfRenderer();
+
+	/**
+	 * Draws the knob into the context, at its physical pixel scale.
+	 * It's rendered into an image kept for the next draw of the same size, counted in the RenderCache's
+	 * stats and budget (see RenderCache::setAssetBytes()) until releaseResources() frees it.
+	 */
+	void draw(juce::Graphics& g, const Parameters& parameters);
+
+	/** Frees the image draw() renders into. */
+	void releaseResources();
+
+	/**
+	 * Renders the knob into an image of the given physical size, mapped to the logical area at the given scale.
+	 * Used by draw(), and by the benchmark to compare against the path based rendering.
+	 */
+	void render(juce::Image& image, juce::Rectangle<float> area, float scale, const Parameters& parameters);
+
+	/** Returns the logical area the knob and its shadow cover. */
+	static juce::Rectangle<float> getDrawnArea(const Parameters& parameters);
+
+	/** Returns how far either side of the gear's edge its shadow fades, in logical pixels. */
+	static float getShadowHalfWidth(const BoxBlurShadow& shadow);
+
+private:
+	/** Everything the pixels are shaded with, worked out once per render. */
+	struct Shading;
+
+	/** Shades the pixels of a row from firstPixel on, Floats::numLanes at a time. Returns the first pixel left unshaded. */
+	template <typename Floats>
+	static int shadeRow(juce::PixelARGB* row, int firstPixel, int numPixels, float left, float y, float pixelSize, const Shading& shading);
+
+	juce::CriticalSection lock;
+	juce::Image canvas;
+
+	juce::SharedResourcePointer<RenderThreadPool> threadPool;
+	juce::SharedResourcePointer<RenderCache> renderCache;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearSdfRenderer)
+};
@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    ImageDifference.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "ImageDifference.h"
+
+ImageDifference ImageDifference::between(const juce::Image& a, const juce::Image& b)
+{
+	jassert(a.getFormat() == b.getFormat());
+	jassert(a.getBounds() == b.getBounds());
+
+	const juce::Image::BitmapData bitmapA(a, juce::Image::BitmapData::readOnly);
+	const juce::Image::BitmapData bitmapB(b, juce::Image::BitmapData::readOnly);
+
+	/** Every byte of a pixel is a channel, whatever the format. */
+	const int numChannels = bitmapA.pixelStride;
+
+	juce::uint64 totalLevels = 0;
+	juce::int64 numLarge = 0;
+
+	for (int y = 0; y < a.getHeight(); y++)
+	{
+		for (int x = 0; x < a.getWidth(); x++)
+		{
+			const auto* pixelA = bitmapA.getPixelPointer(x, y);
+			const auto* pixelB = bitmapB.getPixelPointer(x, y);
+
+			int largest = 0;
+
+			for (int channel = 0; channel < numChannels; channel++)
+			{
+				const int difference = std::abs((int)pixelA[channel] - (int)pixelB[channel]);
+
+				totalLevels += (juce::uint64)difference;
+				largest = juce::jmax(largest, difference);
+			}
+
+			if (largest > largeLevels)
+				numLarge++;
+		}
+	}
+
+	const auto numPixels = (double)juce::jmax(1, a.getWidth() * a.getHeight());
+
+	ImageDifference difference;
+	difference.meanLevels = (double)totalLevels / (numPixels * numChannels);
+	difference.fractionLarge = (double)numLarge / numPixels;
+
+	return difference;
+}
@@ -0,0 +1,38 @@
+/*
+  ==============================================================================
+
+    ImageDifference.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/** How far apart two renderings of the same thing are, e.g. a fast path and the Graphics calls it replaces. */
+struct ImageDifference
+{
+	/** Mean absolute difference over every pixel and channel, in 8-bit levels. */
+	double meanLevels = 0.0;
+	/** Fraction of pixels where some channel differs by more than largeLevels. */
+	double fractionLarge = 0.0;
+
+	/** Levels above which a pixel counts as visibly different. */
+	static constexpr int largeLevels = 32;
+
+	/** True if the renderings are close enough to be swapped without it being noticed. */
+	bool isWithinTolerance() const { return meanLevels <= 2.0 && fractionLarge <= 0.01; }
+
+	/** Keeps the larger of each measure. */
+	void takeWorst(const ImageDifference& other)
+	{
+		meanLevels = juce::jmax(meanLevels, other.meanLevels);
+		fractionLarge = juce::jmax(fractionLarge, other.fractionLarge);
+	}
+
+	/** Compares two images of the same size and format, channel by channel. */
+	static ImageDifference between(const juce::Image& a, const juce::Image& b);
+};
@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    InteractionQuality.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "InteractionQuality.h"
+
+const juce::Identifier InteractionQuality::interactiveProperty("interactive");
+int InteractionQuality::numResizesInProgress = 0;
+
+InteractionQuality::~InteractionQuality()
+{
+	attachTo(nullptr);
+}
+
+void InteractionQuality::attachTo(juce::Component* newControl)
+{
+	stopTimer();
+
+	if (control != nullptr)
+	{
+		control->removeMouseListener(this);
+		control->getProperties().remove(interactiveProperty);
+	}
+
+	if (resizing)
+	{
+		resizing = false;
+		numResizesInProgress--;
+	}
+
+	control = newControl;
+
+	if (control != nullptr)
+		control->addMouseListener(this, false);
+}
+
+void InteractionQuality::resizeStarted()
+{
+	if (!resizing)
+	{
+		resizing = true;
+		numResizesInProgress++;
+	}
+
+	/** Restarted on every resize step, so it only fires once the resize has settled. */
+	startTimer(settleMilliseconds);
+}
+
+void InteractionQuality::mouseDown(const juce::MouseEvent&)
+{
+	stopTimer();
+	setInteractive(true);
+}
+
+void InteractionQuality::mouseUp(const juce::MouseEvent&)
+{
+	startTimer(settleMilliseconds);
+}
+
+void InteractionQuality::timerCallback()
+{
+	settle();
+}
+
+void InteractionQuality::settle()
+{
+	stopTimer();
+
+	if (resizing)
+	{
+		resizing = false;
+		numResizesInProgress--;
+	}
+
+	setInteractive(false);
+
+	/** The single full quality repaint. Repainting the top level component repaints its children too. */
+	if (control != nullptr)
+		control->repaint();
+}
+
+void InteractionQuality::setInteractive(bool shouldBeInteractive)
+{
+	if (control != nullptr)
+		control->getProperties().set(interactiveProperty, shouldBeInteractive);
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    InteractionQuality.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "LevelOfDetail.h"
+
+/**
+ * Interaction aware rendering quality.
+ *
+ * While a control is being dragged, or while a window is being live-resized,
+ * the LookAndFeels draw on a fast path: no blurred shadows, nearest neighbour
+ * scaling of the cached layers and flat fills.
+ * Once the interaction settles the control is repainted once at full quality.
+ *
+ * Attach one to each control that should use the fast path while it's dragged,
+ * and call resizeStarted() from the resized() of the top level component.
+ */
+class InteractionQuality : private juce::MouseListener, private juce::Timer
+{
+public:
+	/** Time without input after which an interaction has settled. */
+	static constexpr int settleMilliseconds = 150;
+
+	InteractionQuality() = default;
+	~InteractionQuality() override;
+
+	/** Watches the drags of a control. Pass nullptr to detach. */
+	void attachTo(juce::Component* newControl);
+
+	/** Marks the attached component as being resized until it settles. */
+	void resizeStarted();
+
+	/** Ends the interaction now instead of after settleMilliseconds, and repaints the control at full quality. */
+	void settle();
+
+	/** True while any window is resizing, or hasn't settled yet. */
+	static bool isResizeInProgress() { return numResizesInProgress > 0; }
+
+	/** True while the control is being dragged, any window is resizing, or either hasn't settled yet. */
+	static bool isInteractive(const juce::Component& control)
+	{
+		return isResizeInProgress() || (bool)control.getProperties()[interactiveProperty];
+	}
+
+	/** Returns the options with the fast path applied. */
+	static LevelOfDetail::Options getFastPathOptions(LevelOfDetail::Options options)
+	{
+		options.drawShadows = false;
+		options.useGradients = false;
+		options.resamplingQuality = juce::Graphics::lowResamplingQuality;
+
+		return options;
+	}
+
+	/** Returns the options to draw a control with: the fast path while it's interactive, the given options otherwise. */
+	static LevelOfDetail::Options getOptions(const juce::Component& control, LevelOfDetail::Options options)
+	{
+		return isInteractive(control) ? getFastPathOptions(options) : options;
+	}
+
+private:
+	void mouseDown(const juce::MouseEvent& event) override;
+	void mouseUp(const juce::MouseEvent& event) override;
+	void timerCallback() override;
+
+	void setInteractive(bool shouldBeInteractive);
+
+	/** Component property set while the control is on the fast path. */
+	static const juce::Identifier interactiveProperty;
+
+	/** Number of components being resized. Only used on the message thread. */
+	static int numResizesInProgress;
+
+	juce::Component::SafePointer<juce::Component> control;
+	bool resizing = false;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InteractionQuality)
+};
@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    LevelOfDetail.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Size based level of detail policy.
+ *
+ * Small controls skip the effects that can't be seen at their size (shadow blur,
+ * gradients, text labels) and use simplified geometry; large controls use
+ * higher quality image resampling for their cached layers.
+ * Each LookAndFeel owns one, with thresholds suited to how it measures its size.
+ */
+class LevelOfDetail
+{
+public:
+	/** Level of detail tiers, from cheapest to most detailed. */
+	enum Tier
+	{
+		low,
+		medium,
+		high
+	};
+
+	static constexpr int numTiers = 3;
+
+	/** Control sizes (in logical pixels) where the tiers change. */
+	struct Thresholds
+	{
+		/** Controls smaller than this are drawn at the low tier. */
+		int lowBelow = 48;
+		/** Controls this size or larger are drawn at the high tier. */
+		int highFrom = 256;
+	};
+
+	/** What to draw at a tier. */
+	struct Options
+	{
+		bool drawShadows = true;
+		bool useGradients = true;
+		bool drawLabels = true;
+		bool simplifiedGeometry = false;
+		juce::Graphics::ResamplingQuality resamplingQuality = juce::Graphics::mediumResamplingQuality;
+	};
+
+	LevelOfDetail() = default;
+	explicit LevelOfDetail(Thresholds initialThresholds) : thresholds(initialThresholds) {}
+
+	/** Returns the tier for a control of the given size. */
+	Tier getTier(int size) const
+	{
+		if (size < thresholds.lowBelow)
+			return low;
+
+		if (size >= thresholds.highFrom)
+			return high;
+
+		return medium;
+	}
+
+	/** Returns the options of a tier. */
+	static Options getOptions(Tier tier)
+	{
+		Options options;
+
+		switch (tier)
+		{
+		case low:
+			options.drawShadows = false;
+			options.useGradients = false;
+			options.drawLabels = false;
+			options.simplifiedGeometry = true;
+			options.resamplingQuality = juce::Graphics::lowResamplingQuality;
+			break;
+		case high:
+			options.resamplingQuality = juce::Graphics::highResamplingQuality;
+			break;
+		case medium:
+		default:
+			break;
+		}
+
+		return options;
+	}
+
+	/** Returns the options for a control of the given size. */
+	Options getOptionsForSize(int size) const { return getOptions(getTier(size)); }
+
+	/** Returns a readable name for a tier. */
+	static const char* getTierName(Tier tier)
+	{
+		switch (tier)
+		{
+		case low:		return "Low";
+		case medium:	return "Medium";
+		case high:		return "High";
+		default:		return "Unknown";
+		}
+	}
+
+	/** Sets the sizes where the tiers change. */
+	void setThresholds(Thresholds newThresholds)
+	{
+		jassert(newThresholds.lowBelow <= newThresholds.highFrom);
+		thresholds = newThresholds;
+	}
+
+	/** Returns the sizes where the tiers change. */
+	Thresholds getThresholds() const { return thresholds; }
+
+private:
+	Thresholds thresholds;
+};
@@ -0,0 +1,152 @@
+/*
+  ==============================================================================
+
+    MaterialTexture.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "MaterialTexture.h"
+
+MaterialTexture::~MaterialTexture()
+{
+	renderCache->setAssetBytes(this, 0);
+}
+
+juce::Image MaterialTexture::getLevel(int physicalSize)
+{
+	const juce::ScopedLock sl(lock);
+
+	if (levels.isEmpty())
+	{
+		if (decodeFailed)
+			return {};
+
+		const auto decoded = juce::ImageFileFormat::loadFrom(BinaryData::RoughPlasticSmall_png, (size_t)BinaryData::RoughPlasticSmall_pngSize);
+
+		if (!decoded.isValid())
+		{
+			jassertfalse;
+			decodeFailed = true;
+			return {};
+		}
+
+		/** Premultiplied ARGB in memory, so the copies can be averaged byte by byte. */
+		juce::Image full(juce::Image::ARGB, decoded.getWidth(), decoded.getHeight(), false, juce::SoftwareImageType());
+
+		{
+			juce::Graphics g(full);
+			g.drawImageAt(decoded, 0, 0);
+		}
+
+		levels.add(full);
+		updateAssetBytes();
+	}
+
+	physicalSize = juce::jmax(smallestLevelSize, physicalSize);
+
+	/** Only the copies down to the size that's asked for are built. */
+	while (juce::jmin(levels.getLast().getWidth(), levels.getLast().getHeight()) / 2 >= physicalSize)
+	{
+		levels.add(halve(levels.getLast()));
+		updateAssetBytes();
+	}
+
+	for (int i = levels.size(); --i >= 0;)
+	{
+		const auto& level = levels.getReference(i);
+
+		if (juce::jmin(level.getWidth(), level.getHeight()) >= physicalSize)
+			return level;
+	}
+
+	return levels.getFirst();
+}
+
+void MaterialTexture::fillPath(juce::Graphics& g, const juce::Path& path, float opacity)
+{
+	const auto bounds = path.getBounds();
+	const float size = juce::jmax(bounds.getWidth(), bounds.getHeight());
+
+	if (size <= 0.f)
+		return;
+
+	const auto level = getLevel(juce::roundToInt(size * g.getInternalContext().getPhysicalPixelScaleFactor()));
+
+	if (!level.isValid())
+		return;
+
+	const juce::Graphics::ScopedSaveState savedState(g);
+
+	g.reduceClipRegion(path);
+	g.setOpacity(opacity);
+	g.drawImageTransformed(level, juce::AffineTransform::scale(size / level.getWidth(), size / level.getHeight())
+		.translated(bounds.getCentreX() - size / 2.f, bounds.getCentreY() - size / 2.f));
+}
+
+bool MaterialTexture::isDecoded() const
+{
+	const juce::ScopedLock sl(lock);
+	return !levels.isEmpty();
+}
+
+int MaterialTexture::getNumLevels() const
+{
+	const juce::ScopedLock sl(lock);
+	return levels.size();
+}
+
+size_t MaterialTexture::getNumBytes() const
+{
+	const juce::ScopedLock sl(lock);
+	return numBytes;
+}
+
+void MaterialTexture::releaseResources()
+{
+	const juce::ScopedLock sl(lock);
+	levels.clear();
+	updateAssetBytes();
+}
+
+juce::Image MaterialTexture::halve(const juce::Image& image)
+{
+	const int width = juce::jmax(1, image.getWidth() / 2);
+	const int height = juce::jmax(1, image.getHeight() / 2);
+
+	juce::Image half(juce::Image::ARGB, width, height, false, juce::SoftwareImageType());
+
+	const juce::Image::BitmapData source(image, juce::Image::BitmapData::readOnly);
+	const juce::Image::BitmapData destination(half, juce::Image::BitmapData::writeOnly);
+
+	for (int y = 0; y < height; y++)
+	{
+		const auto* top = source.getLinePointer(2 * y);
+		const auto* bottom = source.getLinePointer(juce::jmin(2 * y + 1, source.height - 1));
+		auto* row = destination.getLinePointer(y);
+
+		for (int x = 0; x < width; x++)
+		{
+			const int left = 2 * x * source.pixelStride;
+			const int right = juce::jmin(2 * x + 1, source.width - 1) * source.pixelStride;
+
+			for (int channel = 0; channel < 4; channel++)
+				row[x * destination.pixelStride + channel] = (juce::uint8)((top[left + channel] + top[right + channel]
+					+ bottom[left + channel] + bottom[right + channel] + 2) / 4);
+		}
+	}
+
+	return half;
+}
+
+void MaterialTexture::updateAssetBytes()
+{
+	numBytes = 0;
+
+	for (const auto& level : levels)
+		numBytes += (size_t)level.getWidth() * (size_t)level.getHeight() * 4;
+
+	renderCache->setAssetBytes(this, numBytes);
+}
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    MaterialTexture.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RenderCache.h"
+
+/**
+ * The surface material of the knob and the fader caps, decoded from the RoughPlasticSmall.png resource.
+ *
+ * Nothing is decoded until the texture is first drawn. It is then kept with a chain of pre-scaled copies,
+ * each half the size of the one before and built the first time a size needs it, so that the texture is
+ * always resampled from a copy close to the size it's drawn at instead of shimmering down from the full
+ * one. Its memory is counted in the RenderCache's stats and budget (see RenderCache::setAssetBytes()).
+ *
+ * The controls don't draw it every frame: they fill their shapes with it once into cached layers and draw
+ * those. Share one with juce::SharedResourcePointer. May be used from any thread.
+ */
+class MaterialTexture
+{
+public:
+	/** The smallest copy in the chain, in pixels. */
+	static constexpr int smallestLevelSize = 8;
+
+	MaterialTexture() = default;
+	~MaterialTexture();
+
+	/**
+	 * Returns the smallest copy of the texture at least the given size, or the full texture if it's smaller.
+	 * Decodes the texture and builds the copies down to that size first, if needed.
+	 * Returns a null image if the resource can't be decoded.
+	 */
+	juce::Image getLevel(int physicalSize);
+
+	/**
+	 * Fills a path with the texture, scaled evenly to cover the path's bounds, at an opacity.
+	 * The copy is picked for the physical size the path is drawn at.
+	 */
+	void fillPath(juce::Graphics& g, const juce::Path& path, float opacity);
+
+	/** True once the texture has been decoded. */
+	bool isDecoded() const;
+
+	/** Number of copies built, including the full texture. */
+	int getNumLevels() const;
+
+	/** Memory used by the decoded texture and its copies, in bytes. */
+	size_t getNumBytes() const;
+
+	/** Frees the texture and its copies. It's decoded again the next time it's used. */
+	void releaseResources();
+
+private:
+	/** Returns a copy of a premultiplied ARGB image half its size (rounded down), each pixel the average of four. */
+	static juce::Image halve(const juce::Image& image);
+
+	/** Tells the render cache how much memory the copies use. Called with the lock held. */
+	void updateAssetBytes();
+
+	mutable juce::CriticalSection lock;
+
+	/** The full texture first, then each copy half the size of the one before. */
+	juce::Array<juce::Image> levels;
+	size_t numBytes = 0;
+	bool decodeFailed = false;
+
+	juce::SharedResourcePointer<RenderCache> renderCache;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MaterialTexture)
+};
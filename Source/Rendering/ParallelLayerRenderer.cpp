@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+
+    ParallelLayerRenderer.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "ParallelLayerRenderer.h"
+
+ParallelLayerRenderer::ParallelLayerRenderer(juce::Component& componentToRender)
+	: component(componentToRender)
+{
+}
+
+void ParallelLayerRenderer::paint(juce::Graphics& g)
+{
+	/** The component's own paint is the background the children are drawn over. */
+	component.paint(g);
+
+	const auto clip = g.getClipBounds().getIntersection(component.getLocalBounds());
+
+	if (clip.isEmpty())
+		return;
+
+	const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+	const auto physicalArea = (clip.toFloat() * scale).getSmallestIntegerContainer();
+
+	if (image.getWidth() < physicalArea.getWidth() || image.getHeight() < physicalArea.getHeight())
+		image = juce::Image(juce::Image::ARGB, juce::jmax(physicalArea.getWidth(), image.getWidth()),
+			juce::jmax(physicalArea.getHeight(), image.getHeight()), false, juce::SoftwareImageType());
+
+	std::vector<std::function<void()>> layerJobs;
+	juce::RectangleList<int> missingLayers;
+
+	{
+		RenderCache::ScopedLayerRecording recording;
+		missingLayers = paintChildren(juce::RectangleList<int>(physicalArea), physicalArea, scale, &recording);
+		layerJobs = recording.takeLayerJobs();
+	}
+
+	numLayersRendered = (int)layerJobs.size();
+
+	/** Only the children painted without some of their layers are painted again, once the layers are rendered. */
+	if (!layerJobs.empty())
+	{
+		const double renderStartMilliseconds = juce::Time::getMillisecondCounterHiRes();
+
+		threadPool->parallelFor((int)layerJobs.size(), [&layerJobs](int index)
+			{
+				layerJobs[(size_t)index]();
+			}, maxThreads);
+
+		renderCache->addRebuildTime(juce::Time::getMillisecondCounterHiRes() - renderStartMilliseconds);
+
+		paintChildren(missingLayers, physicalArea, scale, nullptr);
+	}
+
+	g.drawImageTransformed(image.getClippedImage(physicalArea.withZeroOrigin()), juce::AffineTransform::scale(1.f / scale)
+		.translated(physicalArea.getX() / scale, physicalArea.getY() / scale));
+
+	component.paintOverChildren(g);
+}
+
+juce::RectangleList<int> ParallelLayerRenderer::paintChildren(const juce::RectangleList<int>& physicalRegion, juce::Rectangle<int> physicalArea,
+	float scale, const RenderCache::ScopedLayerRecording* recording)
+{
+	juce::RectangleList<int> missingLayers;
+
+	for (const auto& rectangle : physicalRegion)
+		image.clear(rectangle - physicalArea.getPosition());
+
+	juce::Graphics g(image);
+	g.setOrigin(-physicalArea.getPosition());
+
+	if (!g.reduceClipRegion(physicalRegion))
+		return missingLayers;
+
+	g.addTransform(juce::AffineTransform::scale(scale));
+
+	for (auto* child : component.getChildren())
+	{
+		if (!child->isVisible() || !g.clipRegionIntersects(child->getBoundsInParent()))
+			continue;
+
+		const int numLayersMissedBefore = recording != nullptr ? recording->getNumLayersMissed() : 0;
+
+		{
+			const juce::Graphics::ScopedSaveState savedState(g);
+
+			/** As Component paints its children: in the child's transform, clipped to its bounds, from its own image if it has one. */
+			if (child->isTransformed())
+				g.addTransform(child->getTransform());
+
+			if (g.reduceClipRegion(child->getBounds()))
+			{
+				g.setOrigin(child->getPosition());
+
+				if (auto* childImage = child->getCachedComponentImage())
+				{
+					const RenderCache::ScopedLayerRecordingPause pause;
+					childImage->paint(g);
+				}
+				else
+				{
+					child->paintEntireComponent(g, false);
+				}
+			}
+		}
+
+		if (recording != nullptr && recording->getNumLayersMissed() > numLayersMissedBefore)
+			missingLayers.add((child->getBoundsInParent().toFloat() * scale).getSmallestIntegerContainer().getIntersection(physicalArea));
+	}
+
+	return missingLayers;
+}
+
+void ParallelLayerRenderer::releaseResources()
+{
+	image = {};
+}
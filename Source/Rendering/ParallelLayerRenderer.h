@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    ParallelLayerRenderer.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RenderThreadPool.h"
+#include "RenderCache.h"
+
+/**
+ * Paints a component's children with their missing cached layers rendered across the RenderThreadPool.
+ *
+ * Installed with Component::setCachedComponentImage(), JUCE calls it instead of painting the
+ * component and its children itself. The children are only painted on the calling thread, the
+ * message thread, into an image of the area being repainted, while the layers missing from the
+ * RenderCache (and the DigitGlyphAtlas) are recorded (see RenderCache::ScopedLayerRecording). If any
+ * were, the layers are rendered across the threads, the children that missed them are painted again
+ * (with whatever overlaps them), and the image is drawn. Only the layers' paint functions run on other
+ * threads, so nothing a component keeps is touched there. Once everything is cached, that's a single
+ * paint and the copy of its image. The paint itself isn't split across threads.
+ *
+ * Layers that would be drawn stretched on the message thread (see RenderCache::getImage()) still are,
+ * so a window resizing or a frame that has spent its rebuild budget doesn't render them either.
+ * The time spent rendering layers on the threads counts against the rebuild budget of the frame.
+ *
+ * Children buffered to an image of their own (with a CachedComponentImage) are drawn from it, as
+ * Component would, and render the layers they miss right away so that their image is never missing any.
+ */
+class ParallelLayerRenderer : public juce::CachedComponentImage
+{
+public:
+	explicit ParallelLayerRenderer(juce::Component& componentToRender);
+
+	/** Paints the component, then its children as described above, then its paintOverChildren(). */
+	void paint(juce::Graphics& g) override;
+
+	/** Nothing is kept from paint to paint but the image, so every repaint goes ahead. */
+	bool invalidateAll() override { return true; }
+	bool invalidate(const juce::Rectangle<int>&) override { return true; }
+
+	/** Frees the image. */
+	void releaseResources() override;
+
+	/** Limits the threads the layers are rendered on, including the calling thread. 0 (the default) uses all of them. */
+	void setMaxThreads(int newMaxThreads) { maxThreads = juce::jmax(0, newMaxThreads); }
+	int getMaxThreads() const { return maxThreads; }
+
+	/** Number of layers the last paint rendered across the threads. */
+	int getNumLayersRendered() const { return numLayersRendered; }
+
+private:
+	/**
+	 * Clears the image over a region and paints the children that intersect it there. The image holds the
+	 * physical area given, and the region is in physical pixels too.
+	 *
+	 * \return With a recording, the physical bounds of the children that were left without some of their layers.
+	 */
+	juce::RectangleList<int> paintChildren(const juce::RectangleList<int>& physicalRegion, juce::Rectangle<int> physicalArea, float scale,
+		const RenderCache::ScopedLayerRecording* recording);
+
+	juce::Component& component;
+
+	int maxThreads = 0;
+	int numLayersRendered = 0;
+
+	/** The children painted over the area being repainted. Reused while it's no bigger. */
+	juce::Image image;
+
+	juce::SharedResourcePointer<RenderCache> renderCache;
+	juce::SharedResourcePointer<RenderThreadPool> threadPool;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParallelLayerRenderer)
+};
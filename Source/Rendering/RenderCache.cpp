@@ -0,0 +1,842 @@
+/*
+  ==============================================================================
+
+    RenderCache.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "RenderCache.h"
+#include "InteractionQuality.h"
+#include "Theme.h"
+
+namespace
+{
+	/**
+	 * Layout of a cache file, all numbers little-endian:
+	 *
+	 *  - Header: "RCCH", format version (int32), app version hash, theme colours hash (uint64 each),
+	 *    the bytes of a reference pixel, number of layers (int32), checksum of the table of layers (uint64).
+	 *  - Table of layers, layerRecordSize bytes each: key (controlType, layer, width, height, scale and
+	 *    whether it bakes the theme in, int32 each, variant int64), pixel format, width and height in pixels,
+	 *    unused (int32 each), offset and size of the pixels in the file, checksum of the pixels (int64 each).
+	 *  - The pixels of each layer, rows packed, each layer starting at a multiple of dataAlignment.
+	 */
+	constexpr const char* fileMagic = "RCCH";
+	constexpr int headerSize = 40;
+	constexpr int layerRecordSize = 72;
+	constexpr int dataAlignment = 16;
+
+	/** FNV-1a over eight bytes at a time, then the bytes left over. */
+	juce::uint64 getChecksum(const juce::uint8* data, size_t numBytes)
+	{
+		constexpr juce::uint64 prime = 0x100000001b3ull;
+		juce::uint64 hash = 0xcbf29ce484222325ull;
+		size_t i = 0;
+
+		for (; i + 8 <= numBytes; i += 8)
+		{
+			juce::uint64 word;
+			std::memcpy(&word, data + i, 8);
+			hash = (hash ^ word) * prime;
+		}
+
+		for (; i < numBytes; i++)
+			hash = (hash ^ data[i]) * prime;
+
+		return hash;
+	}
+
+	/**
+	 * Layers are only valid for the drawing code that rendered them. The app's version isn't bumped
+	 * when that changes, so it's RenderCache::renderCodeVersion, and the version of JUCE, which draws them.
+	 */
+	juce::uint64 getAppVersionHash()
+	{
+		const auto version = juce::String(RenderCache::renderCodeVersion) + " " + juce::SystemStats::getJUCEVersion();
+		return getChecksum(reinterpret_cast<const juce::uint8*>(version.toRawUTF8()), version.getNumBytesAsUTF8());
+	}
+
+	/** The bytes of a pixel as this machine keeps them in memory, which the saved pixels are in. */
+	std::array<juce::uint8, 4> getReferencePixel()
+	{
+		const juce::PixelARGB pixel(0x11, 0x22, 0x33, 0x44);
+
+		std::array<juce::uint8, 4> bytes;
+		std::memcpy(bytes.data(), &pixel, bytes.size());
+
+		return bytes;
+	}
+
+	int getPixelStride(juce::Image::PixelFormat format)
+	{
+		return format == juce::Image::SingleChannel ? 1 : 4;
+	}
+
+	/**
+	 * The pixels of a layer in a memory mapped cache file, read where they are. Read-only: the layers
+	 * are only drawn from. Keeps the file mapped until the last image using it is deleted.
+	 */
+	class MappedPixelData : public juce::ImagePixelData
+	{
+	public:
+		MappedPixelData(juce::Image::PixelFormat format, int imageWidth, int imageHeight,
+			std::shared_ptr<juce::MemoryMappedFile> file, const juce::uint8* pixels)
+			: juce::ImagePixelData(format, imageWidth, imageHeight),
+			mappedFile(std::move(file)),
+			data(const_cast<juce::uint8*>(pixels)),
+			pixelStride(getPixelStride(format)),
+			lineStride(imageWidth * pixelStride)
+		{
+		}
+
+		std::unique_ptr<juce::LowLevelGraphicsContext> createLowLevelContext() override
+		{
+			/** Cached layers are never drawn into. This draws into a copy, which is thrown away. */
+			jassertfalse;
+			return clone()->createLowLevelContext();
+		}
+
+		void initialiseBitmapData(juce::Image::BitmapData& bitmap, int x, int y, juce::Image::BitmapData::ReadWriteMode mode) override
+		{
+			jassert(mode == juce::Image::BitmapData::readOnly);
+			juce::ignoreUnused(mode);
+
+			const auto offset = (size_t)x * (size_t)pixelStride + (size_t)y * (size_t)lineStride;
+
+			bitmap.data = data + offset;
+			bitmap.size = (size_t)height * (size_t)lineStride - offset;
+			bitmap.pixelFormat = pixelFormat;
+			bitmap.lineStride = lineStride;
+			bitmap.pixelStride = pixelStride;
+		}
+
+		juce::ImagePixelData::Ptr clone() override
+		{
+			juce::Image copy(pixelFormat, width, height, false, juce::SoftwareImageType());
+
+			{
+				const juce::Image::BitmapData destination(copy, juce::Image::BitmapData::writeOnly);
+
+				for (int y = 0; y < height; y++)
+					std::memcpy(destination.getLinePointer(y), data + (size_t)y * (size_t)lineStride, (size_t)lineStride);
+			}
+
+			return copy.getPixelData();
+		}
+
+		std::unique_ptr<juce::ImageType> createType() const override
+		{
+			return std::make_unique<juce::SoftwareImageType>();
+		}
+
+	private:
+		std::shared_ptr<juce::MemoryMappedFile> mappedFile;
+		juce::uint8* const data;
+		const int pixelStride;
+		const int lineStride;
+	};
+
+	/** The innermost ScopedLayerRecording of each thread. */
+	thread_local RenderCache::ScopedLayerRecording* currentLayerRecording = nullptr;
+}
+
+RenderCache::ScopedLayerRecording::ScopedLayerRecording()
+	: previous(currentLayerRecording)
+{
+	currentLayerRecording = this;
+}
+
+RenderCache::ScopedLayerRecording::~ScopedLayerRecording()
+{
+	jassert(currentLayerRecording == this);
+	currentLayerRecording = previous;
+}
+
+std::vector<std::function<void()>> RenderCache::ScopedLayerRecording::takeLayerJobs()
+{
+	return std::exchange(layerJobs, {});
+}
+
+RenderCache::ScopedLayerRecordingPause::ScopedLayerRecordingPause()
+	: paused(currentLayerRecording)
+{
+	currentLayerRecording = nullptr;
+}
+
+RenderCache::ScopedLayerRecordingPause::~ScopedLayerRecordingPause()
+{
+	jassert(currentLayerRecording == nullptr);
+	currentLayerRecording = paused;
+}
+
+bool RenderCache::isRecordingLayers()
+{
+	return currentLayerRecording != nullptr;
+}
+
+bool RenderCache::recordLayerJob(std::function<void()> layerJob)
+{
+	if (currentLayerRecording == nullptr)
+		return false;
+
+	currentLayerRecording->layerJobs.push_back(std::move(layerJob));
+	currentLayerRecording->numLayersMissed++;
+	return true;
+}
+
+juce::String RenderCache::Stats::toString() const
+{
+	juce::String text;
+	text << "Render cache: " << numLayers << " layers, "
+		<< juce::String(numBytes / 1024.0, 1) << " + " << juce::String(numAssetBytes / 1024.0, 1) << " of assets of "
+		<< juce::String(byteBudget / 1024.0, 1) << " KB, "
+		<< numMappedLayers << " mapped from disk, "
+		<< numHits << " hits, " << numMisses << " misses, " << numEvictions << " evictions, "
+		<< numStaleDraws << " stale draws";
+
+	return text;
+}
+
+RenderCache::~RenderCache()
+{
+	stopTimer();
+}
+
+juce::Image RenderCache::getImage(const Key& key, juce::Image::PixelFormat format, const std::function<void(juce::Graphics&)>& paintLayer,
+	juce::Component* control)
+{
+	/** Layers rendered on other threads, from recorded jobs, are rebuilt right away. */
+	if (control != nullptr && !juce::MessageManager::existsAndIsCurrentThread())
+		control = nullptr;
+
+	const bool countsTowardsBudget = control != nullptr;
+
+	{
+		const juce::ScopedLock sl(lock);
+
+		if (auto found = layers.find(key); found != layers.end() && checkLayer(found))
+		{
+			numHits++;
+			lruOrder.splice(lruOrder.begin(), lruOrder, found->second.lruPosition);
+			return found->second.image;
+		}
+
+		/**
+		 * A layer cached at another scale or size is drawn stretched while a window is resizing,
+		 * or once this frame has spent its rebuild budget, and rebuilt in a later frame.
+		 */
+		if (deferredRebuilds && control != nullptr)
+		{
+			JUCE_ASSERT_MESSAGE_THREAD
+
+			auto stale = findOtherScale(key);
+
+			if (stale == layers.end() || !checkLayer(stale))
+				stale = findOtherSize(key);
+
+			if (stale != layers.end() && checkLayer(stale)
+				&& (InteractionQuality::isResizeInProgress() || !hasRebuildBudget()))
+			{
+				numStaleDraws++;
+				pendingRepaints.addIfNotAlreadyThere(control);
+
+				/** The layer is on screen until it's rebuilt, so it must not be the next one evicted. */
+				lruOrder.splice(lruOrder.begin(), lruOrder, stale->second.lruPosition);
+
+				if (!isTimerRunning())
+					startTimerHz(60);
+
+				return stale->second.image;
+			}
+		}
+
+		/** A recording paint leaves the layer to a job, which renders it with the key and paint function as they are now. */
+		if (auto* recording = currentLayerRecording)
+		{
+			if (recording->recordedKeys.insert(key).second)
+				recording->layerJobs.push_back([this, key, format, paintLayer] { getImage(key, format, paintLayer); });
+
+			recording->numLayersMissed++;
+
+			return {};
+		}
+
+		numMisses++;
+	}
+
+	const double renderStartMilliseconds = juce::Time::getMillisecondCounterHiRes();
+
+	/** Painted without the lock, so other threads can use the cache meanwhile. */
+	const float scale = key.scale / 100.f;
+	const int imageWidth = juce::jmax(1, (int)std::ceil(key.width * scale));
+	const int imageHeight = juce::jmax(1, (int)std::ceil(key.height * scale));
+
+	juce::Image image(format, imageWidth, imageHeight, true);
+
+	{
+		juce::Graphics g(image);
+		g.addTransform(juce::AffineTransform::scale((float)imageWidth / juce::jmax(1, key.width),
+			(float)imageHeight / juce::jmax(1, key.height)));
+		g.setColour(juce::Colours::white);
+		paintLayer(g);
+	}
+
+	const juce::ScopedLock sl(lock);
+
+	if (countsTowardsBudget)
+		rebuildMillisecondsThisFrame += juce::Time::getMillisecondCounterHiRes() - renderStartMilliseconds;
+
+	/** Another thread may have rendered the same layer meanwhile: keep the first one. */
+	if (auto found = layers.find(key); found != layers.end())
+		return found->second.image;
+
+	lruOrder.push_front(key);
+	latestSizes[getSizeAgnosticKey(key)] = key;
+	unsavedLayers = true;
+
+	Entry entry;
+	entry.image = image;
+	entry.numBytes = getImageBytes(image);
+	entry.lruPosition = lruOrder.begin();
+
+	numBytes += entry.numBytes;
+	layers.emplace(key, std::move(entry));
+
+	evictToBudget();
+
+	return image;
+}
+
+bool RenderCache::contains(const Key& key) const
+{
+	const juce::ScopedLock sl(lock);
+	return layers.find(key) != layers.end();
+}
+
+void RenderCache::setByteBudget(size_t newByteBudget)
+{
+	const juce::ScopedLock sl(lock);
+	byteBudget = newByteBudget;
+	evictToBudget();
+}
+
+size_t RenderCache::getByteBudget() const
+{
+	const juce::ScopedLock sl(lock);
+	return byteBudget;
+}
+
+void RenderCache::setDeferredRebuilds(bool shouldDeferRebuilds)
+{
+	const juce::ScopedLock sl(lock);
+	deferredRebuilds = shouldDeferRebuilds;
+}
+
+void RenderCache::setRebuildBudget(double milliseconds)
+{
+	const juce::ScopedLock sl(lock);
+	rebuildBudgetMilliseconds = juce::jmax(0.0, milliseconds);
+}
+
+double RenderCache::getRebuildBudget() const
+{
+	const juce::ScopedLock sl(lock);
+	return rebuildBudgetMilliseconds;
+}
+
+void RenderCache::beginFrame()
+{
+	const juce::ScopedLock sl(lock);
+	frameStartMilliseconds = juce::Time::getMillisecondCounterHiRes();
+	lastBeginFrameMilliseconds = frameStartMilliseconds;
+	rebuildMillisecondsThisFrame = 0.0;
+}
+
+void RenderCache::addRebuildTime(double milliseconds)
+{
+	const juce::ScopedLock sl(lock);
+	rebuildMillisecondsThisFrame += milliseconds;
+}
+
+void RenderCache::clear()
+{
+	const juce::ScopedLock sl(lock);
+	layers.clear();
+	lruOrder.clear();
+	latestSizes.clear();
+	numBytes = 0;
+	pendingRepaints.clear();
+}
+
+int RenderCache::getNumLayers() const
+{
+	const juce::ScopedLock sl(lock);
+	return (int)layers.size();
+}
+
+size_t RenderCache::getNumBytes() const
+{
+	const juce::ScopedLock sl(lock);
+	return numBytes;
+}
+
+void RenderCache::setAssetBytes(const void* owner, size_t numBytesOfOwner)
+{
+	const juce::ScopedLock sl(lock);
+
+	if (numBytesOfOwner == 0)
+		assetBytes.erase(owner);
+	else
+		assetBytes[owner] = numBytesOfOwner;
+
+	numAssetBytes = 0;
+
+	for (const auto& asset : assetBytes)
+		numAssetBytes += asset.second;
+
+	evictToBudget();
+}
+
+RenderCache::Stats RenderCache::getStats() const
+{
+	const juce::ScopedLock sl(lock);
+
+	Stats stats;
+	stats.numHits = numHits;
+	stats.numMisses = numMisses;
+	stats.numEvictions = numEvictions;
+	stats.numStaleDraws = numStaleDraws;
+	stats.numLayers = (int)layers.size();
+
+	for (const auto& layer : layers)
+		if (layer.second.sourceFile != juce::File())
+			stats.numMappedLayers++;
+
+	stats.numBytes = numBytes;
+	stats.numAssetBytes = numAssetBytes;
+	stats.byteBudget = byteBudget;
+
+	return stats;
+}
+
+void RenderCache::resetStats()
+{
+	const juce::ScopedLock sl(lock);
+	numHits = 0;
+	numMisses = 0;
+	numEvictions = 0;
+	numStaleDraws = 0;
+}
+
+juce::File RenderCache::getDefaultFile()
+{
+	auto directory = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory);
+
+   #if JUCE_MAC
+	directory = directory.getChildFile("Caches");
+   #endif
+
+	return directory.getChildFile(ProjectInfo::projectName).getChildFile("RenderCache.bin");
+}
+
+bool RenderCache::saveToFile(const juce::File& file)
+{
+	const auto theme = Theme::getCurrent();
+
+	/** Images don't change once cached, so they're written without the lock. */
+	std::vector<std::pair<Key, juce::Image>> layersToSave;
+
+	{
+		const juce::ScopedLock sl(lock);
+
+		for (auto it = layers.begin(); it != layers.end();)
+		{
+			const auto layer = it++;
+			const auto format = layer->second.image.getFormat();
+
+			if (format != juce::Image::ARGB && format != juce::Image::SingleChannel)
+				continue;
+
+			/** Layers mapped from the last file and never used are checked now, so damage isn't saved with a new checksum. */
+			if (!checkLayer(layer))
+				continue;
+
+			if (layer->first.themeVersion == 0 || layer->first.themeVersion == theme->getVersion())
+				layersToSave.emplace_back(layer->first, layer->second.image);
+		}
+	}
+
+	if (!file.getParentDirectory().createDirectory())
+		return false;
+
+	const juce::TemporaryFile temporaryFile(file);
+
+	{
+		juce::FileOutputStream stream(temporaryFile.getFile());
+
+		if (!stream.openedOk())
+			return false;
+
+		/** The pixels go after the table, so the table is built first, with their offsets. */
+		juce::MemoryOutputStream table;
+		juce::Array<juce::MemoryBlock> pixels;
+		juce::int64 dataOffset = headerSize + (juce::int64)layersToSave.size() * layerRecordSize;
+
+		for (const auto& [key, image] : layersToSave)
+		{
+			const juce::Image::BitmapData bitmap(image, juce::Image::BitmapData::readOnly);
+			const int rowBytes = bitmap.width * getPixelStride(image.getFormat());
+
+			juce::MemoryBlock block((size_t)rowBytes * (size_t)bitmap.height);
+
+			for (int y = 0; y < bitmap.height; y++)
+				std::memcpy(static_cast<juce::uint8*>(block.getData()) + (size_t)y * (size_t)rowBytes,
+					bitmap.getLinePointer(y), (size_t)rowBytes);
+
+			dataOffset = (dataOffset + dataAlignment - 1) / dataAlignment * dataAlignment;
+
+			table.writeInt((int)key.controlType);
+			table.writeInt(key.layer);
+			table.writeInt(key.width);
+			table.writeInt(key.height);
+			table.writeInt(key.scale);
+			table.writeInt(key.themeVersion != 0 ? 1 : 0);
+			table.writeInt64(key.variant);
+			table.writeInt((int)image.getFormat());
+			table.writeInt(bitmap.width);
+			table.writeInt(bitmap.height);
+			table.writeInt(0);
+			table.writeInt64(dataOffset);
+			table.writeInt64((juce::int64)block.getSize());
+			table.writeInt64((juce::int64)getChecksum(static_cast<const juce::uint8*>(block.getData()), block.getSize()));
+
+			dataOffset += (juce::int64)block.getSize();
+			pixels.add(std::move(block));
+		}
+
+		const auto referencePixel = getReferencePixel();
+
+		stream.write(fileMagic, 4);
+		stream.writeInt(fileFormatVersion);
+		stream.writeInt64((juce::int64)getAppVersionHash());
+		stream.writeInt64((juce::int64)theme->getColoursHash());
+		stream.write(referencePixel.data(), referencePixel.size());
+		stream.writeInt((int)layersToSave.size());
+		stream.writeInt64((juce::int64)getChecksum(static_cast<const juce::uint8*>(table.getData()), table.getDataSize()));
+		stream.write(table.getData(), table.getDataSize());
+
+		for (const auto& block : pixels)
+		{
+			while (stream.getPosition() % dataAlignment != 0)
+				stream.writeByte(0);
+
+			stream.write(block.getData(), block.getSize());
+		}
+
+		stream.flush();
+
+		if (stream.getStatus().failed())
+			return false;
+	}
+
+	layersToSave.clear();
+
+	{
+		const juce::ScopedLock sl(lock);
+
+		for (auto it = layers.begin(); it != layers.end();)
+		{
+			const auto next = std::next(it);
+
+			if (it->second.sourceFile == file)
+				removeLayer(it);
+
+			it = next;
+		}
+
+		unsavedLayers = false;
+	}
+
+	return temporaryFile.overwriteTargetFileWithTemporary();
+}
+
+int RenderCache::loadFromFile(const juce::File& file)
+{
+	if (!file.existsAsFile())
+		return 0;
+
+	auto mappedFile = std::make_shared<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+	const auto* fileData = static_cast<const juce::uint8*>(mappedFile->getData());
+	const auto fileSize = (juce::int64)mappedFile->getSize();
+
+	if (fileData == nullptr || fileSize < headerSize)
+		return 0;
+
+	juce::MemoryInputStream header(fileData, (size_t)headerSize, false);
+
+	char magic[4];
+	header.read(magic, 4);
+
+	const int formatVersion = header.readInt();
+	const auto appVersionHash = (juce::uint64)header.readInt64();
+	const auto themeHash = (juce::uint64)header.readInt64();
+
+	std::array<juce::uint8, 4> referencePixel;
+	header.read(referencePixel.data(), (int)referencePixel.size());
+
+	const int numLayers = header.readInt();
+	const auto tableChecksum = (juce::uint64)header.readInt64();
+
+	if (std::memcmp(magic, fileMagic, 4) != 0 || formatVersion != fileFormatVersion
+		|| appVersionHash != getAppVersionHash() || referencePixel != getReferencePixel()
+		|| numLayers < 0 || headerSize + (juce::int64)numLayers * layerRecordSize > fileSize)
+		return 0;
+
+	const auto* tableData = fileData + headerSize;
+	const auto tableSize = (size_t)numLayers * (size_t)layerRecordSize;
+
+	if (getChecksum(tableData, tableSize) != tableChecksum)
+		return 0;
+
+	/** Layers that bake colours in are only valid with the colours they were rendered with. */
+	const auto theme = Theme::getCurrent();
+	const bool sameThemeColours = themeHash == theme->getColoursHash();
+
+	juce::MemoryInputStream table(tableData, tableSize, false);
+
+	/** The pixels aren't read here: each layer is checked against its checksum when it's first used. */
+	struct LoadedLayer
+	{
+		Key key;
+		juce::Image image;
+		juce::uint64 checksum;
+	};
+
+	std::vector<LoadedLayer> loadedLayers;
+
+	for (int i = 0; i < numLayers; i++)
+	{
+		Key key;
+		key.controlType = (ControlType)table.readInt();
+		key.layer = table.readInt();
+		key.width = table.readInt();
+		key.height = table.readInt();
+		key.scale = table.readInt();
+		const bool bakesThemeIn = table.readInt() != 0;
+		key.variant = table.readInt64();
+
+		const auto format = (juce::Image::PixelFormat)table.readInt();
+		const int imageWidth = table.readInt();
+		const int imageHeight = table.readInt();
+		table.readInt();
+
+		const auto dataOffset = table.readInt64();
+		const auto dataSize = table.readInt64();
+		const auto checksum = (juce::uint64)table.readInt64();
+
+		if (bakesThemeIn && !sameThemeColours)
+			continue;
+
+		key.themeVersion = bakesThemeIn ? theme->getVersion() : 0;
+
+		if ((format != juce::Image::ARGB && format != juce::Image::SingleChannel) || imageWidth <= 0 || imageHeight <= 0
+			|| dataSize != (juce::int64)imageWidth * imageHeight * getPixelStride(format)
+			|| dataOffset < headerSize || dataOffset + dataSize > fileSize)
+			continue;
+
+		loadedLayers.push_back({ key, juce::Image(juce::ImagePixelData::Ptr(
+			new MappedPixelData(format, imageWidth, imageHeight, mappedFile, fileData + dataOffset))), checksum });
+	}
+
+	const juce::ScopedLock sl(lock);
+
+	int numLoaded = 0;
+
+	/** Behind every layer used so far, so that they're evicted first. */
+	for (auto& loaded : loadedLayers)
+	{
+		const auto& key = loaded.key;
+
+		if (layers.find(key) != layers.end())
+			continue;
+
+		lruOrder.push_back(key);
+		latestSizes.emplace(getSizeAgnosticKey(key), key);
+
+		Entry entry;
+		entry.image = loaded.image;
+		entry.numBytes = getImageBytes(loaded.image);
+		entry.lruPosition = std::prev(lruOrder.end());
+		entry.sourceFile = file;
+		entry.fileChecksum = loaded.checksum;
+		entry.needsChecksum = true;
+
+		numBytes += entry.numBytes;
+		layers.emplace(key, std::move(entry));
+		numLoaded++;
+	}
+
+	evictToBudget();
+
+	return numLoaded;
+}
+
+bool RenderCache::hasUnsavedLayers() const
+{
+	const juce::ScopedLock sl(lock);
+	return unsavedLayers;
+}
+
+size_t RenderCache::getImageBytes(const juce::Image& image)
+{
+	const juce::Image::BitmapData bitmap(image, juce::Image::BitmapData::readOnly);
+	return (size_t)bitmap.lineStride * (size_t)bitmap.height;
+}
+
+void RenderCache::evictToBudget()
+{
+	/** The most recently used layer is always kept, even if it is larger than the budget on its own. */
+	while (numBytes + numAssetBytes > byteBudget && lruOrder.size() > 1)
+	{
+		const auto found = layers.find(lruOrder.back());
+		jassert(found != layers.end());
+
+		removeLayer(found);
+		numEvictions++;
+	}
+}
+
+void RenderCache::removeLayer(std::map<Key, Entry>::iterator layer)
+{
+	numBytes -= layer->second.numBytes;
+
+	if (auto latest = latestSizes.find(getSizeAgnosticKey(layer->first));
+		latest != latestSizes.end() && !(latest->second < layer->first) && !(layer->first < latest->second))
+		latestSizes.erase(latest);
+
+	lruOrder.erase(layer->second.lruPosition);
+	layers.erase(layer);
+}
+
+bool RenderCache::checkLayer(std::map<Key, Entry>::iterator layer)
+{
+	auto& entry = layer->second;
+
+	if (!entry.needsChecksum)
+		return true;
+
+	/** The mapped pixels are rows packed one after the other, as they were saved. */
+	{
+		const juce::Image::BitmapData bitmap(entry.image, juce::Image::BitmapData::readOnly);
+
+		if (getChecksum(bitmap.getLinePointer(0), (size_t)bitmap.lineStride * (size_t)bitmap.height) == entry.fileChecksum)
+		{
+			entry.needsChecksum = false;
+			return true;
+		}
+	}
+
+	removeLayer(layer);
+	return false;
+}
+
+std::map<RenderCache::Key, RenderCache::Entry>::iterator RenderCache::findOtherScale(const Key& key)
+{
+	/** Keys are ordered by scale right after the size, so every scale of a layer size is in one range. */
+	auto first = key;
+	first.scale = std::numeric_limits<int>::min();
+	first.themeVersion = 0;
+	first.variant = std::numeric_limits<juce::int64>::min();
+
+	auto nearest = layers.end();
+	int nearestDistance = std::numeric_limits<int>::max();
+
+	for (auto it = layers.lower_bound(first); it != layers.end(); ++it)
+	{
+		const auto& other = it->first;
+
+		if (other.controlType != key.controlType || other.layer != key.layer
+			|| other.width != key.width || other.height != key.height)
+			break;
+
+		if (other.themeVersion != key.themeVersion || other.variant != key.variant)
+			continue;
+
+		/** Prefer higher scales, which look better scaled down than lower ones scaled up. */
+		const int distance = std::abs(other.scale - key.scale) * 2 + (other.scale < key.scale ? 1 : 0);
+
+		if (distance < nearestDistance)
+		{
+			nearest = it;
+			nearestDistance = distance;
+		}
+	}
+
+	return nearest;
+}
+
+std::map<RenderCache::Key, RenderCache::Entry>::iterator RenderCache::findOtherSize(const Key& key)
+{
+	const auto latest = latestSizes.find(getSizeAgnosticKey(key));
+
+	if (latest == latestSizes.end())
+		return layers.end();
+
+	return layers.find(latest->second);
+}
+
+RenderCache::Key RenderCache::getSizeAgnosticKey(const Key& key)
+{
+	/** Layers of a control in the other orientation would look wrong stretched, so those are kept apart. */
+	auto sizeAgnosticKey = key;
+	sizeAgnosticKey.width = key.width > key.height ? 1 : 0;
+	sizeAgnosticKey.height = 0;
+	sizeAgnosticKey.scale = 0;
+
+	return sizeAgnosticKey;
+}
+
+bool RenderCache::hasRebuildBudget()
+{
+	const double now = juce::Time::getMillisecondCounterHiRes();
+
+	/** The frames are the vblanks while there are any; a fixed frame length only stands in without them. */
+	if (now - lastBeginFrameMilliseconds >= vBlankTimeoutMilliseconds && now - frameStartMilliseconds >= frameMilliseconds)
+	{
+		frameStartMilliseconds = now;
+		rebuildMillisecondsThisFrame = 0.0;
+	}
+
+	return rebuildMillisecondsThisFrame < rebuildBudgetMilliseconds;
+}
+
+void RenderCache::timerCallback()
+{
+	/** Nothing is rebuilt until the size has settled: InteractionQuality repaints everything then. */
+	if (InteractionQuality::isResizeInProgress())
+		return;
+
+	juce::Array<juce::Component::SafePointer<juce::Component>> controlsToRepaint;
+
+	{
+		const juce::ScopedLock sl(lock);
+
+		if (pendingRepaints.isEmpty())
+		{
+			stopTimer();
+			return;
+		}
+
+		controlsToRepaint.swapWith(pendingRepaints);
+	}
+
+	/** Repainted as an area, so that repaint filters that compare visual states don't skip it. */
+	for (auto& control : controlsToRepaint)
+	{
+		if (control != nullptr)
+			control->repaint(control->getLocalBounds());
+	}
+}
@@ -0,0 +1,408 @@
+/*
+  ==============================================================================
+
+    RenderCache.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Components/ControlType.h"
+
+/**
+ * Process-wide cache of pre-rendered layers of the custom controls.
+ *
+ * Every LookAndFeel and control uses the same instance through
+ * juce::SharedResourcePointer<RenderCache>, so plugin instances loaded in the
+ * same process share their layers. Layers are content-addressed: two controls
+ * asking for the same layer type, geometry, scale and theme get the same image.
+ *
+ * Single-colour layers (outlines, grading ticks and labels, shadows, glyphs) are
+ * stored as SingleChannel alpha masks and tinted with their colour when drawn, so
+ * they take a quarter of the memory of an ARGB image and colour changes don't
+ * invalidate them. Other layers are stored as ARGB images.
+ * Layers are rendered at the physical pixel scale of the context they are drawn into,
+ * rounded up to a multiple of 0.25 so that fractional scales don't each get their own layers.
+ *
+ * When a control moves to a display with another scale, or is resized, its layers are
+ * drawn stretched from the nearest scale or the last size that is cached, and rebuilt
+ * within a time budget per frame afterwards, so that moving a window between monitors
+ * doesn't stall a frame. While a window is being live-resized (see InteractionQuality)
+ * nothing is rebuilt: the layers are only stretched until the size has settled.
+ *
+ * The cache is thread-safe. When its byte budget is exceeded the least recently
+ * used layers are evicted.
+ *
+ * Components are only painted on the message thread. To render layers on other threads, a paint
+ * can record the layers it misses instead of rendering them (see ScopedLayerRecording), and the
+ * recorded jobs, which only run the layers' paint functions, are then run on the RenderThreadPool.
+ *
+ * The layers can be saved to a file and mapped back into memory in the next run
+ * (saveToFile() and loadFromFile()), so that a warm start renders nothing.
+ */
+class RenderCache : private juce::Timer
+{
+public:
+	/** Identifies a cached layer by its content. */
+	struct Key
+	{
+		/** The control the layer belongs to. */
+		ControlType controlType = ControlType::mixingConsoleFader;
+		/** Layer id, defined by each LookAndFeel. */
+		int layer = 0;
+		/** Logical size of the layer. */
+		int width = 0;
+		int height = 0;
+		/** Physical pixel scale, in hundredths, rounded up to a multiple of scaleStep. */
+		int scale = 100;
+		/** Version of the theme the layer was rendered with, for layers that bake colours in. */
+		juce::uint32 themeVersion = 0;
+		/** Anything else the layer depends on (orientation, angles...). */
+		juce::int64 variant = 0;
+
+		bool operator<(const Key& other) const
+		{
+			return std::tie(controlType, layer, width, height, scale, themeVersion, variant)
+				< std::tie(other.controlType, other.layer, other.width, other.height, other.scale, other.themeVersion, other.variant);
+		}
+	};
+
+	/** Cache counters. */
+	struct Stats
+	{
+		juce::int64 numHits = 0;
+		juce::int64 numMisses = 0;
+		juce::int64 numEvictions = 0;
+		/** Layers drawn stretched from another scale or size while they waited to be rebuilt. */
+		juce::int64 numStaleDraws = 0;
+		int numLayers = 0;
+		/** Layers read straight from a memory mapped file (see loadFromFile()). */
+		int numMappedLayers = 0;
+		size_t numBytes = 0;
+		/** Memory the layers are drawn from that is held outside the cache (see setAssetBytes()). */
+		size_t numAssetBytes = 0;
+		size_t byteBudget = 0;
+
+		juce::String toString() const;
+	};
+
+	/** Default byte budget. */
+	static constexpr size_t defaultByteBudget = 32 * 1024 * 1024;
+
+	/** Scales are rounded up to multiples of this, in hundredths. */
+	static constexpr int scaleStep = 25;
+
+	/** Default time per frame that may be spent rebuilding layers that could be drawn stretched instead. */
+	static constexpr double defaultRebuildBudgetMilliseconds = 4.0;
+
+	/**
+	 * A frame is assumed to end this long after it began when nothing calls beginFrame(), i.e. when no
+	 * RepaintScheduler has had a vblank for vBlankTimeoutMilliseconds (no scheduler, or no display).
+	 */
+	static constexpr double frameMilliseconds = 1000.0 / 60.0;
+	static constexpr double vBlankTimeoutMilliseconds = 100.0;
+
+	/**
+	 * While one exists, paints on the thread that created it record the layers missing from the cache
+	 * instead of rendering them: getImage() returns a null image for those, which draws nothing, and a
+	 * job that renders the layer into the cache is recorded. Layers that would be drawn stretched
+	 * (see getImage()) are still drawn stretched. Delete it before running the jobs on the same thread.
+	 */
+	class ScopedLayerRecording
+	{
+	public:
+		ScopedLayerRecording();
+		~ScopedLayerRecording();
+
+		/**
+		 * Returns the jobs recorded since the last call and forgets them. They may be run on any thread, in any order.
+		 * Layers of this cache recorded before aren't recorded again.
+		 */
+		std::vector<std::function<void()>> takeLayerJobs();
+
+		/** Number of times a paint was left without a layer, counting layers recorded before again. */
+		int getNumLayersMissed() const { return numLayersMissed; }
+
+	private:
+		friend class RenderCache;
+
+		std::vector<std::function<void()>> layerJobs;
+		int numLayersMissed = 0;
+		/** Layers of this cache already recorded, so that each is rendered once. */
+		std::set<Key> recordedKeys;
+		ScopedLayerRecording* const previous;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedLayerRecording)
+	};
+
+	/**
+	 * While one exists, the ScopedLayerRecording of the thread that created it is suspended, so that paints
+	 * render the layers they miss as usual: for images kept beyond the paint, which mustn't miss any.
+	 */
+	class ScopedLayerRecordingPause
+	{
+	public:
+		ScopedLayerRecordingPause();
+		~ScopedLayerRecordingPause();
+
+	private:
+		ScopedLayerRecording* const paused;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedLayerRecordingPause)
+	};
+
+	/** True while a ScopedLayerRecording exists on the calling thread, and isn't paused. */
+	static bool isRecordingLayers();
+
+	/**
+	 * For other caches of pre-rendered images, like DigitGlyphAtlas: records a job that renders what
+	 * a paint is missing, if a ScopedLayerRecording exists on the calling thread.
+	 *
+	 * \return True if the job was recorded, in which case the paint should skip what it's missing.
+	 */
+	static bool recordLayerJob(std::function<void()> layerJob);
+
+	/** Version of the layout of the files written by saveToFile(). */
+	static constexpr int fileFormatVersion = 1;
+
+	/**
+	 * Version of the code that draws the cached layers. Saved layers are only loaded by a build with
+	 * the same one, so bump it with every change that makes any layer look different.
+	 */
+	static constexpr int renderCodeVersion = 1;
+
+	RenderCache() = default;
+	~RenderCache() override;
+
+	/** Returns a physical pixel scale in hundredths, rounded up to a multiple of scaleStep. */
+	static int quantiseScale(float physicalPixelScale)
+	{
+		const int hundredths = juce::jmax(scaleStep, juce::roundToInt(physicalPixelScale * 100.f));
+		return (hundredths + scaleStep - 1) / scaleStep * scaleStep;
+	}
+
+	/** Creates a key for a layer of the given logical size, drawn into the given context. */
+	static Key makeKey(ControlType controlType, int layer, int width, int height, juce::Graphics& g, juce::int64 variant = 0)
+	{
+		Key key;
+		key.controlType = controlType;
+		key.layer = layer;
+		key.width = width;
+		key.height = height;
+		key.scale = quantiseScale(g.getInternalContext().getPhysicalPixelScaleFactor());
+		key.variant = variant;
+
+		return key;
+	}
+
+	/**
+	 * Returns the alpha mask of a layer, rendering it first if it isn't cached.
+	 *
+	 * \param key The layer. Its width and height are the logical size of the mask.
+	 * \param paintLayer Paints the layer in logical coordinates, from (0, 0) to (width, height).
+	 * Only the alpha of what is painted is kept, so it should be painted with opaque colours.
+	 * \param control The control being painted, if any. See getImage().
+	 */
+	juce::Image getMask(const Key& key, const std::function<void(juce::Graphics&)>& paintLayer, juce::Component* control = nullptr)
+	{
+		return getImage(key, juce::Image::SingleChannel, paintLayer, control);
+	}
+
+	/**
+	 * Returns the image of a layer, rendering it first if it isn't cached.
+	 * May be called from any thread; the layer is painted on the calling thread.
+	 *
+	 * \param key The layer. Its width and height are the logical size of the image.
+	 * \param format SingleChannel for masks, ARGB for layers with colours baked in (put the theme version in the key).
+	 * \param paintLayer Paints the layer in logical coordinates, from (0, 0) to (width, height).
+	 * \param control The control being painted, on the message thread. If it's given, the layer is cached at
+	 * another scale or size, and a window is resizing or the rebuild budget of the frame is spent, that layer
+	 * is returned instead and the control is repainted once the layer can be rebuilt. Ignored on other threads.
+	 * \return The layer, or a null image if it's missing and is being recorded (see ScopedLayerRecording).
+	 */
+	juce::Image getImage(const Key& key, juce::Image::PixelFormat format, const std::function<void(juce::Graphics&)>& paintLayer,
+		juce::Component* control = nullptr);
+
+	/** True if the layer is cached. Doesn't count as a use. */
+	bool contains(const Key& key) const;
+
+	/** Fills the area with the colour, using the mask as its alpha channel. */
+	static void drawMask(juce::Graphics& g, const juce::Image& mask, juce::Rectangle<float> area, juce::Colour colour)
+	{
+		g.setColour(colour);
+		g.drawImage(mask, area, juce::RectanglePlacement::stretchToFit, true);
+	}
+
+	/** Fills the mask with the colour, transformed from its logical coordinates (0, 0) to (width, height). */
+	static void drawMaskTransformed(juce::Graphics& g, const juce::Image& mask, int width, int height,
+		const juce::AffineTransform& transform, juce::Colour colour)
+	{
+		g.setColour(colour);
+		g.drawImageTransformed(mask,
+			juce::AffineTransform::scale((float)width / mask.getWidth(), (float)height / mask.getHeight()).followedBy(transform),
+			true);
+	}
+
+	/**
+	 * Sets the memory the cached layers and the assets may use together (see setAssetBytes()).
+	 * Least recently used layers are evicted to stay within it.
+	 */
+	void setByteBudget(size_t newByteBudget);
+
+	size_t getByteBudget() const;
+
+	/** Draws layers from another scale or size while they wait to be rebuilt (the default), or rebuilds them right away. */
+	void setDeferredRebuilds(bool shouldDeferRebuilds);
+
+	/** Sets the time per frame that may be spent rebuilding layers that could be drawn stretched instead. */
+	void setRebuildBudget(double milliseconds);
+
+	double getRebuildBudget() const;
+
+	/** Starts a new frame: the full rebuild budget is available again. Called at every vblank by RepaintScheduler. */
+	void beginFrame();
+
+	/** Counts time spent rendering recorded layers on other threads against the rebuild budget of the frame. */
+	void addRebuildTime(double milliseconds);
+
+	/** Removes every cached layer. */
+	void clear();
+
+	/** Number of cached layers. */
+	int getNumLayers() const;
+
+	/** Memory used by the cached layers, in bytes. */
+	size_t getNumBytes() const;
+
+	/**
+	 * Counts memory that layers are rendered from, such as a decoded texture, in the stats and
+	 * against the byte budget. Layers are evicted if the assets leave too little of the budget.
+	 *
+	 * \param owner Whatever holds the memory. A later call from the same owner replaces its count,
+	 * and a count of 0 removes it.
+	 */
+	void setAssetBytes(const void* owner, size_t numBytesOfOwner);
+
+	/** Returns the counters. */
+	Stats getStats() const;
+
+	/** Returns the file the app keeps its layers in between runs. */
+	static juce::File getDefaultFile();
+
+	/**
+	 * Writes every cached layer to a file, for loadFromFile() in a later run.
+	 *
+	 * The pixels are written as they are in memory, together with the version of the file format
+	 * and of the drawing code (renderCodeVersion) and a hash of the current theme's colours. Layers with
+	 * colours baked in are only written if they were rendered with the current theme. The new file is
+	 * written next to the old one and then replaces it; layers mapped from the old one are dropped from
+	 * the cache first, as a file that is mapped can't be replaced everywhere. Save at shutdown, before
+	 * the controls are deleted: they hold the shared cache, which goes with the last of them.
+	 *
+	 * \return True if the file was written.
+	 */
+	bool saveToFile(const juce::File& file);
+
+	/**
+	 * Adds the layers saved in a file by saveToFile() to the cache, without rendering or copying them:
+	 * the file is memory mapped and the layers' images read their pixels from it. Nothing is loaded from
+	 * files of another format, drawing code version or pixel layout, or if their table of layers is
+	 * damaged. The pixels of a layer are only read, and checked against their checksum, when the layer is
+	 * first used: damaged layers are dropped then and rendered again. Layers with colours baked in are
+	 * only loaded if the current theme has the colours they were saved with. Layers already cached are kept.
+	 *
+	 * \return The number of layers loaded.
+	 */
+	int loadFromFile(const juce::File& file);
+
+	/** True if layers were rendered since the last saveToFile(). */
+	bool hasUnsavedLayers() const;
+
+	/** Resets the hit, miss and eviction counters. */
+	void resetStats();
+
+private:
+	/** A cached layer and its place in the least recently used order. */
+	struct Entry
+	{
+		juce::Image image;
+		size_t numBytes = 0;
+		std::list<Key>::iterator lruPosition;
+		/** The file the layer is mapped from, if it was loaded from one. */
+		juce::File sourceFile;
+		/** The checksum saved with a layer from a file, until its pixels have been checked against it. */
+		juce::uint64 fileChecksum = 0;
+		bool needsChecksum = false;
+	};
+
+	/** Returns the memory used by an image. */
+	static size_t getImageBytes(const juce::Image& image);
+
+	/** Evicts least recently used layers until the cache is within its budget. Called with the lock held. */
+	void evictToBudget();
+
+	/** Removes a layer. Called with the lock held. */
+	void removeLayer(std::map<Key, Entry>::iterator layer);
+
+	/**
+	 * Checks the pixels of a layer loaded from a file against its checksum, the first time it's used,
+	 * and removes it if they don't match. Called with the lock held.
+	 *
+	 * \return False if the layer was damaged, and removed.
+	 */
+	bool checkLayer(std::map<Key, Entry>::iterator layer);
+
+	/** Returns the cached layer nearest to the key's scale that is otherwise the same, or layers.end(). Called with the lock held. */
+	std::map<Key, Entry>::iterator findOtherScale(const Key& key);
+
+	/** Returns the layer last cached at another size that is otherwise the same, or layers.end(). Called with the lock held. */
+	std::map<Key, Entry>::iterator findOtherSize(const Key& key);
+
+	/** Returns the key with its size and scale left out, and only whether it's wider than high kept. */
+	static Key getSizeAgnosticKey(const Key& key);
+
+	/** True if there is time left in the frame to rebuild a layer. Called with the lock held. */
+	bool hasRebuildBudget();
+
+	/** Repaints the controls whose layers were drawn stretched, unless a window is still resizing. */
+	void timerCallback() override;
+
+	mutable juce::CriticalSection lock;
+
+	std::map<Key, Entry> layers;
+	/** Keys from most to least recently used. */
+	std::list<Key> lruOrder;
+	/** The last key cached for each size agnostic key. */
+	std::map<Key, Key> latestSizes;
+
+	size_t numBytes = 0;
+	size_t byteBudget = defaultByteBudget;
+
+	/** Memory held outside the cache, by owner. */
+	std::map<const void*, size_t> assetBytes;
+	size_t numAssetBytes = 0;
+
+	juce::int64 numHits = 0;
+	juce::int64 numMisses = 0;
+	juce::int64 numEvictions = 0;
+	juce::int64 numStaleDraws = 0;
+
+	/** Set when a layer is rendered, cleared when the cache is saved. */
+	bool unsavedLayers = false;
+
+	bool deferredRebuilds = true;
+	double rebuildBudgetMilliseconds = defaultRebuildBudgetMilliseconds;
+	double frameStartMilliseconds = 0.0;
+	/** When beginFrame() was last called. */
+	double lastBeginFrameMilliseconds = 0.0;
+	double rebuildMillisecondsThisFrame = 0.0;
+
+	/** Controls that drew stretched layers, to be repainted once their layers can be rebuilt. */
+	juce::Array<juce::Component::SafePointer<juce::Component>> pendingRepaints;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderCache)
+};
@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    RenderThreadPool.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "RenderThreadPool.h"
+
+RenderThreadPool::RenderThreadPool()
+	: numWorkers(juce::jlimit(1, 7, juce::SystemStats::getNumCpus() - 1)),
+	pool(numWorkers)
+{
+}
+
+RenderThreadPool::~RenderThreadPool()
+{
+	pool.removeAllJobs(true, 1000);
+}
+
+void RenderThreadPool::parallelFor(int numItems, const std::function<void(int)>& function, int maxThreads)
+{
+	if (numItems <= 0)
+		return;
+
+	if (numItems == 1 || maxThreads == 1 || busy.exchange(true))
+	{
+		for (int item = 0; item < numItems; item++)
+			function(item);
+
+		return;
+	}
+
+	/** Items are handed out one at a time, so threads that finish early take over the rest. */
+	const int numJobs = juce::jmin(maxThreads > 0 ? maxThreads - 1 : numWorkers, numWorkers, numItems - 1);
+
+	std::atomic<int> nextItem { 0 };
+	/** The jobs use this function's locals, so it only returns once every job has finished, not just every item. */
+	std::atomic<int> numThreadsLeft { numJobs + 1 };
+	juce::WaitableEvent allDone;
+
+	auto work = [&]
+	{
+		for (int item = nextItem++; item < numItems; item = nextItem++)
+			function(item);
+
+		if (--numThreadsLeft == 0)
+			allDone.signal();
+	};
+
+	for (int i = 0; i < numJobs; i++)
+		pool.addJob(work);
+
+	work();
+	allDone.wait();
+
+	busy = false;
+}
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    RenderThreadPool.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Worker threads for splitting a render across cores.
+ *
+ * Process-wide: use it through juce::SharedResourcePointer<RenderThreadPool>, so that every
+ * control shares the same threads instead of each starting its own.
+ */
+class RenderThreadPool
+{
+public:
+	RenderThreadPool();
+	~RenderThreadPool();
+
+	/**
+	 * Calls function(index) for every index from 0 to numItems - 1, on the worker threads and the
+	 * calling thread, and returns once all of them are done. The calls may run in any order and
+	 * at the same time, so they must only write to what belongs to their own index.
+	 *
+	 * Only one call at a time is split across the workers. Calls made meanwhile, from its items or
+	 * from other threads, run their items on the calling thread: waiting for workers that are busy
+	 * with the items of the call they're nested in would never end.
+	 *
+	 * \param maxThreads The most threads to use, including the calling thread, or 0 for all of them.
+	 */
+	void parallelFor(int numItems, const std::function<void(int)>& function, int maxThreads = 0);
+
+	/** Number of threads the items are split across, including the calling thread. */
+	int getNumThreads() const { return numWorkers + 1; }
+
+private:
+	const int numWorkers;
+	juce::ThreadPool pool;
+
+	/** Set while a call is using the workers. */
+	std::atomic<bool> busy { false };
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderThreadPool)
+};
@@ -0,0 +1,304 @@
+/*
+  ==============================================================================
+
+    RepaintScheduler.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "RepaintScheduler.h"
+#include "InteractionQuality.h"
+#include "Theme.h"
+
+/**
+ * Installed as the cached image of a scheduled control.
+ * Holds its repaint requests back until the scheduler flushes them.
+ */
+class RepaintScheduler::ControlHook : public juce::CachedComponentImage,
+	private juce::ComponentListener
+{
+public:
+	ControlHook(RepaintScheduler& ownerScheduler, juce::Component& controlToHook, VisualStateFunction visualStateFunction)
+		: scheduler(ownerScheduler),
+		control(controlToHook),
+		getVisualState(std::move(visualStateFunction))
+	{
+		/** No state is recorded yet: the first whole control repaint is always passed on. */
+		control.addComponentListener(this);
+	}
+
+	~ControlHook() override
+	{
+		if (listening)
+			control.removeComponentListener(this);
+	}
+
+	/** Passes the pending repaints on to the control's parent, unless they would paint the same thing. */
+	void flush()
+	{
+		if (!wholeControlDirty && partsDirty.isEmpty())
+			return;
+
+		juce::RectangleList<int> region(partsDirty);
+
+		if (wholeControlDirty)
+		{
+			if (hasVisualStateChanged())
+				region.add(control.getLocalBounds());
+			else
+				scheduler.stats.numSkipped++;
+		}
+
+		wholeControlDirty = false;
+		partsDirty.clear();
+
+		if (region.isEmpty())
+			return;
+
+		region.consolidate();
+
+		passingOn = true;
+
+		if (region.getNumRectangles() > maxRectanglesPerFlush)
+		{
+			control.repaint(region.getBounds());
+			scheduler.stats.numExecuted++;
+		}
+		else
+		{
+			for (const auto& area : region)
+			{
+				control.repaint(area);
+				scheduler.stats.numExecuted++;
+			}
+		}
+
+		passingOn = false;
+	}
+
+	void resetVisualState() { hasLastVisualState = false; }
+
+	/** CachedComponentImage */
+	void paint(juce::Graphics& g) override
+	{
+		control.paintEntireComponent(g, false);
+	}
+
+	bool invalidateAll() override
+	{
+		if (passingOn)
+			return true;
+
+		scheduler.stats.numRequested++;
+		wholeControlDirty = true;
+
+		return false;
+	}
+
+	bool invalidate(const juce::Rectangle<int>& area) override
+	{
+		if (passingOn)
+			return true;
+
+		scheduler.stats.numRequested++;
+		partsDirty.add(area);
+
+		return false;
+	}
+
+	void releaseResources() override {}
+
+private:
+	/**
+	 * ComponentListener
+	 * A control that is shown or moved to another parent has nothing on screen in its current state,
+	 * whatever its visual state was at the last flush, so its next repaint must not be skipped.
+	 */
+	void componentVisibilityChanged(juce::Component&) override { resetVisualState(); }
+	void componentParentHierarchyChanged(juce::Component&) override { resetVisualState(); }
+
+	void componentBeingDeleted(juce::Component&) override
+	{
+		control.removeComponentListener(this);
+		listening = false;
+	}
+
+
+	/** True if the visual state changed since the last flush (or can't be known). */
+	bool hasVisualStateChanged()
+	{
+		if (getVisualState == nullptr)
+			return true;
+
+		/** A theme switch changes how every control looks, and so does another LookAndFeel. */
+		auto visualState = RepaintScheduler::combineVisualState(getVisualState(), (juce::int64)Theme::getCurrentVersion());
+		visualState = RepaintScheduler::combineVisualState(visualState, (juce::int64)(juce::pointer_sized_int)&control.getLookAndFeel());
+
+		if (hasLastVisualState && visualState == lastVisualState)
+			return false;
+
+		lastVisualState = visualState;
+		hasLastVisualState = true;
+
+		return true;
+	}
+
+	RepaintScheduler& scheduler;
+	juce::Component& control;
+	VisualStateFunction getVisualState;
+
+	bool wholeControlDirty = false;
+	juce::RectangleList<int> partsDirty;
+
+	bool hasLastVisualState = false;
+	juce::int64 lastVisualState = 0;
+
+	/** True while the held back repaints are passed on. */
+	bool passingOn = false;
+
+	bool listening = true;
+
+	JUCE_DECLARE_NON_COPYABLE(ControlHook)
+};
+
+juce::String RepaintScheduler::Stats::toString() const
+{
+	juce::String text;
+	text << "Repaints requested: " << numRequested
+		<< ", executed: " << numExecuted
+		<< ", skipped (unchanged): " << numSkipped
+		<< ", flushes: " << numFlushes;
+
+	return text;
+}
+
+RepaintScheduler::RepaintScheduler(juce::Component& componentToSyncTo)
+	: vBlankAttachment(&componentToSyncTo, [this]
+		{
+			renderCache->beginFrame();
+
+			if (!isSuspended())
+				flush();
+		})
+{
+}
+
+RepaintScheduler::~RepaintScheduler()
+{
+	for (auto& control : controls)
+	{
+		if (control != nullptr)
+			control->setCachedComponentImage(nullptr);
+	}
+}
+
+void RepaintScheduler::addControl(juce::Component& control, VisualStateFunction getVisualState)
+{
+	jassert(control.getCachedComponentImage() == nullptr);
+
+	control.setCachedComponentImage(new ControlHook(*this, control, std::move(getVisualState)));
+	controls.add(&control);
+}
+
+void RepaintScheduler::removeControl(juce::Component& control)
+{
+	if (auto* hook = getHook(&control))
+	{
+		hook->flush();
+		control.setCachedComponentImage(nullptr);
+	}
+
+	controls.removeFirstMatchingValue(&control);
+}
+
+void RepaintScheduler::flush()
+{
+	const int numExecutedBefore = stats.numExecuted;
+	const int numSkippedBefore = stats.numSkipped;
+
+	for (auto& control : controls)
+	{
+		if (auto* hook = getHook(control))
+			hook->flush();
+	}
+
+	if (stats.numExecuted != numExecutedBefore || stats.numSkipped != numSkippedBefore)
+		stats.numFlushes++;
+}
+
+void RepaintScheduler::suspend()
+{
+	numSuspensions++;
+}
+
+void RepaintScheduler::resume()
+{
+	jassert(numSuspensions > 0);
+	numSuspensions = juce::jmax(0, numSuspensions - 1);
+}
+
+void RepaintScheduler::resetVisualStates()
+{
+	for (auto& control : controls)
+	{
+		if (auto* hook = getHook(control))
+			hook->resetVisualState();
+	}
+}
+
+juce::int64 RepaintScheduler::getSliderVisualState(juce::Slider& slider)
+{
+	return getSliderVisualState(slider, juce::roundToInt(slider.valueToProportionOfLength(slider.getValue()) * 1.0e6));
+}
+
+juce::int64 RepaintScheduler::getSliderVisualState(juce::Slider& slider, int quantisedValuePosition)
+{
+	auto state = combineVisualState(slider.getWidth(), slider.getHeight());
+	state = combineVisualState(state, quantisedValuePosition);
+
+	/** Without a text box the value is painted by the LookAndFeel, so it's part of the slider's look. */
+	if (slider.getTextBoxPosition() == juce::Slider::NoTextBox)
+		state = combineVisualState(state, juce::roundToInt(slider.getValue() * std::pow(10.0, slider.getNumDecimalPlacesToDisplay())));
+	state = combineVisualState(state, slider.isMouseOverOrDragging() ? 1 : 0);
+	/** The full quality repaint after an interaction settles must not be skipped. */
+	state = combineVisualState(state, InteractionQuality::isInteractive(slider) ? 1 : 0);
+
+	return combineVisualState(state, slider.isEnabled() ? 1 : 0);
+}
+
+juce::int64 RepaintScheduler::getButtonVisualState(const juce::Button& button)
+{
+	auto state = combineVisualState(button.getWidth(), button.getHeight());
+	state = combineVisualState(state, button.getToggleState() ? 1 : 0);
+	state = combineVisualState(state, (juce::int64)button.getState());
+
+	return combineVisualState(state, button.isEnabled() ? 1 : 0);
+}
+
+juce::int64 RepaintScheduler::getButtonVisualState(const juce::Button& button, int renderedState)
+{
+	auto state = combineVisualState(button.getWidth(), button.getHeight());
+	state = combineVisualState(state, renderedState);
+
+	return combineVisualState(state, button.isEnabled() ? 1 : 0);
+}
+
+float RepaintScheduler::getPhysicalPixelScale(const juce::Component& component)
+{
+	float scale = juce::Component::getApproximateScaleFactorForComponent(&component);
+
+	if (auto* display = juce::Desktop::getInstance().getDisplays().getDisplayForRect(component.getScreenBounds()))
+		scale *= (float)display->scale;
+
+	return scale;
+}
+
+RepaintScheduler::ControlHook* RepaintScheduler::getHook(juce::Component* control) const
+{
+	if (control == nullptr)
+		return nullptr;
+
+	return dynamic_cast<ControlHook*>(control->getCachedComponentImage());
+}
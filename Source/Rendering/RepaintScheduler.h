@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    RepaintScheduler.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RenderCache.h"
+
+/**
+ * Frame synchronised repaints of the custom controls.
+ *
+ * Value changes, hover changes and automation can ask a control to repaint
+ * several times between two display refreshes. The scheduler catches those
+ * requests (through the control's CachedComponentImage, which every repaint of
+ * a component and its children goes through), merges them and passes them on
+ * once per vblank. Each vblank also starts a new frame of the shared
+ * RenderCache, so its rebuild budget is spent per displayed frame.
+ *
+ * A control can have a visual state function. When a control asked to repaint
+ * itself as a whole but its visual state is the same as at the last flush, the
+ * repaint is skipped. Repaints of parts of a control (e.g. its text box) are
+ * always passed on, and so is the first whole control repaint after the control
+ * was shown, moved to another parent or given another LookAndFeel: only value,
+ * hover and similar changes that leave the control looking the same are filtered.
+ */
+class RepaintScheduler
+{
+public:
+	/** Returns a value that changes whenever the control would look different. */
+	using VisualStateFunction = std::function<juce::int64()>;
+
+	/** Repaint counters. */
+	struct Stats
+	{
+		/** repaint() calls made on the controls. */
+		int numRequested = 0;
+		/** Repaints passed on to the controls' parents. */
+		int numExecuted = 0;
+		/** Whole control repaints skipped because the visual state hadn't changed. */
+		int numSkipped = 0;
+		/** vblanks that had something to flush. */
+		int numFlushes = 0;
+
+		juce::String toString() const;
+	};
+
+	/** Creates a scheduler that flushes on the vblanks of the display the component is on. */
+	explicit RepaintScheduler(juce::Component& componentToSyncTo);
+	~RepaintScheduler();
+
+	/** Schedules the repaints of a control. The control must not already have a cached image. */
+	void addControl(juce::Component& control, VisualStateFunction getVisualState = {});
+
+	/** Stops scheduling the repaints of a control. */
+	void removeControl(juce::Component& control);
+
+	/** Passes every pending repaint on now. */
+	void flush();
+
+	/**
+	 * Holds every repaint back until resume() is called, e.g. while a preset is loaded.
+	 * Calls nest; the vblank after the last resume() flushes everything in one go.
+	 */
+	void suspend();
+
+	/** Ends a suspend(). */
+	void resume();
+
+	/** True between suspend() and its resume(). */
+	bool isSuspended() const { return numSuspensions > 0; }
+
+	/** Forgets the visual states, so that the next repaint of every control is executed (e.g. after a colour change). */
+	void resetVisualStates();
+
+	/** Returns the counters. */
+	const Stats& getStats() const { return stats; }
+
+	/** Resets the counters. */
+	void resetStats() { stats = Stats(); }
+
+	/** Visual state of a slider: size, value, hover, enablement and interaction quality. */
+	static juce::int64 getSliderVisualState(juce::Slider& slider);
+
+	/**
+	 * Visual state of a slider, with its value replaced by where the slider draws it (e.g. its
+	 * thumb position) in physical pixels, so value changes that don't move anything by a whole
+	 * pixel are skipped. Its text box repaints itself independently; without a text box the
+	 * displayed value is included instead.
+	 */
+	static juce::int64 getSliderVisualState(juce::Slider& slider, int quantisedValuePosition);
+
+	/** Physical pixels per logical pixel of a component on its display. */
+	static float getPhysicalPixelScale(const juce::Component& component);
+
+	/** Visual state of a button: size, toggle state, button state and enablement. */
+	static juce::int64 getButtonVisualState(const juce::Button& button);
+
+	/**
+	 * Visual state of a button, with its toggle and button state replaced by the state it is drawn in,
+	 * so changes between states that are drawn the same are skipped.
+	 */
+	static juce::int64 getButtonVisualState(const juce::Button& button, int renderedState);
+
+	/** Mixes a value into a visual state. */
+	static juce::int64 combineVisualState(juce::int64 state, juce::int64 value)
+	{
+		return (juce::int64)(((juce::uint64)state ^ (juce::uint64)value) * 0x100000001b3ull);
+	}
+
+private:
+	class ControlHook;
+
+	/** More rectangles than this are merged into their bounds. */
+	static constexpr int maxRectanglesPerFlush = 4;
+
+	/** The scheduled controls. Their hooks are owned by the controls, as their cached images. */
+	juce::Array<juce::Component::SafePointer<juce::Component>> controls;
+
+	/** Returns the hook of a control, or nullptr if it isn't scheduled. */
+	ControlHook* getHook(juce::Component* control) const;
+
+	Stats stats;
+
+	int numSuspensions = 0;
+
+	juce::SharedResourcePointer<RenderCache> renderCache;
+
+	juce::VBlankAttachment vBlankAttachment;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RepaintScheduler)
+};
@@ -0,0 +1,394 @@
+/*
+  ==============================================================================
+
+    RoundedRectRasteriser.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "RoundedRectRasteriser.h"
+#include "FloatLanes.h"
+
+/**
+ * AVX2 isn't a given on x86, so its row function is compiled for it on its own and only called when
+ * the CPU has it. It's written with intrinsics rather than FloatLanes, so that nothing shared with the
+ * rest of the code is compiled for AVX2.
+ */
+#if FLOAT_LANES_USE_SSE2
+ #define ROUNDED_RECT_USE_AVX2 1
+ #include <immintrin.h>
+ #if JUCE_GCC || JUCE_CLANG
+  #define ROUNDED_RECT_AVX2_TARGET __attribute__((target("avx2,fma")))
+ #else
+  #define ROUNDED_RECT_AVX2_TARGET
+ #endif
+#else
+ #define ROUNDED_RECT_USE_AVX2 0
+#endif
+
+std::atomic<bool> RoundedRectRasteriser::enabled { false };
+
+namespace
+{
+	/** A rounded rectangle and its fill, in the pixels of the bitmap it's drawn into. */
+	struct Fill
+	{
+		/** Centre, and the half size of the rectangle the corners are rounded around. */
+		float centreX = 0.f, centreY = 0.f;
+		float innerHalfWidth = 0.f, innerHalfHeight = 0.f;
+		float cornerRadius = 0.f;
+
+		/**
+		 * Gradient colours, premultiplied, with one over the distance to the previous colour.
+		 * They're interpolated premultiplied, like JUCE's gradient fills, so that a fade to a transparent colour doesn't darken.
+		 */
+		int numColours = 0;
+		float positions[RoundedRectRasteriser::maxColours];
+		float inverseSpans[RoundedRectRasteriser::maxColours];
+		float alpha[RoundedRectRasteriser::maxColours];
+		float red[RoundedRectRasteriser::maxColours];
+		float green[RoundedRectRasteriser::maxColours];
+		float blue[RoundedRectRasteriser::maxColours];
+
+		/** Linear gradients step along (stepX, stepY) from point 1; radial ones grow with the distance from it. */
+		bool isRadial = false;
+		float startX = 0.f, startY = 0.f;
+		float stepX = 0.f, stepY = 0.f;
+		float inverseRadius = 0.f;
+
+		Fill(juce::Rectangle<float> area, float cornerSize, const juce::ColourGradient& gradient)
+		{
+			/** Like Graphics::fillRoundedRectangle(), corners are at most half the shortest side. */
+			cornerRadius = juce::jmin(cornerSize, area.getWidth() / 2.f, area.getHeight() / 2.f);
+
+			centreX = area.getCentreX();
+			centreY = area.getCentreY();
+			innerHalfWidth = area.getWidth() / 2.f - cornerRadius;
+			innerHalfHeight = area.getHeight() / 2.f - cornerRadius;
+
+			numColours = juce::jmin(gradient.getNumColours(), RoundedRectRasteriser::maxColours);
+
+			for (int i = 0; i < numColours; i++)
+			{
+				const auto colour = gradient.getColour(i);
+
+				positions[i] = (float)gradient.getColourPosition(i);
+				inverseSpans[i] = i > 0 ? 1.f / juce::jmax(1.0e-6f, positions[i] - positions[i - 1]) : 0.f;
+				alpha[i] = colour.getFloatAlpha();
+				red[i] = colour.getFloatRed() * alpha[i];
+				green[i] = colour.getFloatGreen() * alpha[i];
+				blue[i] = colour.getFloatBlue() * alpha[i];
+			}
+
+			isRadial = gradient.isRadial;
+			startX = gradient.point1.x;
+			startY = gradient.point1.y;
+
+			const auto direction = gradient.point2 - gradient.point1;
+			const auto lengthSquared = juce::jmax(1.0e-6f, direction.x * direction.x + direction.y * direction.y);
+
+			stepX = direction.x / lengthSquared;
+			stepY = direction.y / lengthSquared;
+			inverseRadius = 1.f / std::sqrt(lengthSquared);
+		}
+
+		/** Premultiplied colours of the gradient at the given points, like ColourGradient's lookup table without the steps. */
+		template <typename Floats>
+		void getColours(Floats x, Floats y, Floats& a, Floats& r, Floats& g, Floats& b) const
+		{
+			a = alpha[0];
+			r = red[0];
+			g = green[0];
+			b = blue[0];
+
+			if (numColours > 1)
+			{
+				const auto dx = x - Floats(startX);
+				const auto dy = y - Floats(startY);
+
+				const auto position = FloatLanes::clamp(isRadial
+					? sqrt(dx * dx + dy * dy) * Floats(inverseRadius)
+					: dx * Floats(stepX) + dy * Floats(stepY), 0.f, 1.f);
+
+				/** Each colour adds its difference from the previous one, in proportion to how far past the previous one the position is. */
+				for (int i = 1; i < numColours; i++)
+				{
+					const auto weight = FloatLanes::clamp((position - Floats(positions[i - 1])) * Floats(inverseSpans[i]), 0.f, 1.f);
+
+					a = a + weight * Floats(alpha[i] - alpha[i - 1]);
+					r = r + weight * Floats(red[i] - red[i - 1]);
+					g = g + weight * Floats(green[i] - green[i - 1]);
+					b = b + weight * Floats(blue[i] - blue[i - 1]);
+				}
+			}
+		}
+	};
+
+	/** Composites the rectangle over a row of pixels from firstPixel on, Floats::numLanes at a time. Returns the first pixel left. */
+	template <typename Floats>
+	int fillRow(juce::PixelARGB* row, int firstPixel, int endPixel, float y, const Fill& fill)
+	{
+		/** The distance to a rounded rectangle is the distance to its inner rectangle, less the corner radius. */
+		const Floats qy = std::abs(y - fill.centreY) - fill.innerHalfHeight;
+		const auto outsideY = max(qy, Floats(0.f));
+
+		int pixel = firstPixel;
+
+		for (; pixel + Floats::numLanes <= endPixel; pixel += Floats::numLanes)
+		{
+			const auto x = Floats::ramp(pixel + 0.5f, 1.f);
+
+			const auto qx = abs(x - Floats(fill.centreX)) - Floats(fill.innerHalfWidth);
+			const auto outsideX = max(qx, Floats(0.f));
+			const auto distance = sqrt(outsideX * outsideX + outsideY * outsideY) + min(max(qx, qy), Floats(0.f)) - Floats(fill.cornerRadius);
+			const auto coverage = FloatLanes::clamp(Floats(0.5f) - distance, 0.f, 1.f);
+
+			Floats alpha, red, green, blue;
+			fill.getColours(x, Floats(y), alpha, red, green, blue);
+
+			Floats destAlpha, destRed, destGreen, destBlue;
+			Floats::loadPixels(row + pixel, destAlpha, destRed, destGreen, destBlue);
+
+			const auto remaining = Floats(1.f) - alpha * coverage;
+
+			Floats::storePixels(row + pixel,
+				FloatLanes::clamp(alpha * coverage + destAlpha * remaining, 0.f, 1.f),
+				FloatLanes::clamp(red * coverage + destRed * remaining, 0.f, 1.f),
+				FloatLanes::clamp(green * coverage + destGreen * remaining, 0.f, 1.f),
+				FloatLanes::clamp(blue * coverage + destBlue * remaining, 0.f, 1.f));
+		}
+
+		return pixel;
+	}
+
+#if ROUNDED_RECT_USE_AVX2
+	/** fillRow(), eight pixels at a time. */
+	ROUNDED_RECT_AVX2_TARGET
+	int fillRowAvx2(juce::PixelARGB* row, int firstPixel, int endPixel, float y, const Fill& fill)
+	{
+		const auto zero = _mm256_setzero_ps();
+		const auto one = _mm256_set1_ps(1.f);
+		const auto absMask = _mm256_set1_ps(-0.f);
+		const auto byteMask = _mm256_set1_epi32(0xff);
+		const auto toBytes = _mm256_set1_ps(255.f);
+		const auto offsets = _mm256_set_ps(7.5f, 6.5f, 5.5f, 4.5f, 3.5f, 2.5f, 1.5f, 0.5f);
+
+		const auto qy = _mm256_set1_ps(std::abs(y - fill.centreY) - fill.innerHalfHeight);
+		const auto outsideY = _mm256_max_ps(qy, zero);
+		const auto dy = _mm256_set1_ps(y - fill.startY);
+
+		int pixel = firstPixel;
+
+		for (; pixel + 8 <= endPixel; pixel += 8)
+		{
+			const auto x = _mm256_add_ps(_mm256_set1_ps((float)pixel), offsets);
+
+			const auto qx = _mm256_sub_ps(_mm256_andnot_ps(absMask, _mm256_sub_ps(x, _mm256_set1_ps(fill.centreX))),
+				_mm256_set1_ps(fill.innerHalfWidth));
+			const auto outsideX = _mm256_max_ps(qx, zero);
+			const auto distance = _mm256_sub_ps(_mm256_add_ps(
+				_mm256_sqrt_ps(_mm256_fmadd_ps(outsideX, outsideX, _mm256_mul_ps(outsideY, outsideY))),
+				_mm256_min_ps(_mm256_max_ps(qx, qy), zero)), _mm256_set1_ps(fill.cornerRadius));
+			const auto coverage = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(0.5f), distance), zero), one);
+
+			auto alpha = _mm256_set1_ps(fill.alpha[0]);
+			auto red = _mm256_set1_ps(fill.red[0]);
+			auto green = _mm256_set1_ps(fill.green[0]);
+			auto blue = _mm256_set1_ps(fill.blue[0]);
+
+			if (fill.numColours > 1)
+			{
+				const auto dx = _mm256_sub_ps(x, _mm256_set1_ps(fill.startX));
+
+				auto position = fill.isRadial
+					? _mm256_mul_ps(_mm256_sqrt_ps(_mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy))), _mm256_set1_ps(fill.inverseRadius))
+					: _mm256_fmadd_ps(dx, _mm256_set1_ps(fill.stepX), _mm256_mul_ps(dy, _mm256_set1_ps(fill.stepY)));
+				position = _mm256_min_ps(_mm256_max_ps(position, zero), one);
+
+				for (int i = 1; i < fill.numColours; i++)
+				{
+					auto weight = _mm256_mul_ps(_mm256_sub_ps(position, _mm256_set1_ps(fill.positions[i - 1])), _mm256_set1_ps(fill.inverseSpans[i]));
+					weight = _mm256_min_ps(_mm256_max_ps(weight, zero), one);
+
+					alpha = _mm256_fmadd_ps(weight, _mm256_set1_ps(fill.alpha[i] - fill.alpha[i - 1]), alpha);
+					red = _mm256_fmadd_ps(weight, _mm256_set1_ps(fill.red[i] - fill.red[i - 1]), red);
+					green = _mm256_fmadd_ps(weight, _mm256_set1_ps(fill.green[i] - fill.green[i - 1]), green);
+					blue = _mm256_fmadd_ps(weight, _mm256_set1_ps(fill.blue[i] - fill.blue[i - 1]), blue);
+				}
+			}
+
+			const auto sourceAlpha = _mm256_mul_ps(alpha, coverage);
+			const auto sourceScale = _mm256_mul_ps(coverage, toBytes);
+			const auto remaining = _mm256_sub_ps(one, sourceAlpha);
+
+			/** The destination stays in bytes: source * 255 + destination * (1 - source alpha). */
+			const auto dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + pixel));
+			const auto destAlpha = _mm256_cvtepi32_ps(_mm256_srli_epi32(dest, 24));
+			const auto destRed = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(dest, 16), byteMask));
+			const auto destGreen = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(dest, 8), byteMask));
+			const auto destBlue = _mm256_cvtepi32_ps(_mm256_and_si256(dest, byteMask));
+
+			const auto levelAlpha = _mm256_fmadd_ps(destAlpha, remaining, _mm256_mul_ps(alpha, sourceScale));
+			const auto levelRed = _mm256_fmadd_ps(destRed, remaining, _mm256_mul_ps(red, sourceScale));
+			const auto levelGreen = _mm256_fmadd_ps(destGreen, remaining, _mm256_mul_ps(green, sourceScale));
+			const auto levelBlue = _mm256_fmadd_ps(destBlue, remaining, _mm256_mul_ps(blue, sourceScale));
+
+			const auto argb = _mm256_or_si256(
+				_mm256_or_si256(_mm256_slli_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(levelAlpha, zero), toBytes)), 24),
+					_mm256_slli_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(levelRed, zero), toBytes)), 16)),
+				_mm256_or_si256(_mm256_slli_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(levelGreen, zero), toBytes)), 8),
+					_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(levelBlue, zero), toBytes))));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(row + pixel), argb);
+		}
+
+		return pixel;
+	}
+#endif
+
+	/** Fills the rows of the given pixels with the widest lanes the CPU has, then narrower ones for what's left of each row. */
+	void fillRows(const juce::Image::BitmapData& destination, juce::Rectangle<int> pixels, const Fill& fill)
+	{
+#if ROUNDED_RECT_USE_AVX2
+		const bool useAvx2 = RoundedRectRasteriser::getInstructionSet() == RoundedRectRasteriser::InstructionSet::avx2;
+#endif
+
+		for (int rowIndex = pixels.getY(); rowIndex < pixels.getBottom(); rowIndex++)
+		{
+			auto* row = reinterpret_cast<juce::PixelARGB*>(destination.getLinePointer(rowIndex));
+			const float y = rowIndex + 0.5f;
+
+			int pixel = pixels.getX();
+
+#if ROUNDED_RECT_USE_AVX2
+			if (useAvx2)
+				pixel = fillRowAvx2(row, pixel, pixels.getRight(), y, fill);
+#endif
+
+			pixel = fillRow<FloatLanes::Native>(row, pixel, pixels.getRight(), y, fill);
+			fillRow<FloatLanes::Scalar>(row, pixel, pixels.getRight(), y, fill);
+		}
+	}
+
+	/** Grow-only scratch image per thread, for rasterising through a software renderer. */
+	juce::Image getScratchImage(int width, int height)
+	{
+		thread_local juce::Image scratch;
+
+		if (scratch.getWidth() < width || scratch.getHeight() < height)
+			scratch = juce::Image(juce::Image::ARGB, juce::jmax(width, scratch.getWidth()), juce::jmax(height, scratch.getHeight()),
+				false, juce::SoftwareImageType());
+
+		return scratch;
+	}
+}
+
+void RoundedRectRasteriser::fill(juce::Graphics& g, juce::Rectangle<float> area, float cornerSize, const juce::ColourGradient& gradient)
+{
+	if (!canRasterise(g) || gradient.getNumColours() > maxColours)
+	{
+		g.setGradientFill(gradient);
+		g.fillRoundedRectangle(area, cornerSize);
+		return;
+	}
+
+	const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+	/** Only the visible part is rasterised, in whole physical pixels so the blit isn't resampled. */
+	const auto physicalArea = (area * scale).getSmallestIntegerContainer()
+		.getIntersection((g.getClipBounds().toFloat() * scale).getSmallestIntegerContainer());
+
+	if (physicalArea.isEmpty())
+		return;
+
+	const auto origin = physicalArea.getPosition().toFloat();
+
+	auto scratchGradient = gradient;
+	scratchGradient.point1 = gradient.point1 * scale - origin;
+	scratchGradient.point2 = gradient.point2 * scale - origin;
+
+	auto scratch = getScratchImage(physicalArea.getWidth(), physicalArea.getHeight())
+		.getClippedImage(physicalArea.withZeroOrigin());
+	scratch.clear(scratch.getBounds());
+
+	{
+		const juce::Image::BitmapData bitmap(scratch, juce::Image::BitmapData::readWrite);
+		fill(bitmap, (area * scale).translated(-origin.x, -origin.y), cornerSize * scale, scratchGradient);
+	}
+
+	g.drawImageTransformed(scratch, juce::AffineTransform::scale(1.f / scale)
+		.translated(physicalArea.getX() / scale, physicalArea.getY() / scale));
+}
+
+void RoundedRectRasteriser::fill(juce::Graphics& g, juce::Rectangle<float> area, float cornerSize, juce::Colour colour)
+{
+	if (!canRasterise(g))
+	{
+		g.setColour(colour);
+		g.fillRoundedRectangle(area, cornerSize);
+		return;
+	}
+
+	juce::ColourGradient solidColour;
+	solidColour.addColour(0.0, colour);
+
+	fill(g, area, cornerSize, solidColour);
+}
+
+bool RoundedRectRasteriser::fill(const juce::Image::BitmapData& destination, juce::Rectangle<float> area, float cornerSize,
+	const juce::ColourGradient& gradient)
+{
+	jassert(destination.pixelFormat == juce::Image::ARGB && destination.pixelStride == (int)sizeof(juce::PixelARGB));
+
+	if (gradient.getNumColours() == 0 || gradient.getNumColours() > maxColours)
+		return false;
+
+	const auto pixels = area.getSmallestIntegerContainer()
+		.getIntersection({ destination.width, destination.height });
+
+	if (!pixels.isEmpty())
+		fillRows(destination, pixels, Fill(area, cornerSize, gradient));
+
+	return true;
+}
+
+bool RoundedRectRasteriser::canRasterise(juce::Graphics& g)
+{
+	return isEnabled() && dynamic_cast<juce::LowLevelGraphicsSoftwareRenderer*>(&g.getInternalContext()) != nullptr;
+}
+
+void RoundedRectRasteriser::setEnabled(bool shouldBeEnabled)
+{
+	enabled = shouldBeEnabled;
+}
+
+bool RoundedRectRasteriser::isEnabled()
+{
+	return enabled;
+}
+
+RoundedRectRasteriser::InstructionSet RoundedRectRasteriser::getInstructionSet()
+{
+#if ROUNDED_RECT_USE_AVX2
+	static const bool hasAvx2 = juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3();
+	return hasAvx2 ? InstructionSet::avx2 : InstructionSet::sse2;
+#elif FLOAT_LANES_USE_NEON
+	return InstructionSet::neon;
+#else
+	return InstructionSet::scalar;
+#endif
+}
+
+const char* RoundedRectRasteriser::getInstructionSetName(InstructionSet instructionSet)
+{
+	switch (instructionSet)
+	{
+	case InstructionSet::sse2:	return "SSE2";
+	case InstructionSet::avx2:	return "AVX2";
+	case InstructionSet::neon:	return "NEON";
+	case InstructionSet::scalar:
+	default:					return "scalar";
+	}
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    RoundedRectRasteriser.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Fills antialiased, axis-aligned rounded rectangles with a solid colour or a linear or radial
+ * gradient: the fader tracks and caps and the waveform button bodies.
+ *
+ * Coverage comes from the distance to the rounded rectangle and the colour from the gradient's
+ * stops, both evaluated for a row of pixels at a time with the widest SIMD the CPU has, picked at
+ * run time: AVX2 (eight pixels), SSE2 or NEON (four), or one at a time. The pixels are composited
+ * over an ARGB bitmap directly.
+ *
+ * Off unless setEnabled(true) is called (--rasterise-rounded-rects on the command line).
+ *
+ * juce::Graphics doesn't give access to the image it draws into, so when drawing through a software
+ * renderer the rectangle is rasterised into a scratch image of the visible part and composited with
+ * a single blit. Any other context (CoreGraphics, Direct2D, OpenGL) is drawn with Graphics as before.
+ */
+class RoundedRectRasteriser
+{
+public:
+	/** Instruction sets the rows can be rasterised with. */
+	enum class InstructionSet
+	{
+		scalar,
+		sse2,
+		avx2,
+		neon
+	};
+
+	/** Gradients with more colours than this are drawn with Graphics. */
+	static constexpr int maxColours = 8;
+
+	/** Same as g.setGradientFill(gradient) followed by g.fillRoundedRectangle(area, cornerSize). */
+	static void fill(juce::Graphics& g, juce::Rectangle<float> area, float cornerSize, const juce::ColourGradient& gradient);
+
+	/** Same as g.setColour(colour) followed by g.fillRoundedRectangle(area, cornerSize). */
+	static void fill(juce::Graphics& g, juce::Rectangle<float> area, float cornerSize, juce::Colour colour);
+
+	/**
+	 * Composites a rounded rectangle filled with the gradient over an ARGB bitmap.
+	 * The area, the corner size and the gradient's points are in the bitmap's pixels.
+	 *
+	 * \return False, without drawing anything, if the gradient has more than maxColours colours.
+	 */
+	static bool fill(const juce::Image::BitmapData& destination, juce::Rectangle<float> area, float cornerSize,
+		const juce::ColourGradient& gradient);
+
+	/** True if fill() rasterises for this context rather than drawing with Graphics. */
+	static bool canRasterise(juce::Graphics& g);
+
+	/**
+	 * Turns the rasteriser on. Off by default, so that everything is drawn with Graphics as before, until
+	 * --bench-roundrect has been run to compare the two at the sizes the controls fill.
+	 */
+	static void setEnabled(bool shouldBeEnabled);
+	static bool isEnabled();
+
+	/** The instruction set this CPU rasterises with. */
+	static InstructionSet getInstructionSet();
+	static const char* getInstructionSetName(InstructionSet instructionSet);
+
+private:
+	static std::atomic<bool> enabled;
+};
@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+    Theme.cpp
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#include "Theme.h"
+
+std::atomic<juce::uint32> Theme::lastVersion { 0 };
+std::atomic<juce::uint32> Theme::currentVersion { 0 };
+
+namespace
+{
+	juce::SpinLock currentThemeLock;
+
+	/** The current theme, created with the default colours on first use. */
+	Theme::Ptr& getCurrentTheme()
+	{
+		static Theme::Ptr currentTheme;
+		return currentTheme;
+	}
+}
+
+Theme::Ptr Theme::create(const Colours& colours)
+{
+	return Ptr(new Theme(colours, ++lastVersion));
+}
+
+Theme::Ptr Theme::getCurrent()
+{
+	const juce::SpinLock::ScopedLockType sl(currentThemeLock);
+
+	auto& currentTheme = getCurrentTheme();
+
+	if (currentTheme == nullptr)
+	{
+		currentTheme = create(Colours());
+		currentVersion = currentTheme->getVersion();
+	}
+
+	return currentTheme;
+}
+
+juce::uint64 Theme::getColoursHash() const
+{
+	/** Colours holds nothing but Colours, so it can be hashed as an array of ARGB values (FNV-1a). */
+	static_assert(sizeof(Colours) % sizeof(juce::Colour) == 0, "Theme::Colours must only hold juce::Colours");
+
+	const auto* colour = reinterpret_cast<const juce::Colour*>(&colours);
+	juce::uint64 hash = 0xcbf29ce484222325ull;
+
+	for (size_t i = 0; i < sizeof(Colours) / sizeof(juce::Colour); i++)
+	{
+		hash ^= colour[i].getARGB();
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+void Theme::setCurrent(Ptr newTheme)
+{
+	jassert(newTheme != nullptr);
+
+	{
+		const juce::SpinLock::ScopedLockType sl(currentThemeLock);
+
+		getCurrentTheme() = newTheme;
+		currentVersion = newTheme->getVersion();
+	}
+
+	if (auto* messageManager = juce::MessageManager::getInstanceWithoutCreating())
+	{
+		if (messageManager->isThisTheMessageThread())
+		{
+			auto& desktop = juce::Desktop::getInstance();
+
+			for (int i = 0; i < desktop.getNumComponents(); i++)
+				desktop.getComponent(i)->sendLookAndFeelChange();
+		}
+	}
+}
+
+void Theme::Overrides::set(juce::Colour Colours::* colour, juce::Colour newColour)
+{
+	const juce::SpinLock::ScopedLockType sl(lock);
+
+	auto found = std::find_if(colours.begin(), colours.end(), [colour](const auto& entry) { return entry.first == colour; });
+
+	if (found != colours.end())
+		found->second = newColour;
+	else
+		colours.emplace_back(colour, newColour);
+
+	/** The next snapshot gets a new version, so caches keyed on it see the change. */
+	lastResult.reset();
+}
+
+void Theme::Overrides::clear()
+{
+	const juce::SpinLock::ScopedLockType sl(lock);
+
+	colours.clear();
+	lastResult.reset();
+}
+
+bool Theme::Overrides::isEmpty() const
+{
+	const juce::SpinLock::ScopedLockType sl(lock);
+	return colours.empty();
+}
+
+Theme::Ptr Theme::Overrides::applyTo(const Ptr& theme) const
+{
+	const juce::SpinLock::ScopedLockType sl(lock);
+
+	if (colours.empty())
+		return theme;
+
+	if (lastResult == nullptr || lastTheme != theme)
+	{
+		lastResult = theme->withChange([this](Colours& changedColours)
+			{
+				for (const auto& entry : colours)
+					changedColours.*(entry.first) = entry.second;
+			});
+
+		lastTheme = theme;
+	}
+
+	return lastResult;
+}
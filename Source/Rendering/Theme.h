@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    Theme.h
+    Created: 19 Oct 2026
+    Author:  G
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Immutable snapshot of the colours the custom controls are drawn with.
+ *
+ * Every snapshot gets a new version number, so caches of layers that bake
+ * colours in only need to compare (or key on) the version to know whether
+ * they are still valid. All LookAndFeels draw with the current theme, with
+ * the colours changed through their setters applied on top (see Overrides).
+ */
+class Theme
+{
+public:
+	/** The colours of the controls. */
+	struct Colours
+	{
+		/** Linear sliders */
+		juce::Colour sliderBackground = juce::Colours::transparentWhite;
+		juce::Colour sliderOutline = juce::Colours::beige;
+		juce::Colour sliderGrading = juce::Colours::beige.darker(0.5);
+		juce::Colour sliderTrackSides = juce::Colours::darkgrey.darker(0.7f);
+		juce::Colour sliderTrackCenter = juce::Colours::black;
+		juce::Colour sliderCap = juce::Colours::darkgrey;
+		juce::Colour sliderCapLine = juce::Colours::black;
+
+		/** Gear-shaped knob */
+		juce::Colour knobMinMax = juce::Colours::beige;
+		juce::Colour knobDisk = juce::Colours::black.brighter(0.03);
+		juce::Colour knobPointer = juce::Colours::beige.darker(0.8);
+		juce::Colour knobGear = juce::Colours::black.brighter(0.05);
+
+		/** Waveform buttons */
+		juce::Colour buttonBackground = juce::Colours::transparentBlack;
+		juce::Colour buttonNormal = juce::Colours::black.brighter(0.2);
+		juce::Colour buttonOver = juce::Colours::black.brighter(0.2);
+		juce::Colour buttonDown = juce::Colours::black.brighter(0.6);
+		juce::Colour waveform = juce::Colours::darkorange;
+
+		/** Value text boxes, readouts and editors */
+		juce::Colour text = juce::Colours::beige;
+		juce::Colour textEditorBackground = juce::Colours::black;
+	};
+
+	using Ptr = std::shared_ptr<const Theme>;
+
+	/**
+	 * Colours one LookAndFeel draws with instead of the theme's.
+	 *
+	 * They are applied on top of the theme the LookAndFeel follows, so a theme switch still reaches
+	 * every colour that wasn't overridden. The combined snapshot is kept until the theme or the
+	 * overrides change, and has a version of its own, like any other snapshot.
+	 */
+	class Overrides
+	{
+	public:
+		/** Overrides a colour, e.g. set(&Theme::Colours::sliderCap, juce::Colours::red). */
+		void set(juce::Colour Colours::* colour, juce::Colour newColour);
+
+		/** Stops overriding any colour. */
+		void clear();
+
+		bool isEmpty() const;
+
+		/** Returns the theme with the overrides applied, or the theme itself if there are none. Thread-safe. */
+		Ptr applyTo(const Ptr& theme) const;
+
+	private:
+		mutable juce::SpinLock lock;
+		std::vector<std::pair<juce::Colour Colours::*, juce::Colour>> colours;
+
+		/** The last theme the overrides were applied to, and the result. */
+		mutable Ptr lastTheme;
+		mutable Ptr lastResult;
+	};
+
+	/** Creates a snapshot of the colours, with a new version. */
+	static Ptr create(const Colours& colours);
+
+	/** Returns a snapshot of these colours with a change applied, with a new version. */
+	Ptr withChange(const std::function<void(Colours&)>& change) const
+	{
+		auto changedColours = colours;
+		change(changedColours);
+
+		return create(changedColours);
+	}
+
+	const Colours& getColours() const { return colours; }
+
+	/** Version of the snapshot. Never 0, and never the same for two snapshots. */
+	juce::uint32 getVersion() const { return version; }
+
+	/** Hash of the colours. Unlike the version, it's the same from run to run for the same colours. */
+	juce::uint64 getColoursHash() const;
+
+	/** Returns the theme the controls are drawn with. Thread-safe. */
+	static Ptr getCurrent();
+
+	/** Returns the version of the current theme, without taking a reference to it. */
+	static juce::uint32 getCurrentVersion()
+	{
+		const auto version = currentVersion.load();
+		return version != 0 ? version : getCurrent()->getVersion();
+	}
+
+	/**
+	 * Makes a theme the current one.
+	 * Called on the message thread, the desktop components are sent a look and feel change,
+	 * so that text boxes pick the new colours up and everything is repainted once.
+	 */
+	static void setCurrent(Ptr newTheme);
+
+private:
+	Theme(const Colours& snapshotColours, juce::uint32 snapshotVersion)
+		: colours(snapshotColours), version(snapshotVersion) {}
+
+	const Colours colours;
+	const juce::uint32 version;
+
+	static std::atomic<juce::uint32> lastVersion;
+	static std::atomic<juce::uint32> currentVersion;
+};
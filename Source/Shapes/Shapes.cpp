@@ -629,3 +629,35 @@ Path Shapes::getNoisePath(Rectangle<float>&& buttonBounds)
 
         return gearShapedKnobPath;
     }
+
+    /** Returns a gear shaped polygon for small knobs: each arc is replaced by two straight lines. */
+    Path Shapes::getSimplifiedGearShapedPath(int numberOfSides, float totalDiameter, float totalCenterX, float totalCenterY, float knobGearInnerDiameter)
+    {
+        Path gearShapedKnobPath;
+        /** Same circle as getGearShapedPath() */
+        float circleToTakeArcFrom_CenterX = totalCenterX;
+        float circleToTakeArcFrom_CenterY = totalCenterY - knobGearInnerDiameter;
+        float circleToTakeArcFrom_Radius = knobGearInnerDiameter / 2.f;
+        constexpr float eighthOfCircleRadians = MathConstants<float>::pi / 4.f;
+
+        for (int i = 0; i < numberOfSides; i++)
+        {
+            /** Start, middle and end of the arc */
+            const float arcAngles[] = { 3.5f * eighthOfCircleRadians, 4.f * eighthOfCircleRadians, 4.5f * eighthOfCircleRadians };
+
+            for (int j = 0; j < 3; j++)
+            {
+                const auto point = Point<float>(circleToTakeArcFrom_CenterX, circleToTakeArcFrom_CenterY)
+                    .getPointOnCircumference(circleToTakeArcFrom_Radius, arcAngles[j]);
+
+                if (i == 0 && j == 0)
+                    gearShapedKnobPath.startNewSubPath(point);	// New path for the 1st point only so that the rest are connected.
+                else
+                    gearShapedKnobPath.lineTo(point);
+            }
+            gearShapedKnobPath.applyTransform(AffineTransform::rotation(eighthOfCircleRadians, totalCenterX, totalCenterY));
+        }
+        gearShapedKnobPath.closeSubPath();
+
+        return gearShapedKnobPath;
+    }